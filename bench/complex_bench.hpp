@@ -0,0 +1,117 @@
+//  Boost Complex Numbers, benchmark support header file  --------------------//
+
+//  Copyright 2013 Daryle Walker.
+//  Distributed under the Boost Software License, Version 1.0.  (See the
+//  accompanying file LICENSE_1_0.txt or a copy at
+//  <http://www.boost.org/LICENSE_1_0.txt>.)
+
+//  See <http://www.boost.org/libs/math/> for the library's home page.
+
+/** \file   complex_bench.hpp
+    \brief  Timing helpers shared by the benchmark programs.
+
+    Each program in this directory is standalone; build one with optimization
+    on and the library's include directory in the search path, e.g.:
+
+        g++ -std=c++11 -O2 -I../include complex_product_bench.cpp
+
+    Timings are the fastest of several runs.  Every program folds its results
+    into a checksum that it prints, so the timed work can't be optimized out.
+ */
+
+#ifndef BOOST_MATH_COMPLEX_BENCH_HPP
+#define BOOST_MATH_COMPLEX_BENCH_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+
+
+namespace bench
+{
+
+
+//  Timing functions  --------------------------------------------------------//
+
+/** \brief  Time an action
+
+    \param f     The action to be run.
+    \param runs  How many times to run `f`.
+
+    \returns  The fastest time, in seconds, of the `runs` calls to `f`.
+ */
+template < class F >
+auto  best_time( F &&f, int runs = 5 ) -> double
+{
+    typedef std::chrono::steady_clock  clock_type;
+
+    double  best = 0.0;
+
+    for ( int i = 0 ; i < runs ; ++i )
+    {
+        auto const    start = clock_type::now();
+
+        f();
+
+        auto const    stop = clock_type::now();
+        double const  t = std::chrono::duration<double>( stop - start ).count();
+
+        if ( !i || t < best )
+            best = t;
+    }
+    return best;
+}
+
+
+//  Reporting functions  -----------------------------------------------------//
+
+/** \brief  Print a per-operation time
+
+    \param label    What was timed.
+    \param seconds  The time taken.
+    \param ops      How many operations were done in that time.
+
+    \returns  The time per operation, in nanoseconds.
+ */
+inline
+auto  report( char const *label, double seconds, double ops ) -> double
+{
+    double const  ns = seconds * 1e9 / ops;
+
+    std::printf( "  %-44s %10.2f ns/op\n", label, ns );
+    return ns;
+}
+
+/** \brief  Print a throughput
+
+    \param label    What was timed.
+    \param seconds  The time taken.
+    \param bytes    How many bytes were read and written in that time.
+ */
+inline
+void  report_bandwidth( char const *label, double seconds, double bytes )
+{ std::printf( "  %-44s %10.2f GB/s\n", label, bytes / seconds * 1e-9 ); }
+
+/** \brief  Print how much faster one way is than another
+
+    \param label     What was compared.
+    \param baseline  The time per operation of the old way.
+    \param improved  The time per operation of the new way.
+ */
+inline
+void  report_speedup( char const *label, double baseline, double improved )
+{ std::printf( "  %-44s %10.2f x\n", label, baseline / improved ); }
+
+/** \brief  Print a checksum of the results
+
+    \param sum  The folded results.
+ */
+inline
+void  report_checksum( double sum )
+{ std::printf( "  (checksum %g)\n", sum ); }
+
+
+}  // namespace bench
+
+
+#endif // BOOST_MATH_COMPLEX_BENCH_HPP
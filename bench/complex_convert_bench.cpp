@@ -0,0 +1,115 @@
+//  Boost Complex Numbers, bulk conversion benchmark program file  -----------//
+
+//  Copyright 2013 Daryle Walker.
+//  Distributed under the Boost Software License, Version 1.0.  (See the
+//  accompanying file LICENSE_1_0.txt or a copy at
+//  <http://www.boost.org/LICENSE_1_0.txt>.)
+
+//  See <http://www.boost.org/libs/math/> for the library's home page.
+
+//  Times convert_range between complex_it and complex_rt arrays, on its memcpy
+//  path and on its per-element path, against per-element conversion calls.
+
+#include "complex_bench.hpp"
+
+#include "boost/math/complex.hpp"
+
+#include <cstddef>
+#include <cstdio>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+
+namespace
+{
+    using boost::math::complex_it;
+    using boost::math::complex_rt;
+
+    // Time each way over arrays of one rank, in both directions
+    template < std::size_t R >
+    void  run( std::mt19937 &engine )
+    {
+        typedef complex_it<double, R>  it_type;
+        typedef complex_rt<double, R>  rt_type;
+
+        static_assert( boost::math::detail::is_bitwise_convertible<it_type,
+         rt_type>::value, "the fast path should apply" );
+
+        std::size_t const  count = ( std::size_t(1) << 21 ) >> R;
+        int const          passes = 4;
+
+        std::uniform_real_distribution<double>  d( -1.0, 1.0 );
+        std::vector<it_type>  a( count ), c( count );
+        std::vector<rt_type>  b( count );
+
+        for ( std::size_t i = 0u ; i < count ; ++i )
+            for ( std::size_t k = 0u ; k < it_type::static_size ; ++k )
+                a[ i ][ k ] = d( engine );
+
+        auto const  first = a.data(), last = a.data() + count;
+
+        double const  t_block = bench::best_time( [&]{
+            for ( int pass = 0 ; pass < passes ; ++pass )
+            {
+                boost::math::convert_range( first, last, b.data() );
+                boost::math::convert_range( b.data(), b.data() + count,
+                 c.data() );
+            }
+        } );
+        double const  t_loop = bench::best_time( [&]{
+            for ( int pass = 0 ; pass < passes ; ++pass )
+            {
+                boost::math::detail::convert_range( first, last, b.data(),
+                 std::false_type{} );
+                boost::math::detail::convert_range( b.data(), b.data() +
+                 count, c.data(), std::false_type{} );
+            }
+        } );
+        double const  t_each = bench::best_time( [&]{
+            for ( int pass = 0 ; pass < passes ; ++pass )
+            {
+                for ( std::size_t i = 0u ; i < count ; ++i )
+                    b[ i ] = rt_type( a[i] );
+                for ( std::size_t i = 0u ; i < count ; ++i )
+                    c[ i ] = static_cast<it_type>( b[i] );
+            }
+        } );
+
+        // Zero when the round trip is exact
+        double  sum = 0.0;
+
+        for ( std::size_t i = 0u ; i < count ; ++i )
+            for ( std::size_t k = 0u ; k < it_type::static_size ; ++k )
+                sum += a[ i ][ k ] - c[ i ][ k ];
+
+        // Each direction reads and writes every element once
+        double const  bytes = 4.0 * count * sizeof( it_type ) * passes;
+
+        std::printf( "complex_it<double, %u> <-> complex_rt<double, %u>, %u "
+         "elements\n", unsigned(R), unsigned(R), unsigned(count) );
+        bench::report_bandwidth( "convert_range, memcpy path", t_block,
+         bytes );
+        bench::report_bandwidth( "convert_range, per-element path", t_loop,
+         bytes );
+        bench::report_bandwidth( "conversion constructor per element", t_each,
+         bytes );
+
+        bench::report_speedup( "memcpy path vs per-element path", t_loop,
+         t_block );
+        bench::report_speedup( "memcpy path vs constructors", t_each, t_block
+         );
+        bench::report_checksum( sum );
+    }
+
+}
+
+
+int  main()
+{
+    std::mt19937  engine( 20131u );
+
+    run<1u>( engine );
+    run<2u>( engine );
+    run<3u>( engine );
+}
@@ -0,0 +1,154 @@
+//  Boost Complex Numbers, Cayley product kernel benchmark program file  -----//
+
+//  Copyright 2013 Daryle Walker.
+//  Distributed under the Boost Software License, Version 1.0.  (See the
+//  accompanying file LICENSE_1_0.txt or a copy at
+//  <http://www.boost.org/LICENSE_1_0.txt>.)
+
+//  See <http://www.boost.org/libs/math/> for the library's home page.
+
+//  Times complex_it multiplication, which uses the compile-time product kernel,
+//  against the older run-time recursion that dispatched through std::function.
+
+#include "complex_bench.hpp"
+
+#include "boost/math/complex_it.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <functional>
+#include <random>
+#include <vector>
+
+
+namespace
+{
+    using boost::math::complex_it;
+
+    // The product recursion as it was before the compile-time kernel, with
+    // the ranks and flags as run-time arguments.
+    template < typename As, typename Md, typename Mr >
+    void  old_cayley_product( As *augend_sum, bool do_subtract,
+     Md const *multiplicand, std::size_t rank_md, bool conjugate_md,
+     Mr const *  multiplier, std::size_t rank_mr, bool conjugate_mr )
+    {
+        using std::size_t;
+
+        std::function<void(As*, Md const*, Mr const*)>  action[] = {
+            []( As *as, Md const *md, Mr const *mr ) -> void  // add
+             { *as += *md * *mr; },
+            []( As *as, Md const *md, Mr const *mr ) -> void  // subtract
+             { *as -= *md * *mr; }
+        };
+        size_t const  md_length = 1ULL << rank_md, mr_length = 1ULL << rank_mr;
+        auto const    as_length = std::max( md_length, mr_length );
+
+        if ( !rank_md && !rank_mr )
+            action[ do_subtract ]( augend_sum, multiplicand, multiplier );
+        else if ( !rank_md )
+            for ( size_t i = 0u ; i < mr_length ; ++i )
+                action[ do_subtract != (conjugate_mr && i) ]( augend_sum++,
+                 multiplicand, multiplier++ );
+        else if ( !rank_mr )
+            for ( size_t i = 0u ; i < md_length ; ++i )
+                action[ do_subtract != (conjugate_md && i) ]( augend_sum++,
+                 multiplicand++, multiplier );
+        else if ( rank_md < rank_mr )
+        {
+            old_cayley_product( augend_sum, do_subtract, multiplicand, rank_md,
+             conjugate_md, multiplier, rank_mr - 1u, conjugate_mr );
+            old_cayley_product( augend_sum + as_length / 2u, do_subtract !=
+             conjugate_mr, multiplier + mr_length / 2u, rank_mr - 1u, false,
+             multiplicand, rank_md, conjugate_md );
+        }
+        else if ( rank_md > rank_mr )
+        {
+            old_cayley_product( augend_sum, do_subtract, multiplicand, rank_md -
+             1u, conjugate_md, multiplier, rank_mr, conjugate_mr );
+            old_cayley_product( augend_sum + as_length / 2u, do_subtract !=
+             conjugate_md, multiplicand + md_length / 2u, rank_md - 1u, false,
+             multiplier, rank_mr, !conjugate_mr );
+        }
+        else
+        {
+            old_cayley_product( augend_sum, do_subtract, multiplicand, rank_md -
+             1u, conjugate_md, multiplier, rank_mr - 1u, conjugate_mr );
+            old_cayley_product( augend_sum, !do_subtract != (conjugate_mr !=
+             conjugate_md), multiplier + mr_length / 2u, rank_mr - 1u, true,
+             multiplicand + md_length / 2u, rank_md - 1u, false );
+            old_cayley_product( augend_sum + as_length / 2u, do_subtract !=
+             conjugate_mr, multiplier + mr_length / 2u, rank_mr - 1u, false,
+             multiplicand, rank_md - 1u, conjugate_md );
+            old_cayley_product( augend_sum + as_length / 2u, do_subtract !=
+             conjugate_md, multiplicand + md_length / 2u, rank_md - 1u, false,
+             multiplier, rank_mr - 1u, !conjugate_mr );
+        }
+    }
+
+    // Time both ways over arrays of one rank
+    template < std::size_t R >
+    void  run( std::mt19937 &engine )
+    {
+        typedef complex_it<double, R>  value_type;
+
+        std::size_t const  count = 4096u;
+        int const          passes = 64;
+
+        std::uniform_real_distribution<double>  d( -1.0, 1.0 );
+        std::vector<value_type>  a( count ), b( count ), p( count ), q( count );
+
+        for ( std::size_t i = 0u ; i < count ; ++i )
+            for ( std::size_t k = 0u ; k < value_type::static_size ; ++k )
+            {
+                a[ i ][ k ] = d( engine );
+                b[ i ][ k ] = d( engine );
+            }
+
+        double const  t_new = bench::best_time( [&]{
+            for ( int pass = 0 ; pass < passes ; ++pass )
+                for ( std::size_t i = 0u ; i < count ; ++i )
+                    p[ i ] = a[ i ] * b[ i ];
+        } );
+        double const  t_old = bench::best_time( [&]{
+            for ( int pass = 0 ; pass < passes ; ++pass )
+                for ( std::size_t i = 0u ; i < count ; ++i )
+                {
+                    q[ i ] = value_type{};
+                    old_cayley_product( &q[i][0], false, &a[i][0], R, false,
+                     &b[i][0], R, false );
+                }
+        } );
+
+        // Zero when both ways agree
+        double  sum = 0.0;
+
+        for ( std::size_t i = 0u ; i < count ; ++i )
+            for ( std::size_t k = 0u ; k < value_type::static_size ; ++k )
+                sum += p[ i ][ k ] - q[ i ][ k ];
+
+        double const  ops = double( count ) * passes;
+
+        std::printf( "complex_it<double, %u> multiplication\n", unsigned(R) );
+
+        double const  ns_new = bench::report( "compile-time kernel", t_new,
+         ops );
+        double const  ns_old = bench::report( "std::function recursion", t_old,
+         ops );
+
+        bench::report_speedup( "speedup", ns_old, ns_new );
+        bench::report_checksum( sum );
+    }
+
+}
+
+
+int  main()
+{
+    std::mt19937  engine( 20131u );
+
+    run<1u>( engine );
+    run<2u>( engine );
+    run<3u>( engine );
+    run<4u>( engine );
+}
@@ -0,0 +1,135 @@
+//  Boost Complex Numbers, reduced multiplication benchmark program file  ----//
+
+//  Copyright 2013 Daryle Walker.
+//  Distributed under the Boost Software License, Version 1.0.  (See the
+//  accompanying file LICENSE_1_0.txt or a copy at
+//  <http://www.boost.org/LICENSE_1_0.txt>.)
+
+//  See <http://www.boost.org/libs/math/> for the library's home page.
+
+//  Times complex_it multiplication of multi-precision integers with and without
+//  the Gauss and Howell-Lafon kernels picked by use_reduced_multiplication.
+
+#include "complex_bench.hpp"
+
+#include "boost/math/complex_it.hpp"
+
+#include <boost/multiprecision/cpp_int.hpp>
+#include <boost/random/independent_bits.hpp>
+#include <boost/random/mersenne_twister.hpp>
+
+#include <cstddef>
+#include <cstdio>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+
+namespace
+{
+    namespace mp = boost::multiprecision;
+
+    // An allocator that only exists to give a second, otherwise identical,
+    // cpp_int type that can be flagged for reduced multiplication.
+    template < typename T >
+    struct twin_allocator
+        : std::allocator<T>
+    {
+        template < typename U >
+        struct rebind  { typedef twin_allocator<U>  other; };
+
+        twin_allocator() = default;
+        template < typename U >
+        twin_allocator( twin_allocator<U> const & )  {}
+    };
+
+    typedef mp::cpp_int                                         full_type;
+    typedef mp::number<mp::cpp_int_backend<0, 0, mp::signed_magnitude,
+     mp::unchecked, twin_allocator<mp::limb_type>>>             reduced_type;
+
+}
+
+namespace boost
+{
+namespace math
+{
+    template < >
+    struct use_reduced_multiplication< reduced_type >
+        : std::true_type
+    { };
+}
+}
+
+namespace
+{
+    using boost::math::complex_it;
+
+    // Time both ways over arrays of one rank and component size
+    template < std::size_t R, unsigned Bits >
+    void  run( boost::random::mt19937 &engine )
+    {
+        typedef complex_it<full_type, R>     full_value;
+        typedef complex_it<reduced_type, R>  reduced_value;
+
+        std::size_t const  count = 256u;
+        int const          passes = 8;
+
+        boost::random::independent_bits_engine<boost::random::mt19937, Bits,
+         full_type>  d( engine );
+        std::vector<full_value>     a( count ), b( count ), p( count );
+        std::vector<reduced_value>  c( count ), e( count ), q( count );
+
+        for ( std::size_t i = 0u ; i < count ; ++i )
+            for ( std::size_t k = 0u ; k < full_value::static_size ; ++k )
+            {
+                a[ i ][ k ] = d() - ( full_type(1) << (Bits - 1u) );
+                b[ i ][ k ] = d() - ( full_type(1) << (Bits - 1u) );
+                c[ i ][ k ] = reduced_type( a[i][k] );
+                e[ i ][ k ] = reduced_type( b[i][k] );
+            }
+
+        double const  t_full = bench::best_time( [&]{
+            for ( int pass = 0 ; pass < passes ; ++pass )
+                for ( std::size_t i = 0u ; i < count ; ++i )
+                    p[ i ] = a[ i ] * b[ i ];
+        } );
+        double const  t_reduced = bench::best_time( [&]{
+            for ( int pass = 0 ; pass < passes ; ++pass )
+                for ( std::size_t i = 0u ; i < count ; ++i )
+                    q[ i ] = c[ i ] * e[ i ];
+        } );
+
+        // Zero when both ways agree
+        double  sum = 0.0;
+
+        for ( std::size_t i = 0u ; i < count ; ++i )
+            for ( std::size_t k = 0u ; k < full_value::static_size ; ++k )
+                sum += static_cast<double>( p[i][k] - full_type(q[ i ][ k ]) );
+
+        double const  ops = double( count ) * passes;
+
+        std::printf( "complex_it<cpp_int, %u> multiplication, %u-bit "
+         "components\n", unsigned(R), Bits );
+
+        double const  ns_full = bench::report( "full product", t_full, ops );
+        double const  ns_reduced = bench::report( "reduced product", t_reduced,
+         ops );
+
+        bench::report_speedup( "speedup", ns_full, ns_reduced );
+        bench::report_checksum( sum );
+    }
+
+}
+
+
+int  main()
+{
+    boost::random::mt19937  engine( 20131u );
+
+    run<1u, 256u>( engine );
+    run<2u, 256u>( engine );
+    run<3u, 256u>( engine );
+    run<1u, 4096u>( engine );
+    run<2u, 4096u>( engine );
+    run<3u, 4096u>( engine );
+}
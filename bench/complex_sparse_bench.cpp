@@ -0,0 +1,129 @@
+//  Boost Complex Numbers, sparse multiplication benchmark program file  -----//
+
+//  Copyright 2013 Daryle Walker.
+//  Distributed under the Boost Software License, Version 1.0.  (See the
+//  accompanying file LICENSE_1_0.txt or a copy at
+//  <http://www.boost.org/LICENSE_1_0.txt>.)
+
+//  See <http://www.boost.org/libs/math/> for the library's home page.
+
+//  Times sparse_complex multiplication at several fill ratios, against dense
+//  complex_it multiplication of the same values.
+
+#include "complex_bench.hpp"
+
+#include "boost/math/complex_sparse.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <numeric>
+#include <random>
+#include <vector>
+
+
+namespace
+{
+    using boost::math::complex_it;
+    using boost::math::sparse_complex;
+
+    // A value with exactly `fill` non-zero components at random places, with
+    // small integer values so every product is exact
+    template < std::size_t R >
+    auto  random_sparse( std::mt19937 &engine, std::size_t fill )
+     -> sparse_complex<double, R>
+    {
+        std::vector<std::size_t>            indices( std::size_t(1) << R );
+        std::uniform_int_distribution<int>  value( 1, 9 );
+        std::bernoulli_distribution         negative;
+        sparse_complex<double, R>           result;
+
+        std::iota( indices.begin(), indices.end(), std::size_t(0) );
+        std::shuffle( indices.begin(), indices.end(), engine );
+        for ( std::size_t k = 0u ; k < fill ; ++k )
+            result.set( indices[k], negative(engine) ? -value(engine) :
+             value(engine) );
+        return result;
+    }
+
+    // Time both ways over arrays of one rank and fill
+    template < std::size_t R >
+    void  run_fill( std::mt19937 &engine, std::size_t fill )
+    {
+        typedef sparse_complex<double, R>  sparse_type;
+        typedef complex_it<double, R>      dense_type;
+
+        std::size_t const  count = 64u;
+        int const          passes = std::max( 1, 4096 >> R );
+
+        std::vector<sparse_type>  a( count ), b( count ), p( count );
+        std::vector<dense_type>   c( count ), e( count ), q( count );
+
+        for ( std::size_t i = 0u ; i < count ; ++i )
+        {
+            a[ i ] = random_sparse<R>( engine, fill );
+            b[ i ] = random_sparse<R>( engine, fill );
+            c[ i ] = static_cast<dense_type>( a[i] );
+            e[ i ] = static_cast<dense_type>( b[i] );
+        }
+
+        double const  t_sparse = bench::best_time( [&]{
+            for ( int pass = 0 ; pass < passes ; ++pass )
+                for ( std::size_t i = 0u ; i < count ; ++i )
+                    p[ i ] = a[ i ] * b[ i ];
+        } );
+        double const  t_dense = bench::best_time( [&]{
+            for ( int pass = 0 ; pass < passes ; ++pass )
+                for ( std::size_t i = 0u ; i < count ; ++i )
+                    q[ i ] = c[ i ] * e[ i ];
+        } );
+
+        // Zero when both ways agree
+        double  sum = 0.0;
+
+        for ( std::size_t i = 0u ; i < count ; ++i )
+        {
+            dense_type const  pp = static_cast<dense_type>( p[i] );
+
+            for ( std::size_t k = 0u ; k < dense_type::static_size ; ++k )
+                sum += pp[ k ] - q[ i ][ k ];
+        }
+
+        double const  ops = double( count ) * passes;
+
+        std::printf( "  %u of %u components non-zero\n", unsigned(fill),
+         unsigned(dense_type::static_size) );
+
+        double const  ns_sparse = bench::report( "sparse_complex", t_sparse,
+         ops );
+        double const  ns_dense = bench::report( "complex_it", t_dense, ops );
+
+        bench::report_speedup( "sparse speedup", ns_dense, ns_sparse );
+        bench::report_checksum( sum );
+    }
+
+    // Fills from one non-zero up to all of them, in powers of four
+    template < std::size_t R >
+    void  run( std::mt19937 &engine )
+    {
+        std::size_t const  size = std::size_t( 1 ) << R;
+
+        std::printf( "rank %u, %u components, multiplication\n", unsigned(R),
+         unsigned(size) );
+        for ( std::size_t fill = 1u ; fill < size / 2u ; fill *= 4u )
+            run_fill<R>( engine, fill );
+        run_fill<R>( engine, size / 2u );
+        run_fill<R>( engine, size );
+    }
+
+}
+
+
+int  main()
+{
+    std::mt19937  engine( 20131u );
+
+    run<5u>( engine );
+    run<6u>( engine );
+    run<8u>( engine );
+}
@@ -0,0 +1,98 @@
+//  Boost Complex Numbers, lane transposition benchmark program file  --------//
+
+//  Copyright 2013 Daryle Walker.
+//  Distributed under the Boost Software License, Version 1.0.  (See the
+//  accompanying file LICENSE_1_0.txt or a copy at
+//  <http://www.boost.org/LICENSE_1_0.txt>.)
+
+//  See <http://www.boost.org/libs/math/> for the library's home page.
+
+//  Measures the throughput of split_lanes and merge_lanes, next to a plain
+//  memcpy of the same number of bytes as the bandwidth ceiling.
+
+#include "complex_bench.hpp"
+
+#include "boost/math/complex_soa.hpp"
+
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+
+
+namespace
+{
+    using boost::math::complex_it;
+
+    // Time both directions for one component type and rank
+    template < typename T, std::size_t R >
+    void  run( std::mt19937 &engine, char const *name )
+    {
+        typedef complex_it<T, R>  value_type;
+
+        std::size_t const  size = value_type::static_size;
+        std::size_t const  count = ( std::size_t(1) << 22 ) / size;
+        int const          passes = 4;
+
+        std::uniform_real_distribution<T>  d( -1, 1 );
+        std::vector<value_type>            a( count ), b( count );
+        std::vector<std::vector<T>>        l( size, std::vector<T>(count) );
+        std::vector<T *>                   lanes( size );
+        std::vector<T const *>             const_lanes( size );
+
+        for ( std::size_t k = 0u ; k < size ; ++k )
+            const_lanes[ k ] = lanes[ k ] = l[ k ].data();
+        for ( std::size_t i = 0u ; i < count ; ++i )
+            for ( std::size_t k = 0u ; k < size ; ++k )
+                a[ i ][ k ] = d( engine );
+
+        double const  t_split = bench::best_time( [&]{
+            for ( int pass = 0 ; pass < passes ; ++pass )
+                boost::math::split_lanes( a.data(), a.data() + count,
+                 lanes.data() );
+        } );
+        double const  t_merge = bench::best_time( [&]{
+            for ( int pass = 0 ; pass < passes ; ++pass )
+                boost::math::merge_lanes( const_lanes.data(), count,
+                 b.data() );
+        } );
+        double const  t_copy = bench::best_time( [&]{
+            for ( int pass = 0 ; pass < passes ; ++pass )
+                std::memcpy( static_cast<void *>(b.data()), a.data(), count *
+                 sizeof(value_type) );
+        } );
+
+        // Zero when the round trip is exact
+        double  sum = 0.0;
+
+        boost::math::merge_lanes( const_lanes.data(), count, b.data() );
+        for ( std::size_t i = 0u ; i < count ; ++i )
+            for ( std::size_t k = 0u ; k < size ; ++k )
+                sum += a[ i ][ k ] - b[ i ][ k ];
+
+        // Each pass reads and writes every component once
+        double const  bytes = 2.0 * count * sizeof( value_type ) * passes;
+
+        std::printf( "complex_it<%s, %u> transposition, %u elements\n", name,
+         unsigned(R), unsigned(count) );
+        bench::report_bandwidth( "split_lanes", t_split, bytes );
+        bench::report_bandwidth( "merge_lanes", t_merge, bytes );
+        bench::report_bandwidth( "memcpy", t_copy, bytes );
+        bench::report_checksum( sum );
+    }
+
+}
+
+
+int  main()
+{
+    std::mt19937  engine( 20131u );
+
+    run<float, 1u>( engine, "float" );
+    run<float, 2u>( engine, "float" );
+    run<float, 3u>( engine, "float" );
+    run<double, 1u>( engine, "double" );
+    run<double, 2u>( engine, "double" );
+    run<double, 3u>( engine, "double" );
+}
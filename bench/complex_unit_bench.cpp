@@ -0,0 +1,114 @@
+//  Boost Complex Numbers, basis unit benchmark program file  ----------------//
+
+//  Copyright 2013 Daryle Walker.
+//  Distributed under the Boost Software License, Version 1.0.  (See the
+//  accompanying file LICENSE_1_0.txt or a copy at
+//  <http://www.boost.org/LICENSE_1_0.txt>.)
+
+//  See <http://www.boost.org/libs/math/> for the library's home page.
+
+//  Times products with basis_unit tags, which only move and negate components,
+//  against full Cayley products with the same units stored as dense values.
+
+#include "complex_bench.hpp"
+
+#include "boost/math/complex_unit.hpp"
+
+#include <cstddef>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+
+namespace
+{
+    using boost::math::basis_unit;
+    using boost::math::complex_it;
+    using boost::math::complex_rt;
+
+    // Time both ways, on both sides, over arrays of one storage type
+    template < class Value, class Unit >
+    void  run_type( std::mt19937 &engine, char const *name )
+    {
+        std::size_t const  count = 4096u;
+        int const          passes = 64;
+
+        std::uniform_real_distribution<double>  d( -1.0, 1.0 );
+        std::vector<Value>  a( count ), p( count ), q( count ), s( count ),
+                            t( count );
+        Value const         e = Unit{};
+
+        for ( std::size_t i = 0u ; i < count ; ++i )
+            for ( std::size_t k = 0u ; k < Value::static_size ; ++k )
+                a[ i ][ k ] = d( engine );
+
+        double const  t_unit_right = bench::best_time( [&]{
+            for ( int pass = 0 ; pass < passes ; ++pass )
+                for ( std::size_t i = 0u ; i < count ; ++i )
+                    p[ i ] = a[ i ] * Unit{};
+        } );
+        double const  t_full_right = bench::best_time( [&]{
+            for ( int pass = 0 ; pass < passes ; ++pass )
+                for ( std::size_t i = 0u ; i < count ; ++i )
+                    q[ i ] = a[ i ] * e;
+        } );
+        double const  t_unit_left = bench::best_time( [&]{
+            for ( int pass = 0 ; pass < passes ; ++pass )
+                for ( std::size_t i = 0u ; i < count ; ++i )
+                    s[ i ] = Unit{} * a[ i ];
+        } );
+        double const  t_full_left = bench::best_time( [&]{
+            for ( int pass = 0 ; pass < passes ; ++pass )
+                for ( std::size_t i = 0u ; i < count ; ++i )
+                    t[ i ] = e * a[ i ];
+        } );
+
+        // Zero when both ways agree
+        double  sum = 0.0;
+
+        for ( std::size_t i = 0u ; i < count ; ++i )
+            for ( std::size_t k = 0u ; k < Value::static_size ; ++k )
+                sum += ( p[i][k] - q[i][k] ) + ( s[i][k] - t[i][k] );
+
+        double const  ops = double( count ) * passes;
+
+        std::printf( "%s<double, %u> times e_%u\n", name,
+         unsigned(Value::rank), unsigned(Unit::index) );
+
+        double const  ns_unit_right = bench::report( "x * basis_unit",
+         t_unit_right, ops );
+        double const  ns_full_right = bench::report( "x * full value",
+         t_full_right, ops );
+        double const  ns_unit_left = bench::report( "basis_unit * x",
+         t_unit_left, ops );
+        double const  ns_full_left = bench::report( "full value * x",
+         t_full_left, ops );
+
+        bench::report_speedup( "speedup, right", ns_full_right,
+         ns_unit_right );
+        bench::report_speedup( "speedup, left", ns_full_left, ns_unit_left );
+        bench::report_checksum( sum );
+    }
+
+    // The highest unit of a rank, for each storage type
+    template < std::size_t R >
+    void  run( std::mt19937 &engine )
+    {
+        typedef basis_unit<(1u << R) - 1u, R>  unit_type;
+
+        run_type<complex_it<double, R>, unit_type>( engine, "complex_it" );
+        run_type<complex_rt<double, R>, unit_type>( engine, "complex_rt" );
+    }
+
+}
+
+
+int  main()
+{
+    std::mt19937  engine( 20131u );
+
+    run<1u>( engine );
+    run<2u>( engine );
+    run<3u>( engine );
+    run<4u>( engine );
+}
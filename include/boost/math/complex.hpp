@@ -27,6 +27,12 @@
 #define BOOST_MATH_COMPLEX_HPP
 
 #include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <utility>
 
 #include "boost/math/complex_it.hpp"
 #include "boost/math/complex_rt.hpp"
@@ -34,26 +40,36 @@
 #include <boost/math/quaternion.hpp>
 
 
-// Flag to check if complex-number implmentations are packed
-#if 0
-#define BOOST_MATH_COMPLEX_IS_PACKED  1
+// Flag to check if batch operations dispatch to vector-extension kernels
+#if !defined(BOOST_MATH_COMPLEX_NO_SIMD) && defined(__GNUC__) && (defined(    \
+ __x86_64__) || defined(__i386__))
+#define BOOST_MATH_COMPLEX_SIMD_DISPATCH  1
 #else
-#define BOOST_MATH_COMPLEX_IS_PACKED  0
+#define BOOST_MATH_COMPLEX_SIMD_DISPATCH  0
 #endif
-/** \def  BOOST_MATH_COMPLEX_IS_PACKED
-    \brief  Flag for packed implementations on complex numbers.
+/** \def  BOOST_MATH_COMPLEX_SIMD_DISPATCH
+    \brief  Flag for run-time selection of vector-extension batch kernels.
 
-    If this pre-processor flag is set to non-zero, then the implmentations of
-    #boost::math::complex_rt and #boost::math::complex_it don't have any padding
-    at the beginning, middle, or end of their structures.  This means that:
+    If this pre-processor flag is set to non-zero, then the batch operations
+    acting on contiguous arrays of `complex_it<float, R>` or
+    `complex_it<double, R>`, with 1 \<= `R` \<= 3, run their loops in a version
+    compiled for the best vector extension the processor supports (SSE4.2, AVX2
+    with FMA, or AVX-512), as determined once by `cpuid` at first use.
+    Addition, subtraction, scaling, the norm, and the Cayley multiplication,
+    conjugate multiplication and division (right and left) use explicitly
+    vectorized kernels there.  Each value is held in 16-, 32- or 64-byte
+    registers, and each Cayley product is a sum of broadcast components times
+    lane-shuffled, sign-flipped copies of the other factor.  (Kernels need at
+    least 16 bytes per value, so `complex_it<float, 1>` stays scalar.)  The
+    other batch operations run their plain loops in that version.  Otherwise,
+    or for other types, the loops are compiled for the base instruction set
+    only.
 
-    - `sizeof( complex_?t<T, R> ) == ( sizeof(T) << R )`
-    - Given a `complex_?t<T, R>` object `x`, you can find a given component *i*
-      with `reintepret_cast< T(&)[1 << R] >( x )[ i ]`.  (This property is always
-      true with `complex_it<T, ?>` when `T` is standard-layout.)
-    - Given an array segment of `complex_?t<T, R>` objects starting at *p*, you
-      can find component *i* of element *n* with `reinterpret_cast<T *>( p )[ (n
-      << R) + i ]`.
+    The kernels sum the terms of each product in a different order than the
+    operators do, so floating-point results may differ in rounding.
+
+    The flag is set automatically for GCC-compatible compilers targeting x86.
+    Define `BOOST_MATH_COMPLEX_NO_SIMD` before inclusion to turn it off.
  */
 
 
@@ -65,7 +81,1350 @@ namespace math
 {
 
 
-// Put stuff here.
+//  Layout traits  -----------------------------------------------------------//
+
+/** \brief  Checks if a hypercomplex type is laid out as a flat component array
+
+For a `complex_it<T, R>` or `complex_rt<T, R>` type `X`, the value is `true`
+when `X` is standard-layout and has no padding (see
+#boost::math::complex_it::has_padding).  Then:
+
+- `sizeof( X ) == ( sizeof(T) << R )`
+- Given an `X` object `x`, component *i* is `reinterpret_cast<T *>( &x )[ i ]`.
+- Given an array segment of `X` objects starting at *p*, component *i* of
+  element *n* is `reinterpret_cast<T *>( p )[ (n << R) + i ]`.
+
+So arrays of such types can be used as flat scalar buffers (see
+#boost::math::as_scalars), and the bulk functions use that when they can.  For
+other types, the value is `false`.
+
+    \tparam X  The type to check.
+ */
+template < class X >
+struct is_packed
+    : std::false_type
+{ };
+
+//! \overload
+template < typename T, std::size_t R >
+struct is_packed< complex_it<T, R> >
+    : std::integral_constant< bool, std::is_standard_layout<complex_it<T,
+       R>>::value && !complex_it<T, R>::has_padding >
+{ };
+
+//! \overload
+template < typename T, std::size_t R >
+struct is_packed< complex_rt<T, R> >
+    : std::integral_constant< bool, std::is_standard_layout<complex_rt<T,
+       R>>::value && !complex_rt<T, R>::has_padding >
+{ };
+
+//! \overload
+template < class X >
+struct is_packed< X const >
+    : is_packed< X >
+{ };
+
+/** \brief  Reinterpret an array segment of hypercomplex numbers as scalars
+
+    \pre  `X` is a `complex_it` or `complex_rt` type, with
+          #boost::math::is_packed true.
+    \pre  [`first`, `last`) is a valid range.
+
+    \param[in] first  The start of the hypercomplex numbers.
+    \param[in] last   The end of the hypercomplex numbers.
+
+    \returns  The start and end of the same storage, as an array segment of the
+              components, element by element.
+ */
+template < class X >
+inline
+auto  as_scalars( X *first, X *last ) noexcept
+ -> typename std::enable_if< is_packed<X>::value, std::pair<typename
+ std::conditional<std::is_const<X>::value, typename X::value_type const,
+ typename X::value_type>::type *, typename std::conditional<std::is_const<
+ X>::value, typename X::value_type const, typename X::value_type>::type *>
+ >::type
+{
+    typedef typename std::conditional<std::is_const<X>::value, typename
+     X::value_type const, typename X::value_type>::type  scalar_type;
+
+    return { reinterpret_cast<scalar_type *>(first),
+     reinterpret_cast<scalar_type *>(last) };
+}
+
+
+//  Implementation details  --------------------------------------------------//
+
+//! \cond
+namespace detail
+{
+    //! Checks if the component type has vector-extension batch kernels.
+    template < typename T >
+    struct is_simd_component
+        : std::integral_constant< bool, std::is_same<T, float>::value ||
+           std::is_same<T, double>::value >
+    { };
+
+    //! Checks if an iterator points to contiguous vector-friendly elements.
+    template < typename It >
+    struct is_simd_batch_iterator
+        : std::false_type
+    { };
+
+    //! \overload
+    template < typename T, std::size_t R >
+    struct is_simd_batch_iterator< complex_it<T, R> * >
+        : std::integral_constant< bool, is_simd_component<T>::value && (R >= 1u)
+           && (R <= 3u) && is_packed<complex_it<T, R>>::value >
+    { };
+
+    //! \overload
+    template < typename T, std::size_t R >
+    struct is_simd_batch_iterator< complex_it<T, R> const * >
+        : is_simd_batch_iterator< complex_it<T, R> * >
+    { };
+
+    //! The levels of vector extensions the batch kernels are compiled for.
+    enum simd_level
+    {
+        simd_baseline,
+        simd_sse42,
+        simd_avx2,
+        simd_avx512
+    };
+
+    //! Determine, once, the best vector extension the processor supports.
+    inline
+    auto  detected_simd_level() -> simd_level
+    {
+#if BOOST_MATH_COMPLEX_SIMD_DISPATCH
+        static simd_level const  level = []() -> simd_level {
+            __builtin_cpu_init();
+            return __builtin_cpu_supports( "avx512f" ) ? simd_avx512 :
+             ( __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma") )
+             ? simd_avx2 : __builtin_cpu_supports( "sse4.2" ) ? simd_sse42 :
+             simd_baseline;
+        }();
+
+        return level;
+#else
+        return simd_baseline;
+#endif
+    }
+
+    // Element-wise operation objects
+    struct batch_plus
+    {
+        template < typename T, typename U >
+        auto  operator ()( T const &a, U const &b ) const -> decltype( a + b )
+        { return a + b; }
+    };
+
+    struct batch_minus
+    {
+        template < typename T, typename U >
+        auto  operator ()( T const &a, U const &b ) const -> decltype( a - b )
+        { return a - b; }
+    };
+
+    struct batch_multiplies
+    {
+        template < typename T, typename U >
+        auto  operator ()( T const &a, U const &b ) const -> decltype( a * b )
+        { return a * b; }
+    };
+
+    struct batch_conj_multiplies
+    {
+        template < typename T, std::size_t R, typename U, std::size_t S >
+        auto  operator ()( complex_it<T, R> const &a, complex_it<U, S> const
+         &b ) const -> decltype( a * b )
+        {
+            decltype( a * b )  product{};
+
+            add_cayley_product<false, R, true, S, false>( &product[0], &a[0],
+             &b[0] );
+            return product;
+        }
+    };
+
+    struct batch_divides
+    {
+        template < typename T, typename U >
+        auto  operator ()( T const &a, U const &b ) const -> decltype( a / b )
+        { return a / b; }
+    };
+
+    struct batch_left_divides
+    {
+        template < typename T, typename U >
+        auto  operator ()( T const &a, U const &b ) const
+         -> decltype( left_divide(a, b) )
+        { return left_divide( a, b ); }
+    };
+
+    template < typename Scalar >
+    struct batch_scales
+    {
+        Scalar  scalar;
+
+        template < typename T >
+        auto  operator ()( T const &a ) const -> decltype( a * scalar )
+        { return a * scalar; }
+    };
+
+    struct batch_norms
+    {
+        template < typename T >
+        auto  operator ()( T const &a ) const -> decltype( norm(a) )
+        { return norm( a ); }
+    };
+
+    struct batch_inverses
+    {
+        template < typename T >
+        auto  operator ()( T const &a ) const -> decltype( inverse(a) )
+        { return inverse( a ); }
+    };
+
+    struct batch_approximate_inverses
+    {
+        template < typename T >
+        auto  operator ()( T const &a ) const
+         -> decltype( approximate_inverse(a) )
+        { return approximate_inverse( a ); }
+    };
+
+    struct batch_squares
+    {
+        template < typename T >
+        auto  operator ()( T const &a ) const -> decltype( square(a) )
+        { return square( a ); }
+    };
+
+    template < typename Integer >
+    struct batch_powers
+    {
+        Integer  exponent;
+
+        template < typename T >
+        auto  operator ()( T const &a ) const -> decltype( pow(a, exponent) )
+        { return pow( a, exponent ); }
+    };
+
+    template < bool ConjugateMd, bool ConjugateMr >
+    struct batch_fma_assigns
+    {
+        template < typename A, typename T, typename U >
+        void  operator ()( A &acc, T const &a, U const &b ) const
+        { fma_assign<ConjugateMd, ConjugateMr>( acc, a, b ); }
+    };
+
+    template < bool ConjugateMd, bool ConjugateMr >
+    struct batch_fms_assigns
+    {
+        template < typename A, typename T, typename U >
+        void  operator ()( A &acc, T const &a, U const &b ) const
+        { fms_assign<ConjugateMd, ConjugateMr>( acc, a, b ); }
+    };
+
+    //! Checks if a batch operation has a vector kernel for array segments of
+    //! the given types, with registers the given number of bytes wide.
+    template < class Op, typename In1, typename In2, typename Out, std::size_t
+     Bytes >
+    struct has_simd_kernel
+        : std::false_type
+    { };
+
+    //! Checks if a batch operation has a unary vector kernel.
+    template < class Op, typename In, typename Out, std::size_t Bytes >
+    struct has_simd_unary_kernel
+        : std::false_type
+    { };
+
+#if BOOST_MATH_COMPLEX_SIMD_DISPATCH
+    // The kernel helpers take and give vectors by reference only; passing
+    // them by value from code not compiled for the target changes the ABI.
+    // (The helpers are always inlined into the per-target loops anyway.)
+
+    // How many components of a rank-R value to put in each register, which
+    // is the register's width, or the whole value when that's smaller
+    inline constexpr
+    auto  simd_lanes( std::size_t component_size, std::size_t rank, std::size_t
+     bytes ) noexcept -> std::size_t
+    {
+        return ( bytes / component_size < (std::size_t( 1u ) << rank) ) ? bytes
+         / component_size : std::size_t( 1u ) << rank;
+    }
+
+    // Whether a rank-R value of T can be split into registers of that width;
+    // there must be at least 16 bytes per register.
+    template < typename T, std::size_t R, std::size_t Bytes >
+    struct has_simd_layout
+        : std::integral_constant< bool, is_simd_component<T>::value && (R >= 1u)
+           && (R <= 3u) && (simd_lanes( sizeof(T), R, Bytes ) * sizeof( T ) >=
+           16u) >
+    { };
+
+    // Signed integers as wide as each component type, for sign masks
+    template < typename T >
+    struct simd_mask_component;
+
+    template < >
+    struct simd_mask_component< float >
+    { typedef std::int32_t  type; };
+
+    template < >
+    struct simd_mask_component< double >
+    { typedef std::int64_t  type; };
+
+    // Vector types of Lanes components of T, and of the matching masks
+    template < typename T, std::size_t Lanes >
+    struct simd_vector
+    {
+        typedef typename simd_mask_component<T>::type  mask_component;
+
+        typedef T               type
+         __attribute__(( vector_size(Lanes * sizeof(T)) ));
+        typedef mask_component  mask_type
+         __attribute__(( vector_size(Lanes * sizeof(T)) ));
+    };
+
+    // Whether lane M of the term Md[I] * Mr[I ^ M] of a Cayley product is
+    // subtracted, with either factor maybe conjugated
+    inline constexpr
+    auto  simd_term_negated( std::size_t rank, bool conjugate_md, bool
+     conjugate_mr, std::size_t i, std::size_t m ) noexcept -> bool
+    {
+        return ( (basis_product_sign( rank, i, i ^ m ) < 0) != (conjugate_md
+         && i) ) != ( conjugate_mr && (i ^ m) );
+    }
+
+    // Set every lane to the given value
+    template < class V, typename T, std::size_t ...L >
+    inline __attribute__(( always_inline ))
+    void  simd_splat( V &result, T s, index_list<L...> )
+    { result = V{ ((void)L, s)... }; }
+
+    // Lane M of the result is lane M ^ K of the source
+    template < std::size_t K, class M, class V, std::size_t ...L >
+    inline __attribute__(( always_inline ))
+    void  simd_swap( V &result, V const &v, index_list<L...> )
+    {
+#if defined(__clang__)
+        result = __builtin_shufflevector( v, v, (L ^ K)... );
+#else
+        result = __builtin_shuffle( v, M{ (L ^ K)... } );
+#endif
+    }
+
+    // Negate the lanes whose mask has the sign bit set
+    template < class V, class M >
+    inline __attribute__(( always_inline ))
+    void  simd_flip( V &v, M const &mask )
+    { v = (V)( (M)v ^ mask ); }
+
+    // Add the lanes of one register, halving the width each step
+    template < class M, class V, std::size_t ...L >
+    inline __attribute__(( always_inline ))
+    auto  simd_lane_sum( V const &v, index_list<L...>, std::integral_constant<
+     std::size_t, 0u> ) -> decltype( v[0] + v[0] )
+    { return v[ 0 ]; }
+
+    template < class M, class V, std::size_t ...L, std::size_t K >
+    inline __attribute__(( always_inline ))
+    auto  simd_lane_sum( V const &v, index_list<L...> lanes,
+     std::integral_constant<std::size_t, K> ) -> decltype( v[0] + v[0] )
+    {
+        V  w;
+
+        simd_swap<K, M>( w, v, lanes );
+        w += v;
+        return simd_lane_sum<M>( w, lanes, std::integral_constant<std::size_t,
+         K / 2u>{} );
+    }
+
+    // Sum += Md[I] * Mr[I ^ M] for each lane M of register G
+    template < typename T, std::size_t R, std::size_t W, bool ConjugateMd, bool
+     ConjugateMr, std::size_t I, std::size_t G, class V, std::size_t ...L >
+    inline __attribute__(( always_inline ))
+    void  simd_product_register( V *sum, V const *multiplier, V const
+     &multiplicand_component, index_list<L...> lanes )
+    {
+        typedef simd_vector<T, W>                   vector_type;
+        typedef typename vector_type::mask_type       mask_type;
+        typedef typename vector_type::mask_component  mask_component;
+
+        mask_component const  sign = std::numeric_limits<mask_component>::min();
+
+        V  md = multiplicand_component, mr;
+
+        simd_flip( md, mask_type{ (simd_term_negated( R, ConjugateMd,
+         ConjugateMr, I, G * W + L ) ? sign : mask_component( 0 ))... } );
+        simd_swap<I % W, mask_type>( mr, multiplier[G ^ (I / W)], lanes );
+        sum[ G ] += md * mr;
+    }
+
+    // Sum += Md[I] * Mr[I ^ M] for every component M
+    template < typename T, std::size_t R, std::size_t W, bool ConjugateMd, bool
+     ConjugateMr, std::size_t I, class V, std::size_t ...G >
+    inline __attribute__(( always_inline ))
+    void  simd_product_term( V *sum, V const *multiplier, T
+     multiplicand_component, index_list<G...> )
+    {
+        typedef make_index_list<W>  lanes;
+
+        V  s;
+
+        simd_splat( s, multiplicand_component, lanes{} );
+
+        int const  expand[] = { 0, (simd_product_register<T, R, W, ConjugateMd,
+         ConjugateMr, I, G>( sum, multiplier, s, lanes{} ), 0)... };
+
+        (void)expand;
+    }
+
+    // Product = Md * Mr, each rank R, maybe conjugated, W lanes per register
+    template < typename T, std::size_t R, std::size_t W, bool ConjugateMd, bool
+     ConjugateMr, std::size_t ...I >
+    inline __attribute__(( always_inline ))
+    void  simd_cayley_product( T *product, T const *multiplicand, T const
+     *multiplier, index_list<I...> )
+    {
+        typedef typename simd_vector<T, W>::type  vector_type;
+
+        constexpr std::size_t  count = sizeof...( I ) / W;
+
+        vector_type  mr[ count ], sum[ count ] = { };
+
+        std::memcpy( mr, multiplier, sizeof(mr) );
+
+        int const  expand[] = { 0, (simd_product_term<T, R, W, ConjugateMd,
+         ConjugateMr, I>( sum, mr, multiplicand[I], make_index_list<count>{} ),
+         0)... };
+
+        (void)expand;
+        std::memcpy( product, sum, sizeof(sum) );
+    }
+
+    // The norm of a rank-R value, W lanes per register
+    template < typename T, std::size_t R, std::size_t W >
+    inline __attribute__(( always_inline ))
+    auto  simd_norm( T const *x ) -> T
+    {
+        typedef simd_vector<T, W>               vector_type;
+        typedef typename vector_type::type       value_type;
+        typedef typename vector_type::mask_type  mask_type;
+
+        value_type  sum{};
+
+        for ( std::size_t g = 0u ; g < (1u << R) / W ; ++g )
+        {
+            value_type  v;
+
+            std::memcpy( &v, x + g * W, sizeof(v) );
+            sum += v * v;
+        }
+        return simd_lane_sum<mask_type>( sum, make_index_list<W>{},
+         std::integral_constant<std::size_t, W / 2u>{} );
+    }
+
+    // Quotient = Dividend * Conj(Divisor) / Norm(Divisor), or with the
+    // product's factors swapped when DivisorFirst.  Like scale_quotient, this
+    // fails (writing nothing) when the norm's reciprocal or a product
+    // component is out of the normal range, so the caller can fall back to the
+    // pre-scaled quotient of the division operators.
+    template < typename T, std::size_t R, std::size_t W, bool DivisorFirst >
+    inline __attribute__(( always_inline ))
+    auto  simd_cayley_quotient( T *quotient, T const *dividend, T const
+     *divisor ) -> bool
+    {
+        typedef simd_vector<T, W>                     vector_traits;
+        typedef typename vector_traits::type          vector_type;
+        typedef typename vector_traits::mask_type     mask_type;
+        typedef typename vector_traits::mask_component  mask_component;
+        typedef std::numeric_limits<T>                limits;
+
+        // The divisor may share storage with the quotient.
+        T const  scale = T( 1 ) / simd_norm<T, R, W>( divisor );
+        T        product[ 1u << R ];
+
+        if ( !(scale >= limits::min() && scale <= limits::max()) )
+            return false;
+        if ( DivisorFirst )
+            simd_cayley_product<T, R, W, true, false>( product, divisor,
+             dividend, make_index_list<(1u << R)>{} );
+        else
+            simd_cayley_product<T, R, W, false, true>( product, dividend,
+             divisor, make_index_list<(1u << R)>{} );
+
+        // A lane is bad if its magnitude is NaN, infinite, or subnormal.
+        vector_type  factor, top, bottom, zero{};
+        mask_type    magnitude_bits, bad{};
+
+        simd_splat( factor, scale, make_index_list<W>{} );
+        simd_splat( top, limits::max(), make_index_list<W>{} );
+        simd_splat( bottom, limits::min(), make_index_list<W>{} );
+        simd_splat( magnitude_bits, std::numeric_limits<mask_component>::max(),
+         make_index_list<W>{} );
+        for ( std::size_t g = 0u ; g < (1u << R) / W ; ++g )
+        {
+            vector_type  v;
+
+            std::memcpy( &v, product + g * W, sizeof(v) );
+
+            vector_type const  magnitude = (vector_type)( (mask_type)v &
+             magnitude_bits );
+
+            bad |= ~( (magnitude <= top) & ((magnitude >= bottom) | (magnitude
+             == zero)) );
+        }
+        for ( std::size_t l = 0u ; l < W ; ++l )
+            if ( bad[l] )
+                return false;
+
+        for ( std::size_t g = 0u ; g < (1u << R) / W ; ++g )
+        {
+            vector_type  v;
+
+            std::memcpy( &v, product + g * W, sizeof(v) );
+            v *= factor;
+            std::memcpy( quotient + g * W, &v, sizeof(v) );
+        }
+        return true;
+    }
+
+    // Result = Augend + Addend (or - Addend, when Subtract) lane-wise
+    template < typename T, std::size_t R, std::size_t W, bool Subtract >
+    inline __attribute__(( always_inline ))
+    void  simd_lane_wise( T *result, T const *augend, T const *addend )
+    {
+        typedef typename simd_vector<T, W>::type  vector_type;
+
+        for ( std::size_t g = 0u ; g < (1u << R) / W ; ++g )
+        {
+            vector_type  x, y;
+
+            std::memcpy( &x, augend + g * W, sizeof(x) );
+            std::memcpy( &y, addend + g * W, sizeof(y) );
+            x = Subtract ? x - y : x + y;
+            std::memcpy( result + g * W, &x, sizeof(x) );
+        }
+    }
+
+    // Vector kernels for a single element, by operation
+    template < std::size_t W, typename T, std::size_t R >
+    inline __attribute__(( always_inline ))
+    void  simd_kernel( batch_plus, complex_it<T, R> &result, complex_it<T, R>
+     const &a, complex_it<T, R> const &b )
+    { simd_lane_wise<T, R, W, false>( &result[0], &a[0], &b[0] ); }
+
+    template < std::size_t W, typename T, std::size_t R >
+    inline __attribute__(( always_inline ))
+    void  simd_kernel( batch_minus, complex_it<T, R> &result, complex_it<T, R>
+     const &a, complex_it<T, R> const &b )
+    { simd_lane_wise<T, R, W, true>( &result[0], &a[0], &b[0] ); }
+
+    template < std::size_t W, typename T, std::size_t R >
+    inline __attribute__(( always_inline ))
+    void  simd_kernel( batch_multiplies, complex_it<T, R> &result,
+     complex_it<T, R> const &a, complex_it<T, R> const &b )
+    {
+        simd_cayley_product<T, R, W, false, false>( &result[0], &a[0], &b[0],
+         make_index_list<(1u << R)>{} );
+    }
+
+    template < std::size_t W, typename T, std::size_t R >
+    inline __attribute__(( always_inline ))
+    void  simd_kernel( batch_conj_multiplies, complex_it<T, R> &result,
+     complex_it<T, R> const &a, complex_it<T, R> const &b )
+    {
+        simd_cayley_product<T, R, W, true, false>( &result[0], &a[0], &b[0],
+         make_index_list<(1u << R)>{} );
+    }
+
+    template < std::size_t W, typename T, std::size_t R >
+    inline __attribute__(( always_inline ))
+    void  simd_kernel( batch_divides, complex_it<T, R> &result, complex_it<T,
+     R> const &a, complex_it<T, R> const &b )
+    {
+        if ( !simd_cayley_quotient<T, R, W, false>(&result[0], &a[0], &b[0]) )
+            result = a / b;
+    }
+
+    template < std::size_t W, typename T, std::size_t R >
+    inline __attribute__(( always_inline ))
+    void  simd_kernel( batch_left_divides, complex_it<T, R> &result,
+     complex_it<T, R> const &a, complex_it<T, R> const &b )
+    {
+        if ( !simd_cayley_quotient<T, R, W, true>(&result[0], &b[0], &a[0]) )
+            result = left_divide( a, b );
+    }
+
+    template < std::size_t W, typename T, std::size_t R >
+    inline __attribute__(( always_inline ))
+    void  simd_kernel( batch_scales<T> const &op, complex_it<T, R> &result,
+     complex_it<T, R> const &a )
+    {
+        typedef typename simd_vector<T, W>::type  vector_type;
+
+        vector_type  factor;
+
+        simd_splat( factor, op.scalar, make_index_list<W>{} );
+
+        for ( std::size_t g = 0u ; g < (1u << R) / W ; ++g )
+        {
+            vector_type  v;
+
+            std::memcpy( &v, &a[g * W], sizeof(v) );
+            v *= factor;
+            std::memcpy( &result[g * W], &v, sizeof(v) );
+        }
+    }
+
+    template < std::size_t W, typename T, std::size_t R >
+    inline __attribute__(( always_inline ))
+    void  simd_kernel( batch_norms, T &result, complex_it<T, R> const &a )
+    { result = simd_norm<T, R, W>( &a[0] ); }
+
+    //! \overload
+    template < class Op, typename T, std::size_t R, std::size_t Bytes >
+    struct has_simd_kernel< Op, complex_it<T, R>, complex_it<T, R>,
+     complex_it<T, R>, Bytes >
+        : std::integral_constant< bool, has_simd_layout<T, R, Bytes>::value && (
+           std::is_same<Op, batch_plus>::value || std::is_same<Op,
+           batch_minus>::value || std::is_same<Op, batch_multiplies>::value ||
+           std::is_same<Op, batch_conj_multiplies>::value || std::is_same<Op,
+           batch_divides>::value || std::is_same<Op,
+           batch_left_divides>::value ) >
+    { };
+
+    //! \overload
+    template < typename T, std::size_t R, std::size_t Bytes >
+    struct has_simd_unary_kernel< batch_scales<T>, complex_it<T, R>,
+     complex_it<T, R>, Bytes >
+        : has_simd_layout< T, R, Bytes >
+    { };
+
+    //! \overload
+    template < typename T, std::size_t R, std::size_t Bytes >
+    struct has_simd_unary_kernel< batch_norms, complex_it<T, R>, T, Bytes >
+        : has_simd_layout< T, R, Bytes >
+    { };
+
+    // Apply an operation to one element, with its vector kernel
+    template < std::size_t Bytes, class Op, typename T, std::size_t R >
+    inline __attribute__(( always_inline ))
+    void  batch_element( Op const &op, complex_it<T, R> const &a, complex_it<T,
+     R> const &b, complex_it<T, R> &result, std::true_type )
+    { simd_kernel<simd_lanes( sizeof(T), R, Bytes )>( op, result, a, b ); }
+
+    template < std::size_t Bytes, class Op, typename T, std::size_t R, typename
+     Out >
+    inline __attribute__(( always_inline ))
+    void  batch_element( Op const &op, complex_it<T, R> const &a, Out &result,
+     std::true_type )
+    { simd_kernel<simd_lanes( sizeof(T), R, Bytes )>( op, result, a ); }
+#endif
+
+    // Apply an operation to one element, with its function object
+    template < std::size_t Bytes, class Op, typename In1, typename In2, typename
+     Out >
+    inline
+    void  batch_element( Op const &op, In1 const &a, In2 const &b, Out &result,
+     std::false_type )
+    { result = op( a, b ); }
+
+    template < std::size_t Bytes, class Op, typename In, typename Out >
+    inline
+    void  batch_element( Op const &op, In const &a, Out &result,
+     std::false_type )
+    { result = op( a ); }
+
+    // Run one iteration of a loop body, telling it the register width when
+    // it picks kernels by width
+    template < std::size_t Bytes, class Body >
+    inline __attribute__(( always_inline ))
+    auto  batch_step( Body const &body, std::size_t i, int )
+     -> decltype( body.template step<Bytes>(i) )
+    { body.template step<Bytes>( i ); }
+
+    template < std::size_t Bytes, class Body >
+    inline __attribute__(( always_inline ))
+    void  batch_step( Body const &body, std::size_t i, long )
+    { body( i ); }
+
+    // The loop is the same for every level; the loop bodies may pick kernels
+    // for the level's register width, and the compiler may use the level's
+    // instructions for the rest.
+    template < class Body >
+    void  batch_loop_baseline( Body const &body, std::size_t n )
+    { for ( std::size_t i = 0u ; i < n ; ++i ) batch_step<0u>( body, i, 0 ); }
+
+#if BOOST_MATH_COMPLEX_SIMD_DISPATCH
+    template < class Body >
+    __attribute__(( target("sse4.2") ))
+    void  batch_loop_sse42( Body const &body, std::size_t n )
+    { for ( std::size_t i = 0u ; i < n ; ++i ) batch_step<16u>( body, i, 0 ); }
+
+    template < class Body >
+    __attribute__(( target("avx2,fma") ))
+    void  batch_loop_avx2( Body const &body, std::size_t n )
+    { for ( std::size_t i = 0u ; i < n ; ++i ) batch_step<32u>( body, i, 0 ); }
+
+    template < class Body >
+    __attribute__(( target("avx512f") ))
+    void  batch_loop_avx512( Body const &body, std::size_t n )
+    { for ( std::size_t i = 0u ; i < n ; ++i ) batch_step<64u>( body, i, 0 ); }
+#endif
+
+    //! Run the body over [0, n) with the best available loop version.
+    template < class Body >
+    void  batch_dispatch( Body const &body, std::size_t n )
+    {
+        switch ( detected_simd_level() )
+        {
+#if BOOST_MATH_COMPLEX_SIMD_DISPATCH
+        case simd_avx512:  batch_loop_avx512( body, n );  break;
+        case simd_avx2:    batch_loop_avx2( body, n );    break;
+        case simd_sse42:   batch_loop_sse42( body, n );   break;
+#endif
+        default:           batch_loop_baseline( body, n );  break;
+        }
+    }
+
+    //! Loop body for element-wise binary operations on array segments.
+    template < class Op, typename In1, typename In2, typename Out >
+    struct binary_batch_body
+    {
+        Op          op;
+        In1 const  *in1;
+        In2 const  *in2;
+        Out        *out;
+
+        template < std::size_t Bytes >
+        inline __attribute__(( always_inline ))
+        void  step( std::size_t i ) const
+        {
+            batch_element<Bytes>( op, in1[i], in2[i], out[i],
+             has_simd_kernel<Op, In1, In2, Out, Bytes>{} );
+        }
+    };
+
+    //! Loop body for element-wise unary operations on array segments.
+    template < class Op, typename In, typename Out >
+    struct unary_batch_body
+    {
+        Op         op;
+        In const  *in;
+        Out       *out;
+
+        template < std::size_t Bytes >
+        inline __attribute__(( always_inline ))
+        void  step( std::size_t i ) const
+        {
+            batch_element<Bytes>( op, in[i], out[i], has_simd_unary_kernel<Op,
+             In, Out, Bytes>{} );
+        }
+    };
+
+    // Binary batches, general iterators
+    template < class Op, typename InputIt1, typename InputIt2, typename
+     OutputIt >
+    inline
+    auto  batch_apply( Op op, InputIt1 first1, InputIt1 last1, InputIt2 first2,
+     OutputIt result, std::false_type ) -> OutputIt
+    {
+        while ( first1 != last1 )
+            *result++ = op( *first1++, *first2++ );
+        return result;
+    }
+
+    // Binary batches, vector-friendly array segments
+    template < class Op, typename In1, typename In2, typename Out >
+    inline
+    auto  batch_apply( Op op, In1 *first1, In1 *last1, In2 *first2, Out *result,
+     std::true_type ) -> Out *
+    {
+        std::size_t const  n = last1 - first1;
+
+        batch_dispatch( binary_batch_body<Op, typename
+         std::remove_const<In1>::type, typename std::remove_const<In2>::type,
+         Out>{op, first1, first2, result}, n );
+        return result + n;
+    }
+
+    //! Apply a binary operation element-wise, like `std::transform`.
+    template < class Op, typename InputIt1, typename InputIt2, typename
+     OutputIt >
+    inline
+    auto  batch_apply( Op op, InputIt1 first1, InputIt1 last1, InputIt2 first2,
+     OutputIt result ) -> OutputIt
+    {
+        return batch_apply( op, first1, last1, first2, result,
+         std::integral_constant<bool, is_simd_batch_iterator<InputIt1>::value &&
+         std::is_pointer<InputIt2>::value && std::is_pointer<OutputIt>::value>{}
+         );
+    }
+
+    // Unary batches, general iterators
+    template < class Op, typename InputIt, typename OutputIt >
+    inline
+    auto  batch_apply( Op op, InputIt first, InputIt last, OutputIt result,
+     std::false_type ) -> OutputIt
+    {
+        while ( first != last )
+            *result++ = op( *first++ );
+        return result;
+    }
+
+    // Unary batches, vector-friendly array segments
+    template < class Op, typename In, typename Out >
+    inline
+    auto  batch_apply( Op op, In *first, In *last, Out *result, std::true_type )
+     -> Out *
+    {
+        std::size_t const  n = last - first;
+
+        batch_dispatch( unary_batch_body<Op, typename std::remove_const<In
+         >::type, Out>{op, first, result}, n );
+        return result + n;
+    }
+
+    //! Apply a unary operation element-wise, like `std::transform`.
+    template < class Op, typename InputIt, typename OutputIt >
+    inline
+    auto  batch_apply( Op op, InputIt first, InputIt last, OutputIt result )
+     -> OutputIt
+    {
+        return batch_apply( op, first, last, result,
+         std::integral_constant<bool, is_simd_batch_iterator<InputIt>::value &&
+         std::is_pointer<OutputIt>::value>{} );
+    }
+
+    //! Loop body for element-wise accumulations into array segments.
+    template < class Op, typename In1, typename In2, typename Acc >
+    struct accumulate_batch_body
+    {
+        Op          op;
+        In1 const  *in1;
+        In2 const  *in2;
+        Acc        *acc;
+
+        void  operator ()( std::size_t i ) const
+        { op( acc[i], in1[i], in2[i] ); }
+    };
+
+    // Accumulating batches, general iterators
+    template < class Op, typename InputIt1, typename InputIt2, typename
+     ForwardIt >
+    inline
+    auto  batch_accumulate( Op op, InputIt1 first1, InputIt1 last1, InputIt2
+     first2, ForwardIt accumulator, std::false_type ) -> ForwardIt
+    {
+        for ( ; first1 != last1 ; ++first1, ++first2, ++accumulator )
+            op( *accumulator, *first1, *first2 );
+        return accumulator;
+    }
+
+    // Accumulating batches, vector-friendly array segments
+    template < class Op, typename In1, typename In2, typename Acc >
+    inline
+    auto  batch_accumulate( Op op, In1 *first1, In1 *last1, In2 *first2, Acc
+     *accumulator, std::true_type ) -> Acc *
+    {
+        std::size_t const  n = last1 - first1;
+
+        batch_dispatch( accumulate_batch_body<Op, typename
+         std::remove_const<In1>::type, typename std::remove_const<In2>::type,
+         Acc>{op, first1, first2, accumulator}, n );
+        return accumulator + n;
+    }
+
+    //! Apply an operation element-wise, updating the third range in place.
+    template < class Op, typename InputIt1, typename InputIt2, typename
+     ForwardIt >
+    inline
+    auto  batch_accumulate( Op op, InputIt1 first1, InputIt1 last1, InputIt2
+     first2, ForwardIt accumulator ) -> ForwardIt
+    {
+        return batch_accumulate( op, first1, last1, first2, accumulator,
+         std::integral_constant<bool, is_simd_batch_iterator<InputIt1>::value &&
+         std::is_pointer<InputIt2>::value &&
+         std::is_pointer<ForwardIt>::value>{} );
+    }
+
+}  // namespace detail
+//! \endcond
+
+
+//  Batch arithmetic functions  ----------------------------------------------//
+
+/** \brief  Batch addition
+
+Adds corresponding elements of two sequences of hypercomplex numbers, like
+`std::transform` with `operator +`.  When the sequences are contiguous arrays of
+`complex_it` with `float` or `double` components, the loop may run with vector
+extensions; see #BOOST_MATH_COMPLEX_SIMD_DISPATCH.
+
+    \pre  [`first1`, `last1`) is a valid range, and the ranges starting at
+          `first2` and `result` are at least as long.
+    \pre  Each output element may alias only its own input elements.
+
+    \param[in]  first1  The start of the augends.
+    \param[in]  last1   The end of the augends.
+    \param[in]  first2  The start of the addends.
+    \param[out] result  The start of the sums.
+
+    \returns  The end of the output range.
+ */
+template < typename InputIt1, typename InputIt2, typename OutputIt >
+inline
+auto  batch_add( InputIt1 first1, InputIt1 last1, InputIt2 first2, OutputIt
+ result ) -> OutputIt
+{
+    return detail::batch_apply( detail::batch_plus{}, first1, last1, first2,
+     result );
+}
+
+/** \brief  Batch subtraction
+
+Subtracts corresponding elements of the second sequence from the first, like
+`std::transform` with `operator -`.
+
+    \see  #boost::math::batch_add
+
+    \param[in]  first1  The start of the minuends.
+    \param[in]  last1   The end of the minuends.
+    \param[in]  first2  The start of the subtrahends.
+    \param[out] result  The start of the differences.
+
+    \returns  The end of the output range.
+ */
+template < typename InputIt1, typename InputIt2, typename OutputIt >
+inline
+auto  batch_subtract( InputIt1 first1, InputIt1 last1, InputIt2 first2, OutputIt
+ result ) -> OutputIt
+{
+    return detail::batch_apply( detail::batch_minus{}, first1, last1, first2,
+     result );
+}
+
+/** \brief  Batch Cayley multiplication
+
+Multiplies corresponding elements of two sequences, like `std::transform` with
+`operator *`.
+
+    \see  #boost::math::batch_add
+
+    \param[in]  first1  The start of the multiplicands.
+    \param[in]  last1   The end of the multiplicands.
+    \param[in]  first2  The start of the multipliers.
+    \param[out] result  The start of the products.
+
+    \returns  The end of the output range.
+ */
+template < typename InputIt1, typename InputIt2, typename OutputIt >
+inline
+auto  batch_multiply( InputIt1 first1, InputIt1 last1, InputIt2 first2, OutputIt
+ result ) -> OutputIt
+{
+    return detail::batch_apply( detail::batch_multiplies{}, first1, last1,
+     first2, result );
+}
+
+/** \brief  Batch conjugate-multiplication
+
+Multiplies the conjugate of each element of the first sequence with the
+corresponding element of the second, i.e. `conj(a[i]) * b[i]`, the term of an
+inner product.  The conjugation is folded into the multiplication, so no
+conjugated copy is made.  Only supports `complex_it` elements.
+
+    \see  #boost::math::batch_add
+
+    \param[in]  first1  The start of the multiplicands, to be conjugated.
+    \param[in]  last1   The end of the multiplicands.
+    \param[in]  first2  The start of the multipliers.
+    \param[out] result  The start of the products.
+
+    \returns  The end of the output range.
+ */
+template < typename InputIt1, typename InputIt2, typename OutputIt >
+inline
+auto  batch_conj_multiply( InputIt1 first1, InputIt1 last1, InputIt2 first2,
+ OutputIt result ) -> OutputIt
+{
+    return detail::batch_apply( detail::batch_conj_multiplies{}, first1, last1,
+     first2, result );
+}
+
+/** \brief  Batch Cayley division
+
+Divides corresponding elements of the first sequence by the second, like
+`std::transform` with `operator /`.  The quotients are the operator's, including
+its pre-scaled fallback where the fused quotient would leave the component
+type's range; the vector kernels hand such elements back to the operator.
+
+    \see  #boost::math::batch_add
+
+    \pre  No element of the divisors is zero.
+
+    \param[in]  first1  The start of the dividends.
+    \param[in]  last1   The end of the dividends.
+    \param[in]  first2  The start of the divisors.
+    \param[out] result  The start of the quotients.
+
+    \returns  The end of the output range.
+ */
+template < typename InputIt1, typename InputIt2, typename OutputIt >
+inline
+auto  batch_divide( InputIt1 first1, InputIt1 last1, InputIt2 first2, OutputIt
+ result ) -> OutputIt
+{
+    return detail::batch_apply( detail::batch_divides{}, first1, last1, first2,
+     result );
+}
+
+/** \brief  Batch Cayley left division
+
+Divides corresponding elements of the second sequence by the first, with each
+divisor's reciprocal as the left factor, like `std::transform` with
+#boost::math::left_divide.  As with #boost::math::batch_divide, the quotients
+match that function's, out-of-range cases included.
+
+    \see  #boost::math::batch_divide
+
+    \pre  No element of the divisors is zero.
+
+    \param[in]  first1  The start of the divisors.
+    \param[in]  last1   The end of the divisors.
+    \param[in]  first2  The start of the dividends.
+    \param[out] result  The start of the quotients.
+
+    \returns  The end of the output range.
+ */
+template < typename InputIt1, typename InputIt2, typename OutputIt >
+inline
+auto  batch_left_divide( InputIt1 first1, InputIt1 last1, InputIt2 first2,
+ OutputIt result ) -> OutputIt
+{
+    return detail::batch_apply( detail::batch_left_divides{}, first1, last1,
+     first2, result );
+}
+
+/** \brief  Batch scaling
+
+Multiplies each element of a sequence by a real scalar.
+
+    \see  #boost::math::batch_add
+
+    \param[in]  first   The start of the values.
+    \param[in]  last    The end of the values.
+    \param[in]  scalar  The real factor, applied on the right.
+    \param[out] result  The start of the products.
+
+    \returns  The end of the output range.
+ */
+template < typename InputIt, typename Scalar, typename OutputIt >
+inline
+auto  batch_scale( InputIt first, InputIt last, Scalar const &scalar, OutputIt
+ result ) -> OutputIt
+{
+    return detail::batch_apply( detail::batch_scales<Scalar>{scalar}, first,
+     last, result );
+}
+
+/** \brief  Batch Cayley norm
+
+Computes the Cayley norm of each element of a sequence.
+
+    \see  #boost::math::batch_add
+
+    \param[in]  first   The start of the values.
+    \param[in]  last    The end of the values.
+    \param[out] result  The start of the (real) norms.
+
+    \returns  The end of the output range.
+ */
+template < typename InputIt, typename OutputIt >
+inline
+auto  batch_norm( InputIt first, InputIt last, OutputIt result ) -> OutputIt
+{ return detail::batch_apply( detail::batch_norms{}, first, last, result ); }
+
+/** \brief  Batch inverse
+
+Calculates the multiplicative inverse of each element of a sequence, like
+`std::transform` with #boost::math::inverse.  Each element's norm is computed
+once.
+
+    \see  #boost::math::batch_add
+
+    \pre  No element is zero.
+
+    \param[in]  first   The start of the input values.
+    \param[in]  last    The end of the input values.
+    \param[out] result  The start of the inverses.
+
+    \returns  The end of the output range.
+ */
+template < typename InputIt, typename OutputIt >
+inline
+auto  batch_inverse( InputIt first, InputIt last, OutputIt result ) -> OutputIt
+{ return detail::batch_apply( detail::batch_inverses{}, first, last, result ); }
+
+/** \brief  Batch estimated inverse
+
+Calculates the multiplicative inverse of each element of a sequence of
+`complex_it<float, R>`, like `std::transform` with
+#boost::math::approximate_inverse.  No divisions are done; on contiguous arrays
+the loop runs with vector extensions when available.
+
+    \see  #boost::math::batch_inverse
+
+    \pre  Each element's norm is a positive, normal, finite `float`.
+
+    \param[in]  first   The start of the input values.
+    \param[in]  last    The end of the input values.
+    \param[out] result  The start of the inverses.
+
+    \returns  The end of the output range.
+ */
+template < typename InputIt, typename OutputIt >
+inline
+auto  batch_approximate_inverse( InputIt first, InputIt last, OutputIt result )
+ -> OutputIt
+{
+    return detail::batch_apply( detail::batch_approximate_inverses{}, first,
+     last, result );
+}
+
+/** \brief  Batch square
+
+Computes the square of each element of a sequence, with the linear-time method
+of #boost::math::square(complex_it<T,R>const&).
+
+    \see  #boost::math::batch_add
+
+    \param[in]  first   The start of the values.
+    \param[in]  last    The end of the values.
+    \param[out] result  The start of the squares.
+
+    \returns  The end of the output range.
+ */
+template < typename InputIt, typename OutputIt >
+inline
+auto  batch_square( InputIt first, InputIt last, OutputIt result ) -> OutputIt
+{ return detail::batch_apply( detail::batch_squares{}, first, last, result ); }
+
+/** \brief  Batch integer power
+
+Raises each element of a sequence to the same integer power, with the
+logarithmic-time method of #boost::math::pow(complex_it<T,R>const&,Integer).
+
+    \see  #boost::math::batch_add
+
+    \param[in]  first   The start of the bases.
+    \param[in]  last    The end of the bases.
+    \param[in]  n       The exponent.
+    \param[out] result  The start of the powers.
+
+    \returns  The end of the output range.
+ */
+template < typename InputIt, typename Integer, typename OutputIt >
+inline
+auto  batch_pow( InputIt first, InputIt last, Integer n, OutputIt result )
+ -> OutputIt
+{
+    return detail::batch_apply( detail::batch_powers<Integer>{n}, first, last,
+     result );
+}
+
+/** \brief  Batch multiply-and-accumulate
+
+Adds the product of corresponding elements of two sequences to the
+corresponding element of a third, in place, i.e. `acc[i] += a[i] * b[i]`.  No
+product temporaries are formed, and either factor can be conjugated on the fly.
+
+    \see  #boost::math::batch_add
+    \see  #boost::math::fma_assign
+
+    \tparam ConjugateMd  Whether the elements of the first sequence are
+                         conjugated.
+    \tparam ConjugateMr  Whether the elements of the second sequence are
+                         conjugated.
+
+    \param[in]     first1       The start of the multiplicands.
+    \param[in]     last1        The end of the multiplicands.
+    \param[in]     first2       The start of the multipliers.
+    \param[in,out] accumulator  The start of the accumulators.
+
+    \returns  The end of the accumulator range.
+ */
+template < bool ConjugateMd = false, bool ConjugateMr = false, typename
+ InputIt1, typename InputIt2, typename ForwardIt >
+inline
+auto  batch_fma( InputIt1 first1, InputIt1 last1, InputIt2 first2, ForwardIt
+ accumulator ) -> ForwardIt
+{
+    return detail::batch_accumulate( detail::batch_fma_assigns<ConjugateMd,
+     ConjugateMr>{}, first1, last1, first2, accumulator );
+}
+
+/** \brief  Batch multiply-and-deduct
+
+Subtracts the product of corresponding elements of two sequences from the
+corresponding element of a third, in place, i.e. `acc[i] -= a[i] * b[i]`.
+
+    \see  #boost::math::batch_fma
+
+    \tparam ConjugateMd  Whether the elements of the first sequence are
+                         conjugated.
+    \tparam ConjugateMr  Whether the elements of the second sequence are
+                         conjugated.
+
+    \param[in]     first1       The start of the multiplicands.
+    \param[in]     last1        The end of the multiplicands.
+    \param[in]     first2       The start of the multipliers.
+    \param[in,out] accumulator  The start of the accumulators.
+
+    \returns  The end of the accumulator range.
+ */
+template < bool ConjugateMd = false, bool ConjugateMr = false, typename
+ InputIt1, typename InputIt2, typename ForwardIt >
+inline
+auto  batch_fms( InputIt1 first1, InputIt1 last1, InputIt2 first2, ForwardIt
+ accumulator ) -> ForwardIt
+{
+    return detail::batch_accumulate( detail::batch_fms_assigns<ConjugateMd,
+     ConjugateMr>{}, first1, last1, first2, accumulator );
+}
+
+/** \brief  Sum of products
+
+Adds the products of corresponding elements of two sequences to an initial
+value, like `std::inner_product`, but each product is accumulated straight into
+the running sum.  Conjugating the first sequence gives the usual hypercomplex
+inner product.
+
+    \see  #boost::math::fma_assign
+
+    \tparam ConjugateMd  Whether the elements of the first sequence are
+                         conjugated.
+    \tparam ConjugateMr  Whether the elements of the second sequence are
+                         conjugated.
+
+    \param[in] first1  The start of the multiplicands.
+    \param[in] last1   The end of the multiplicands.
+    \param[in] first2  The start of the multipliers.
+    \param[in] init    The starting value of the sum.
+
+    \returns  `init` plus the sum of the products.
+ */
+template < bool ConjugateMd = false, bool ConjugateMr = false, typename
+ InputIt1, typename InputIt2, typename T >
+auto  accumulate_products( InputIt1 first1, InputIt1 last1, InputIt2 first2, T
+ init ) -> T
+{
+    for ( ; first1 != last1 ; ++first1, ++first2 )
+        fma_assign<ConjugateMd, ConjugateMr>( init, *first1, *first2 );
+    return init;
+}
+
+
+//  Bulk conversion functions  -----------------------------------------------//
+
+//! \cond
+namespace detail
+{
+    // Whether an array segment of X can be copied as bytes into one of Y
+    template < class X, class Y >
+    struct is_bitwise_convertible
+        : std::integral_constant< bool, std::is_same<typename X::value_type,
+           typename Y::value_type>::value && (X::static_size ==
+           Y::static_size) && is_packed<X>::value && is_packed<Y>::value &&
+           std::is_trivially_copyable<X>::value &&
+           std::is_trivially_copyable<Y>::value >
+    { };
+
+    // Packed layouts of the same components: one block copy
+    template < class X, class Y >
+    inline
+    auto  convert_range( X const *first, X const *last, Y *result,
+     std::true_type ) noexcept -> Y *
+    {
+        std::size_t const  count = last - first;
+
+        if ( count )
+            std::memcpy( static_cast<void *>(result), first, count * sizeof(X)
+             );
+        return result + count;
+    }
+
+    // Otherwise: component by component, through the iterators
+    template < class X, class Y >
+    auto  convert_range( X const *first, X const *last, Y *result,
+     std::false_type ) -> Y *
+    {
+        typedef typename Y::value_type  target_type;
+
+        for ( ; last != first ; ++first, ++result )
+        {
+            auto        r = begin( *result );
+            auto        b = begin( *first );
+            auto const  e = end( *first );
+
+            while ( e != b )
+                *r++ = static_cast<target_type>( *b++ );
+        }
+        return result;
+    }
+
+}  // namespace detail
+//! \endcond
+
+/** \brief  Converts an array segment between the hypercomplex representations
+
+Copies each number from an array segment of `complex_it` objects into an array
+segment of `complex_rt` objects of the same rank, or vice versa, converting the
+components to the destination's type.  It gives the same results as applying
+the explicit conversion constructor or operator to each element, but without
+descending the barrages of a `complex_rt` per component.
+
+When both types have the same component type, are packed (see
+#boost::math::is_packed), and are trivially copyable, the whole segment is
+copied with a single `std::memcpy`.  Otherwise, each element's components are
+copied in order.
+
+    \pre  [`first`, `last`) is a valid range.
+    \pre  The destination segment starting at `result` is at least as long as
+          the source, and the two don't overlap.
+    \pre  Each `T` component is explicitly convertible to `U`.
+
+    \param[in]  first   The start of the source numbers.
+    \param[in]  last    The end of the source numbers.
+    \param[out] result  The start of the destination numbers.
+
+    \returns  The end of the destination range.
+ */
+template < typename T, std::size_t R, typename U >
+inline
+auto  convert_range( complex_it<T, R> const *first, complex_it<T, R> const
+ *last, complex_rt<U, R> *result ) -> complex_rt<U, R> *
+{
+    return detail::convert_range( first, last, result,
+     detail::is_bitwise_convertible<complex_it<T, R>, complex_rt<U, R>>{} );
+}
+
+//! \overload
+template < typename T, std::size_t R, typename U >
+inline
+auto  convert_range( complex_rt<T, R> const *first, complex_rt<T, R> const
+ *last, complex_it<U, R> *result ) -> complex_it<U, R> *
+{
+    return detail::convert_range( first, last, result,
+     detail::is_bitwise_convertible<complex_rt<T, R>, complex_it<U, R>>{} );
+}
 
 
 }  // namespace math
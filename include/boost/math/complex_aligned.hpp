@@ -0,0 +1,196 @@
+//  Boost Complex Numbers, over-aligned storage header file  -----------------//
+
+//  Copyright 2013 Daryle Walker.
+//  Distributed under the Boost Software License, Version 1.0.  (See the
+//  accompanying file LICENSE_1_0.txt or a copy at
+//  <http://www.boost.org/LICENSE_1_0.txt>.)
+
+//  See <http://www.boost.org/libs/math/> for the library's home page.
+
+/** \file   boost/math/complex_aligned.hpp
+    \brief  Hypercomplex numbers aligned to their natural vector size.
+
+    \author  Daryle Walker
+
+    \version  0.1
+
+    \copyright  Boost Software License, version 1.0
+
+    Contains the declaration (and definition) of class template
+    `aligned_complex_it`, a `complex_it` whose objects start on a multiple of
+    their own size (up to a cache line), so each value fits one vector register
+    load and never straddles a cache line within an array.
+
+    \warning  This library requires C++2011 features.
+ */
+
+#ifndef BOOST_MATH_COMPLEX_ALIGNED_HPP
+#define BOOST_MATH_COMPLEX_ALIGNED_HPP
+
+#include <cstddef>
+#include <type_traits>
+
+#include "boost/math/complex.hpp"
+#include "boost/math/complex_it.hpp"
+#include "boost/math/complex_rt.hpp"
+
+
+namespace boost
+{
+namespace math
+{
+
+
+//  Alignment computation  ---------------------------------------------------//
+
+/** \brief  The alignment that matches a hypercomplex type to vector registers
+
+When the size of `complex_it<T, R>` is a power of two, no larger than 64 bytes
+(an AVX-512 register and a typical cache line), the value is that size.
+Otherwise, it is the type's own alignment.
+
+    \tparam T  The component type
+    \tparam R  The Cayley-Dickson construction level
+ */
+template < typename T, std::size_t R >
+struct natural_vector_alignment
+    : std::integral_constant< std::size_t, (sizeof( complex_it<T, R> ) <= 64u)
+       && !(sizeof( complex_it<T, R> ) & (sizeof( complex_it<T, R> ) - 1u)) &&
+       (sizeof( complex_it<T, R> ) > alignof( complex_it<T, R> )) ? sizeof(
+       complex_it<T, R> ) : alignof( complex_it<T, R> ) >
+{ };
+
+
+//  Aligned hypercomplex number class template definition  -------------------//
+
+/** \brief  A `complex_it` with over-aligned storage
+
+Same value type as `complex_it<Number, Rank>`, which is its public base, but
+every object is aligned to `Align` bytes.  With the default, a
+`complex_it<float, 2>` is 16-byte aligned and a `complex_it<double, 2>` is
+32-byte aligned, so each value is a single aligned vector load, and an array of
+them never splits a value across cache lines.  Arrays of these types are
+vector-friendly for the batch functions (#boost::math::batch_multiply, etc.),
+just like arrays of `complex_it`.
+
+All the `complex_it` operators and functions take these objects through the
+base class, and their `complex_it` results convert back implicitly.  The
+constructors are the same as those of `complex_it`, plus an explicit
+conversion from `complex_rt`.
+
+    \pre  `Number` meets the requirements of #boost::math::complex_it.
+    \pre  `Align` is a power of two that is at least
+          `alignof( complex_it<Number, Rank> )`.
+
+    \note  Until C++2017, `operator new` (and so `std::allocator`) only
+           guarantees alignment to `alignof( std::max_align_t )`.  Storage for
+           more strictly aligned types should then come from an aligned
+           allocation function or allocator.
+
+    \tparam Number  The component type
+    \tparam Rank    The Cayley-Dickson construction level.  If not given, it
+                    defaults to 1, in order to model regular complex numbers.
+    \tparam Align   The alignment, in bytes.  If not given, it defaults to
+                    #boost::math::natural_vector_alignment.
+ */
+template < typename Number, std::size_t Rank = 1u, std::size_t Align =
+ natural_vector_alignment<Number, Rank>::value >
+struct alignas( Align ) aligned_complex_it
+    : complex_it< Number, Rank >
+{
+    static_assert( !(Align & (Align - 1u)), "Alignment must be a power of 2" );
+    static_assert( Align >= alignof(complex_it<Number, Rank>), "Alignment too "
+     "weak" );
+
+    // Core types
+    //! The type of the value without the alignment requirement.
+    typedef complex_it<Number, Rank>  unaligned_type;
+
+    // Sizing parameters
+    //! The alignment of every object, in bytes.
+    static constexpr  std::size_t  alignment = Align;
+
+    // Constructors
+    //! \copydoc  #boost::math::complex_it::complex_it()
+    constexpr  aligned_complex_it() = default;
+    /** \brief  Conversion from the unaligned type
+
+    Copies the value of a `complex_it` (e.g. the result of an operator).
+
+        \param[in] x  The source to copy.
+
+        \post  `static_cast<unaligned_type const &>(*this) == x`.
+     */
+    constexpr  aligned_complex_it( unaligned_type const &x )
+        : unaligned_type( x )
+    {}
+
+    /** \brief  Conversion from `complex_rt`
+
+    Goes through the explicit conversion from `complex_rt` to `complex_it`.
+
+        \param[in] x  The source to copy.
+
+        \post  `static_cast<unaligned_type const &>(*this) ==
+               static_cast<unaligned_type>(x)`.
+     */
+    template < typename T, std::size_t R >
+    explicit  aligned_complex_it( complex_rt<T, R> const &x )
+        : unaligned_type( static_cast<unaligned_type>(x) )
+    {}
+
+    // The other constructors of complex_it work the same.
+    using unaligned_type::unaligned_type;
+};
+
+/** Gives access to a template parameter.
+ */
+template < typename Number, std::size_t Rank, std::size_t Align >
+constexpr
+std::size_t  aligned_complex_it<Number, Rank, Align>::alignment;
+
+
+//  Layout traits  -----------------------------------------------------------//
+
+/** \brief  Over-aligned types are packed when their sizes need no tail padding
+
+An `aligned_complex_it` is a flat component array when its base is packed and
+the alignment adds no padding at the end (i.e. `Align` does not exceed the
+size, as with the default).
+
+    \see  #boost::math::is_packed
+ */
+template < typename T, std::size_t R, std::size_t A >
+struct is_packed< aligned_complex_it<T, R, A> >
+    : std::integral_constant< bool, is_packed<complex_it<T, R>>::value &&
+       (sizeof( aligned_complex_it<T, R, A> ) == sizeof( complex_it<T, R> )) >
+{ };
+
+
+//  Batch operation support  -------------------------------------------------//
+
+//! \cond
+namespace detail
+{
+    // Aligned arrays take the vector-extension kernels like unaligned ones, and
+    // the element type tells the compiler it may use aligned loads.
+    template < typename T, std::size_t R, std::size_t A >
+    struct is_simd_batch_iterator< aligned_complex_it<T, R, A> * >
+        : std::integral_constant< bool, is_simd_batch_iterator<complex_it<T, R>
+           *>::value && is_packed<aligned_complex_it<T, R, A>>::value >
+    { };
+
+    template < typename T, std::size_t R, std::size_t A >
+    struct is_simd_batch_iterator< aligned_complex_it<T, R, A> const * >
+        : is_simd_batch_iterator< aligned_complex_it<T, R, A> * >
+    { };
+
+}  // namespace detail
+//! \endcond
+
+
+}  // namespace math
+}  // namespace boost
+
+
+#endif // BOOST_MATH_COMPLEX_ALIGNED_HPP
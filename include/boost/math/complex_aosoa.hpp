@@ -0,0 +1,659 @@
+//  Boost Complex Numbers, blocked structure-of-arrays header file  ----------//
+
+//  Copyright 2013 Daryle Walker.
+//  Distributed under the Boost Software License, Version 1.0.  (See the
+//  accompanying file LICENSE_1_0.txt or a copy at
+//  <http://www.boost.org/LICENSE_1_0.txt>.)
+
+//  See <http://www.boost.org/libs/math/> for the library's home page.
+
+/** \file   boost/math/complex_aosoa.hpp
+    \brief  Hypercomplex number sequences stored in blocks of component lanes.
+
+    \author  Daryle Walker
+
+    \version  0.1
+
+    \copyright  Boost Software License, version 1.0
+
+    Contains the declarations (and definitions) of class templates
+    `complex_block` and `complex_aosoa_vector`, a sequence of hypercomplex
+    numbers stored as an array of blocks, each holding a vector-width group of
+    numbers with their components grouped by lane (array-of-structures-of-arrays
+    layout).  The batch arithmetic functions of "boost/math/complex.hpp" accept
+    the sequence's iterators directly, and run block-wise on them.
+
+    \warning  This library requires C++2011 features.
+ */
+
+#ifndef BOOST_MATH_COMPLEX_AOSOA_HPP
+#define BOOST_MATH_COMPLEX_AOSOA_HPP
+
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "boost/math/complex.hpp"
+#include "boost/math/complex_it.hpp"
+#include "boost/math/complex_rt.hpp"
+
+
+namespace boost
+{
+namespace math
+{
+
+
+//  Block class template definition  -----------------------------------------//
+
+/** \brief  A vector-width group of hypercomplex numbers, stored by lanes
+
+Holds `Width` numbers of type `complex_it<Number, Rank>`, with component *k* of
+number *t* at `c[k][t]`.  With `float` components and `Width` of 8 or 16, each
+lane is one 256- or 512-bit vector register, so an operation on a block is a
+few vertical vector instructions, and a whole block spans few cache lines.
+
+    \pre  `Number` meets the requirements of #boost::math::complex_it.
+
+    \tparam Number  The component type
+    \tparam Rank    The Cayley-Dickson construction level.
+    \tparam Width   The number of hypercomplex numbers per block.
+ */
+template < typename Number, std::size_t Rank, std::size_t Width >
+struct complex_block
+{
+    // Core types
+    //! \copydoc  #boost::math::complex_it::size_type
+    typedef std::size_t                 size_type;
+    //! \copydoc  #boost::math::complex_it::value_type
+    typedef Number                      value_type;
+    //! The type of one member number.
+    typedef complex_it<Number, Rank>  element_type;
+
+    // Sizing parameters
+    //! \copydoc  #boost::math::complex_it::rank
+    static constexpr  size_type  rank = Rank;
+    //! The number of lanes, one per component.
+    static constexpr  size_type  static_size = element_type::static_size;
+    //! The number of member numbers.
+    static constexpr  size_type  width = Width;
+
+    //! The lanes
+    value_type  c[ static_size ][ width ];
+};
+
+/** Gives access to a template parameter.
+ */
+template < typename Number, std::size_t Rank, std::size_t Width >
+constexpr
+typename complex_block<Number, Rank, Width>::size_type
+  complex_block<Number, Rank, Width>::rank;
+
+/** One lane per component of `complex_it<Number, Rank>`.
+ */
+template < typename Number, std::size_t Rank, std::size_t Width >
+constexpr
+typename complex_block<Number, Rank, Width>::size_type
+  complex_block<Number, Rank, Width>::static_size;
+
+/** Gives access to a template parameter.
+ */
+template < typename Number, std::size_t Rank, std::size_t Width >
+constexpr
+typename complex_block<Number, Rank, Width>::size_type
+  complex_block<Number, Rank, Width>::width;
+
+
+//! \cond
+namespace detail
+{
+    // Mutable access to one number within a block
+    template < typename Number, std::size_t Rank, std::size_t Width >
+    class aosoa_reference
+    {
+        typedef complex_block<Number, Rank, Width>  block_type;
+        typedef typename block_type::size_type      size_type;
+        typedef typename block_type::element_type   element_type;
+
+    public:
+        aosoa_reference( block_type *block, size_type lane ) noexcept
+            : b{ block }, t{ lane }
+        {}
+
+        operator element_type() const
+        {
+            element_type  result;
+
+            for ( size_type k = 0u ; k < block_type::static_size ; ++k )
+                result[ k ] = ( *this )[ k ];
+            return result;
+        }
+        operator complex_rt<Number, Rank>() const
+        {
+            complex_rt<Number, Rank>  result;
+
+            for ( size_type k = 0u ; k < block_type::static_size ; ++k )
+                result[ k ] = ( *this )[ k ];
+            return result;
+        }
+
+        auto  operator =( element_type const &x ) const -> aosoa_reference
+         const &
+        {
+            for ( size_type k = 0u ; k < block_type::static_size ; ++k )
+                ( *this )[ k ] = x[ k ];
+            return *this;
+        }
+        auto  operator =( complex_rt<Number, Rank> const &x ) const
+         -> aosoa_reference const &
+        {
+            for ( size_type k = 0u ; k < block_type::static_size ; ++k )
+                ( *this )[ k ] = x[ k ];
+            return *this;
+        }
+        auto  operator =( aosoa_reference const &x ) const -> aosoa_reference
+         const &
+        { return *this = static_cast<element_type>( x ); }
+
+        // Component k is in lane k, at this number's slot.
+        auto  operator []( size_type k ) const -> Number &
+        { return b->c[ k ][ t ]; }
+
+    private:
+        block_type *  b;
+        size_type     t;
+    };
+
+    // Element iterator, for either mutable or constant sequences
+    template < typename Number, std::size_t Rank, std::size_t Width, bool
+     IsConst >
+    class aosoa_iterator
+    {
+        typedef complex_block<Number, Rank, Width>  mutable_block;
+        typedef typename std::conditional<IsConst, mutable_block const,
+         mutable_block>::type                       block_type;
+
+    public:
+        typedef std::random_access_iterator_tag   iterator_category;
+        typedef complex_it<Number, Rank>          value_type;
+        typedef std::ptrdiff_t                    difference_type;
+        typedef void                              pointer;
+        typedef typename std::conditional<IsConst, value_type,
+         aosoa_reference<Number, Rank, Width>>::type  reference;
+
+        aosoa_iterator() noexcept = default;
+        aosoa_iterator( block_type *blocks, std::size_t index ) noexcept
+            : b{ blocks }, i{ index }
+        {}
+        template < bool C, typename = typename std::enable_if<IsConst &&
+         !C>::type >
+        aosoa_iterator( aosoa_iterator<Number, Rank, Width, C> const &x )
+         noexcept
+            : b{ x.blocks() }, i{ x.index() }
+        {}
+
+        auto  blocks() const noexcept -> block_type *  { return b; }
+        auto  index() const noexcept -> std::size_t  { return i; }
+
+        auto  operator *() const -> reference
+        { return dereference( std::integral_constant<bool, IsConst>{} ); }
+        auto  operator []( difference_type n ) const -> reference
+        { return *( *this + n ); }
+
+        auto  operator ++() noexcept -> aosoa_iterator &  { ++i; return *this; }
+        auto  operator --() noexcept -> aosoa_iterator &  { --i; return *this; }
+        auto  operator ++( int ) noexcept -> aosoa_iterator
+        { auto const  old = *this; ++i; return old; }
+        auto  operator --( int ) noexcept -> aosoa_iterator
+        { auto const  old = *this; --i; return old; }
+        auto  operator +=( difference_type n ) noexcept -> aosoa_iterator &
+        { i += n; return *this; }
+        auto  operator -=( difference_type n ) noexcept -> aosoa_iterator &
+        { i -= n; return *this; }
+
+        friend
+        auto  operator +( aosoa_iterator x, difference_type n ) noexcept
+         -> aosoa_iterator
+        { return x += n; }
+        friend
+        auto  operator +( difference_type n, aosoa_iterator x ) noexcept
+         -> aosoa_iterator
+        { return x += n; }
+        friend
+        auto  operator -( aosoa_iterator x, difference_type n ) noexcept
+         -> aosoa_iterator
+        { return x -= n; }
+        friend
+        auto  operator -( aosoa_iterator const &x, aosoa_iterator const &y )
+         noexcept -> difference_type
+        { return difference_type( x.i ) - difference_type( y.i ); }
+
+        friend
+        auto  operator ==( aosoa_iterator const &x, aosoa_iterator const &y )
+         noexcept -> bool
+        { return x.b == y.b && x.i == y.i; }
+        friend
+        auto  operator !=( aosoa_iterator const &x, aosoa_iterator const &y )
+         noexcept -> bool
+        { return !( x == y ); }
+        friend
+        auto  operator <( aosoa_iterator const &x, aosoa_iterator const &y )
+         noexcept -> bool
+        { return x.i < y.i; }
+        friend
+        auto  operator >( aosoa_iterator const &x, aosoa_iterator const &y )
+         noexcept -> bool
+        { return y < x; }
+        friend
+        auto  operator <=( aosoa_iterator const &x, aosoa_iterator const &y )
+         noexcept -> bool
+        { return !( y < x ); }
+        friend
+        auto  operator >=( aosoa_iterator const &x, aosoa_iterator const &y )
+         noexcept -> bool
+        { return !( x < y ); }
+
+    private:
+        auto  dereference( std::true_type ) const -> value_type
+        {
+            value_type  result;
+
+            for ( std::size_t k = 0u ; k < value_type::static_size ; ++k )
+                result[ k ] = b[ i / Width ].c[ k ][ i % Width ];
+            return result;
+        }
+        auto  dereference( std::false_type ) const -> reference
+        { return { b + i / Width, i % Width }; }
+
+        block_type *  b = nullptr;
+        std::size_t   i = 0u;
+    };
+
+}  // namespace detail
+//! \endcond
+
+
+//  Blocked structure-of-arrays class template definition  -------------------//
+
+/** \brief  A sequence of hypercomplex numbers, stored by blocks of lanes
+
+A middle ground between a `std::vector<complex_it<Number, Rank>>`, which keeps
+each number's components together, and #boost::math::complex_soa_vector, which
+keeps each component lane separate.  Here the numbers are grouped into blocks of
+`Width` (#boost::math::complex_block), and only within a block are the
+components grouped by lane.  An operation on a block is vertical across the
+lanes, yet touches one contiguous stretch of memory.
+
+The sequence can be walked by block, through #block_begin and #block_end, or by
+element, through #begin and #end.  The element iterators are random-access;
+dereferencing gives a proxy that converts to and from `complex_it` and
+`complex_rt` objects (or a `complex_it` value, for constant iterators).  The
+batch functions (#boost::math::batch_add, etc.) accept them directly, and run
+block by block when all the ranges start on a block boundary.
+
+    \pre  `Number` meets the requirements of #boost::math::complex_it.
+
+    \tparam Number  The component type
+    \tparam Rank    The Cayley-Dickson construction level.
+    \tparam Width   The number of hypercomplex numbers per block.  If not given,
+                    it defaults to 8, i.e. one 256-bit vector of `float` per
+                    lane; use 16 for 512-bit vectors.
+ */
+template < typename Number, std::size_t Rank, std::size_t Width = 8u >
+class complex_aosoa_vector
+{
+public:
+    // Core types
+    //! \copydoc  #boost::math::complex_it::size_type
+    typedef std::size_t                 size_type;
+    //! \copydoc  #boost::math::complex_it::value_type
+    typedef Number                      value_type;
+    //! The type of an element, when separated from the container.
+    typedef complex_it<Number, Rank>  element_type;
+    //! The type of the storage blocks.
+    typedef complex_block<Number, Rank, Width>  block_type;
+    //! Proxy for mutable access to an element.
+    typedef detail::aosoa_reference<Number, Rank, Width>  reference;
+    //! Random-access iterator to mutable elements.
+    typedef detail::aosoa_iterator<Number, Rank, Width, false>  iterator;
+    //! Random-access iterator to constant elements.
+    typedef detail::aosoa_iterator<Number, Rank, Width, true>  const_iterator;
+
+    // Sizing parameters
+    //! \copydoc  #boost::math::complex_it::rank
+    static constexpr  size_type  rank = Rank;
+    //! The number of components per element, and so lanes per block.
+    static constexpr  size_type  static_size = element_type::static_size;
+    //! The number of elements per block.
+    static constexpr  size_type  width = Width;
+
+    // Lifetime management
+    //! Create an empty sequence.
+    complex_aosoa_vector() = default;
+    /** \brief  Create a sequence of zeros.
+        \param[in] n  The number of elements.
+        \post  `this->size() == n`, and each element is zero.
+     */
+    explicit  complex_aosoa_vector( size_type n )  { resize( n ); }
+    /** \brief  Create a sequence from a range of elements.
+
+    Each element is split into the lanes of its block; both `complex_it<Number,
+    Rank>` and `complex_rt<Number, Rank>` elements are accepted.
+
+        \param[in] first  The start of the elements.
+        \param[in] last   The end of the elements.
+        \post  `this->size() == std::distance(first, last)`.
+     */
+    template < typename InputIt >
+    complex_aosoa_vector( InputIt first, InputIt last )
+    {
+        for ( ; first != last ; ++first )
+            push_back( *first );
+    }
+    //! Create a sequence from a list of elements.
+    complex_aosoa_vector( std::initializer_list<element_type> list )
+        : complex_aosoa_vector( list.begin(), list.end() )
+    {}
+
+    // Size inspection and control
+    //! \returns  The number of elements.
+    auto  size() const noexcept -> size_type  { return n; }
+    //! \returns  `this->size() == 0`.
+    auto  empty() const noexcept -> bool  { return !n; }
+    //! \returns  The number of blocks, the last of which may be partial.
+    auto  block_count() const noexcept -> size_type  { return b.size(); }
+    //! Reserve room for `count` elements.
+    void  reserve( size_type count )
+    { b.reserve( (count + Width - 1u) / Width ); }
+    /** \brief  Change the number of elements.
+        \param[in] count  The new number of elements.
+        \post  `this->size() == count`, with new elements being zero.
+     */
+    void  resize( size_type count )
+    {
+        b.resize( (count + Width - 1u) / Width, block_type{} );
+        for ( size_type i = count ; i < b.size() * Width ; ++i )
+            for ( size_type k = 0u ; k < static_size ; ++k )
+                b[ i / Width ].c[ k ][ i % Width ] = value_type{};
+        n = count;
+    }
+    //! Remove all elements.
+    void  clear() noexcept  { b.clear(); n = 0u; }
+    /** \brief  Append an element.
+        \param[in] x  The element to add, as a `complex_it` or `complex_rt`.
+        \post  `(*this)[this->size() - 1] == x`.
+     */
+    template < class Element >
+    void  push_back( Element const &x )
+    {
+        if ( n % Width == 0u )
+            b.push_back( block_type{} );
+        for ( size_type k = 0u ; k < static_size ; ++k )
+            b.back().c[ k ][ n % Width ] = x[ k ];
+        ++n;
+    }
+
+    // Element access
+    /** \brief  Element access
+        \pre  *i* \< `this->size()`.
+        \param[in] i  The index of the selected element.
+        \returns  A proxy for the element (or a copy of it, for `const`
+                  containers).
+     */
+    auto  operator []( size_type i ) -> reference  { return begin()[ i ]; }
+    //! \overload
+    auto  operator []( size_type i ) const -> element_type
+    { return begin()[ i ]; }
+
+    //! \returns  An iterator to the first element.
+    auto  begin() noexcept -> iterator  { return { b.data(), 0u }; }
+    //! \overload
+    auto  begin() const noexcept -> const_iterator  { return { b.data(), 0u }; }
+    //! \returns  An iterator past the last element.
+    auto  end() noexcept -> iterator  { return { b.data(), n }; }
+    //! \overload
+    auto  end() const noexcept -> const_iterator  { return { b.data(), n }; }
+    //! \returns  A constant iterator to the first element.
+    auto  cbegin() const noexcept -> const_iterator  { return begin(); }
+    //! \returns  A constant iterator past the last element.
+    auto  cend() const noexcept -> const_iterator  { return end(); }
+
+    // Block access
+    /** \brief  Block iteration
+
+    The unused trailing members of a partial last block are zero.
+
+        \returns  The start of the contiguous array of blocks.
+     */
+    auto  block_begin() noexcept -> block_type *  { return b.data(); }
+    //! \overload
+    auto  block_begin() const noexcept -> block_type const *
+    { return b.data(); }
+    //! \returns  The end of the contiguous array of blocks.
+    auto  block_end() noexcept -> block_type *  { return b.data() + b.size(); }
+    //! \overload
+    auto  block_end() const noexcept -> block_type const *
+    { return b.data() + b.size(); }
+
+    //! Exchange state with another sequence.
+    void  swap( complex_aosoa_vector &other ) noexcept
+    {
+        b.swap( other.b );
+        std::swap( n, other.n );
+    }
+
+private:
+    std::vector<block_type>  b;
+    size_type                n = 0u;
+};
+
+/** Gives access to a template parameter.
+ */
+template < typename Number, std::size_t Rank, std::size_t Width >
+constexpr
+typename complex_aosoa_vector<Number, Rank, Width>::size_type
+  complex_aosoa_vector<Number, Rank, Width>::rank;
+
+/** One lane per component of `complex_it<Number, Rank>`.
+ */
+template < typename Number, std::size_t Rank, std::size_t Width >
+constexpr
+typename complex_aosoa_vector<Number, Rank, Width>::size_type
+  complex_aosoa_vector<Number, Rank, Width>::static_size;
+
+/** Gives access to a template parameter.
+ */
+template < typename Number, std::size_t Rank, std::size_t Width >
+constexpr
+typename complex_aosoa_vector<Number, Rank, Width>::size_type
+  complex_aosoa_vector<Number, Rank, Width>::width;
+
+
+//  Object support functions  ------------------------------------------------//
+
+/** \brief  Swap
+
+Exchanges the state of two sequences.
+
+    \relates  #boost::math::complex_aosoa_vector
+
+    \param[in,out] a  The first object to be swapped.
+    \param[in,out] b  The second object to be swapped.
+ */
+template < typename T, std::size_t R, std::size_t W >
+inline
+void  swap( complex_aosoa_vector<T, R, W> &a, complex_aosoa_vector<T, R, W> &b )
+ noexcept
+{ a.swap(b); }
+
+
+//  Batch operation support  -------------------------------------------------//
+
+//! \cond
+namespace detail
+{
+    // The batch functions of "boost/math/complex.hpp" reach these overloads
+    // through argument-dependent lookup of the tagged batch_apply and
+    // batch_accumulate calls, since the operation objects live here.
+
+    // Elements read through mutable iterators are proxies; separate them.
+    template < typename T >
+    inline
+    auto  aosoa_value( T const &x ) -> T const &  { return x; }
+
+    template < typename T, std::size_t R, std::size_t W >
+    inline
+    auto  aosoa_value( aosoa_reference<T, R, W> const &x ) -> complex_it<T, R>
+    { return x; }
+
+    // Block kernels, general: the operation per member
+    template < class Op, typename T, std::size_t R, std::size_t W >
+    void  aosoa_block_apply( Op const &op, complex_block<T, R, W> const &a,
+     complex_block<T, R, W> const &b, complex_block<T, R, W> &out )
+    {
+        for ( std::size_t t = 0u ; t < W ; ++t )
+        {
+            complex_it<T, R>  x, y;
+
+            for ( std::size_t k = 0u ; k < x.static_size ; ++k )
+            {
+                x[ k ] = a.c[ k ][ t ];
+                y[ k ] = b.c[ k ][ t ];
+            }
+
+            complex_it<T, R> const  z = op( x, y );
+
+            for ( std::size_t k = 0u ; k < z.static_size ; ++k )
+                out.c[ k ][ t ] = z[ k ];
+        }
+    }
+
+    // Block kernels, addition: vertical over every lane
+    template < typename T, std::size_t R, std::size_t W >
+    void  aosoa_block_apply( batch_plus const &, complex_block<T, R, W> const
+     &a, complex_block<T, R, W> const &b, complex_block<T, R, W> &out )
+    {
+        for ( std::size_t k = 0u ; k < out.static_size ; ++k )
+            for ( std::size_t t = 0u ; t < W ; ++t )
+                out.c[ k ][ t ] = a.c[ k ][ t ] + b.c[ k ][ t ];
+    }
+
+    // Block kernels, subtraction: vertical over every lane
+    template < typename T, std::size_t R, std::size_t W >
+    void  aosoa_block_apply( batch_minus const &, complex_block<T, R, W> const
+     &a, complex_block<T, R, W> const &b, complex_block<T, R, W> &out )
+    {
+        for ( std::size_t k = 0u ; k < out.static_size ; ++k )
+            for ( std::size_t t = 0u ; t < W ; ++t )
+                out.c[ k ][ t ] = a.c[ k ][ t ] - b.c[ k ][ t ];
+    }
+
+    // Block kernels, multiplication: a vertical multiply-add per basis product
+    template < typename T, std::size_t R, std::size_t W >
+    void  aosoa_block_apply( batch_multiplies const &, complex_block<T, R, W>
+     const &a, complex_block<T, R, W> const &b, complex_block<T, R, W> &out )
+    {
+        complex_block<T, R, W>  p{};  // the output may alias an input
+
+        for ( std::size_t i = 0u ; i < p.static_size ; ++i )
+            for ( std::size_t j = 0u ; j < p.static_size ; ++j )
+                if ( cayley_basis<R>::sign(i, j) < 0 )
+                    for ( std::size_t t = 0u ; t < W ; ++t )
+                        p.c[ i ^ j ][ t ] -= a.c[ i ][ t ] * b.c[ j ][ t ];
+                else
+                    for ( std::size_t t = 0u ; t < W ; ++t )
+                        p.c[ i ^ j ][ t ] += a.c[ i ][ t ] * b.c[ j ][ t ];
+        out = p;
+    }
+
+    // Loop body for block-wise binary operations
+    template < class Op, typename T, std::size_t R, std::size_t W >
+    struct aosoa_batch_body
+    {
+        Op                             op;
+        complex_block<T, R, W> const  *in1;
+        complex_block<T, R, W> const  *in2;
+        complex_block<T, R, W>        *out;
+
+        void  operator ()( std::size_t i ) const
+        { aosoa_block_apply( op, in1[i], in2[i], out[i] ); }
+    };
+
+    // Binary batches, blocked first range: element-wise
+    template < class Op, typename T, std::size_t R, std::size_t W, bool C,
+     typename InputIt2, typename OutputIt >
+    auto  batch_apply( Op op, aosoa_iterator<T, R, W, C> first1,
+     aosoa_iterator<T, R, W, C> last1, InputIt2 first2, OutputIt result,
+     std::false_type ) -> OutputIt
+    {
+        for ( ; first1 != last1 ; ++first1, ++first2, ++result )
+            *result = op( aosoa_value(*first1), aosoa_value(*first2) );
+        return result;
+    }
+
+    // Binary batches, all ranges blocked: block-wise when aligned
+    template < class Op, typename T, std::size_t R, std::size_t W, bool C1,
+     bool C2 >
+    auto  batch_apply( Op op, aosoa_iterator<T, R, W, C1> first1,
+     aosoa_iterator<T, R, W, C1> last1, aosoa_iterator<T, R, W, C2> first2,
+     aosoa_iterator<T, R, W, false> result, std::false_type )
+     -> aosoa_iterator<T, R, W, false>
+    {
+        if ( first1.index() % W == 0u && first2.index() % W == 0u &&
+         result.index() % W == 0u )
+        {
+            std::size_t const  blocks = ( last1 - first1 ) / W;
+
+            batch_dispatch( aosoa_batch_body<Op, T, R, W>{op, first1.blocks() +
+             first1.index() / W, first2.blocks() + first2.index() / W,
+             result.blocks() + result.index() / W}, blocks );
+            first1 += blocks * W;
+            first2 += blocks * W;
+            result += blocks * W;
+        }
+        for ( ; first1 != last1 ; ++first1, ++first2, ++result )
+            *result = op( aosoa_value(*first1), aosoa_value(*first2) );
+        return result;
+    }
+
+    // Unary batches, blocked input: element-wise
+    template < class Op, typename T, std::size_t R, std::size_t W, bool C,
+     typename OutputIt >
+    auto  batch_apply( Op op, aosoa_iterator<T, R, W, C> first,
+     aosoa_iterator<T, R, W, C> last, OutputIt result, std::false_type )
+     -> OutputIt
+    {
+        for ( ; first != last ; ++first, ++result )
+            *result = op( aosoa_value(*first) );
+        return result;
+    }
+
+    // Accumulating batches, blocked accumulator: element-wise
+    template < class Op, typename InputIt1, typename InputIt2, typename T,
+     std::size_t R, std::size_t W >
+    auto  batch_accumulate( Op op, InputIt1 first1, InputIt1 last1, InputIt2
+     first2, aosoa_iterator<T, R, W, false> accumulator, std::false_type )
+     -> aosoa_iterator<T, R, W, false>
+    {
+        for ( ; first1 != last1 ; ++first1, ++first2, ++accumulator )
+        {
+            complex_it<T, R>  sum = *accumulator;
+
+            op( sum, aosoa_value(*first1), aosoa_value(*first2) );
+            *accumulator = sum;
+        }
+        return accumulator;
+    }
+
+}  // namespace detail
+//! \endcond
+
+
+}  // namespace math
+}  // namespace boost
+
+
+#endif // BOOST_MATH_COMPLEX_AOSOA_HPP
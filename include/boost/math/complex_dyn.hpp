@@ -0,0 +1,1278 @@
+//  Boost Complex Numbers, runtime-rank header file  -------------------------//
+
+//  Copyright 2013 Daryle Walker.
+//  Distributed under the Boost Software License, Version 1.0.  (See the
+//  accompanying file LICENSE_1_0.txt or a copy at
+//  <http://www.boost.org/LICENSE_1_0.txt>.)
+
+//  See <http://www.boost.org/libs/math/> for the library's home page.
+
+/** \file   boost/math/complex_dyn.hpp
+    \brief  A hypercomplex number class template with its rank set at run-time.
+
+    \author  Daryle Walker
+
+    \version  0.1
+
+    \copyright  Boost Software License, version 1.0
+
+    Contains the declaration (and definition) of class template `complex_dyn`,
+    which models the same Cayley-Dickson hypercomplex numbers as `complex_it`
+    and `complex_rt`, but picks its rank when each object is made, so one
+    instantiation serves every algebra.  The components come from an allocator;
+    the `complex_arena` class and `arena_allocator` class template provide a
+    monotonic arena for many short-lived values.
+
+    \warning  This library requires C++2011 features.
+ */
+
+#ifndef BOOST_MATH_COMPLEX_DYN_HPP
+#define BOOST_MATH_COMPLEX_DYN_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <new>
+#include <numeric>
+#include <ostream>
+#include <sstream>
+#include <type_traits>
+#include <utility>
+
+#include "boost/math/complex_it.hpp"
+#include "boost/math/complex_rt.hpp"
+
+
+namespace boost
+{
+namespace math
+{
+
+
+//  Arena allocation  --------------------------------------------------------//
+
+/** \brief  A monotonic memory arena
+
+Hands out memory by bumping a cursor through large blocks, getting a new block
+from `operator new` when the current one runs out.  Deallocation does nothing;
+all the memory is given back at once by #release or the destructor.  This suits
+the many short-lived temporaries of hypercomplex expressions: each allocation
+is a few instructions, and values made together sit together in memory.
+
+    \see  #boost::math::arena_allocator
+ */
+class complex_arena
+{
+public:
+    /** \brief  Create an empty arena.
+        \param[in] block_size  The usual size of each block, in bytes.  Larger
+                               requests get blocks of their own size.
+     */
+    explicit  complex_arena( std::size_t block_size = 65536u ) noexcept
+        : head{ nullptr }, cursor{ nullptr }, limit{ nullptr }, block_size{
+          block_size }
+    {}
+    //! Arenas are not copyable.
+    complex_arena( complex_arena const & ) = delete;
+    //! Give back all the memory.
+    ~complex_arena()  { release(); }
+
+    //! Arenas are not copyable.
+    complex_arena &  operator =( complex_arena const & ) = delete;
+
+    /** \brief  Get memory.
+        \pre  `alignment` is a power of two, no stricter than
+              `alignof( std::max_align_t )`.
+        \param[in] bytes      The size of the memory segment.
+        \param[in] alignment  The alignment the segment needs.
+        \throws  Whatever `operator new` does when a new block is needed.
+        \returns  The start of the segment.
+     */
+    void *  allocate( std::size_t bytes, std::size_t alignment )
+    {
+        void *       p = cursor;
+        std::size_t  space = limit - cursor;
+
+        if ( !p || !std::align(alignment, bytes, p, space) )
+        {
+            add_block( bytes + alignment );
+            p = cursor;
+            space = limit - cursor;
+            std::align( alignment, bytes, p, space );
+        }
+        cursor = static_cast<unsigned char *>( p ) + bytes;
+        return p;
+    }
+    /** \brief  Return memory.
+        Does nothing; the memory is reused only after #release.
+     */
+    void  deallocate( void *, std::size_t ) noexcept  {}
+
+    //! Give back all the memory, invalidating everything allocated.
+    void  release() noexcept
+    {
+        while ( head )
+        {
+            block * const  next = head->next;
+
+            ::operator delete( head );
+            head = next;
+        }
+        cursor = limit = nullptr;
+    }
+
+private:
+    struct block
+    {
+        block *                             next;
+        alignas( std::max_align_t )  char  data[ 1 ];
+    };
+
+    void  add_block( std::size_t bytes )
+    {
+        std::size_t const  size = std::max( bytes, block_size );
+        block * const      b = static_cast<block *>( ::operator new(offsetof(
+         block, data) + size) );
+
+        b->next = head;
+        head = b;
+        cursor = reinterpret_cast<unsigned char *>( b->data );
+        limit = cursor + size;
+    }
+
+    block *          head;
+    unsigned char *  cursor;
+    unsigned char *  limit;
+    std::size_t      block_size;
+};
+
+/** \brief  An allocator drawing from a #boost::math::complex_arena
+
+Meets the C++2011 allocator requirements, so it can be given to `complex_dyn`
+or to any standard container.  Copies (and rebound copies) share the arena,
+which has to outlive them and everything they allocate.
+
+    \tparam T  The type of the objects allocated.
+ */
+template < typename T >
+class arena_allocator
+{
+public:
+    //! The type of the objects allocated.
+    typedef T  value_type;
+
+    /** \brief  Draw from an arena.
+        \param[in] a  The arena to use.
+        \post  `&this->arena() == &a`.
+     */
+    explicit  arena_allocator( complex_arena &a ) noexcept  : a{ &a }  {}
+    //! Share the arena of an allocator for another type.
+    template < typename U >
+    arena_allocator( arena_allocator<U> const &other ) noexcept
+        : a{ &other.arena() }
+    {}
+
+    /** \brief  Get memory for `n` objects.
+        \param[in] n  The number of objects.
+        \returns  The start of the (uninitialized) objects.
+     */
+    auto  allocate( std::size_t n ) -> T *
+    { return static_cast<T *>( a->allocate(n * sizeof( T ), alignof( T )) ); }
+    /** \brief  Return memory.
+        \param[in] p  The start of the objects.
+        \param[in] n  The number of objects.
+     */
+    void  deallocate( T *p, std::size_t n ) noexcept
+    { a->deallocate( p, n * sizeof(T) ); }
+
+    //! \returns  The arena used.
+    auto  arena() const noexcept -> complex_arena &  { return *a; }
+
+private:
+    complex_arena *  a;
+};
+
+/** \brief  Equality comparison
+
+    \relates  #boost::math::arena_allocator
+
+    \returns  Whether both allocators use the same arena.
+ */
+template < typename T, typename U >
+inline
+bool  operator ==( arena_allocator<T> const &l, arena_allocator<U> const &r )
+ noexcept
+{ return &l.arena() == &r.arena(); }
+
+/** \brief  Inequality comparison
+
+    \relates  #boost::math::arena_allocator
+
+    \returns  Whether the allocators use different arenas.
+ */
+template < typename T, typename U >
+inline
+bool  operator !=( arena_allocator<T> const &l, arena_allocator<U> const &r )
+ noexcept
+{ return not operator ==(l, r); }
+
+
+//  Implementation details  --------------------------------------------------//
+
+//! \cond
+namespace detail
+{
+    /*  The sign of e_i * e_j, as #basis_product_sign gives, but walking the
+        halves from the top with a loop instead of recursing.  Each level keeps
+        or swaps the (reduced) indices and may flip the sign; see
+        #basis_product_sign_split for the cases.  */
+    inline
+    int  dyn_basis_sign( std::size_t rank, std::size_t i, std::size_t j )
+     noexcept
+    {
+        int  sign = 1;
+
+        for ( std::size_t h = rank ? 1ULL << (rank - 1u) : 0u ; h ; h >>= 1 )
+        {
+            bool const  hi = i & h, hj = j & h;
+
+            i &= h - 1u;
+            j &= h - 1u;
+            if ( hj )
+            {
+                if ( hi && !j )
+                    sign = -sign;
+                std::swap( i, j );
+            }
+            else if ( hi && j )
+                sign = -sign;
+        }
+        return sign;
+    }
+
+    /*  Add the Cayley product of two component arrays (shorter ones padded with
+        zeros) to a third, which can't overlap them.  Every component pair is
+        placed with a flat double loop, with the pair's sign found by
+        #dyn_basis_sign, so neither the rank nor the operands' sizes change the
+        depth of the call stack or the code.  */
+    template < bool ConjugateMr, typename T >
+    void  dyn_cayley_product( std::size_t rank, T *product, T const
+     *multiplicand, std::size_t md_size, T const *multiplier, std::size_t
+     mr_size )
+    {
+        for ( std::size_t i = 0u ; i < md_size ; ++i )
+            for ( std::size_t j = 0u ; j < mr_size ; ++j )
+            {
+                T const  p = multiplicand[ i ] * multiplier[ j ];
+
+                if ( (dyn_basis_sign( rank, i, j ) < 0) != (ConjugateMr && j) )
+                    product[ i ^ j ] -= p;
+                else
+                    product[ i ^ j ] += p;
+            }
+    }
+
+    /*  Divide a Cayley product by a norm in place, as #scale_quotient does it:
+        truncating division for integer types, which can't go out of range.  */
+    template < typename T, typename N >
+    bool  dyn_scale_quotient( T *first, T *last, N const &norm,
+     std::true_type )
+    {
+        for ( ; first != last ; ++first )
+            *first = *first / norm;
+        return true;
+    }
+
+    /*  Divide a Cayley product by a norm in place: reciprocal multiplication
+        otherwise.  Returns false if the reciprocal or a product component left
+        the normal range, so the quotient can't be trusted.  */
+    template < typename T, typename N >
+    bool  dyn_scale_quotient( T *first, T *last, N const &norm,
+     std::false_type )
+    {
+        typedef std::integral_constant<bool,
+         std::numeric_limits<T>::is_bounded>  bounded;
+
+        T  scale{};
+
+        ++scale;
+        scale /= norm;
+
+        bool  in_range = scale != T{} && in_normal_range( scale, bounded{} );
+
+        for ( ; first != last ; ++first )
+        {
+            in_range = in_normal_range( *first, bounded{} ) && in_range;
+            *first *= scale;
+        }
+        return in_range;
+    }
+
+}  // namespace detail
+//! \endcond
+
+
+//  Runtime-rank hypercomplex number class template definition  --------------//
+
+/** \brief  A hypercomplex number with its rank picked at run-time
+
+Models the same numbers as `complex_it<Number, Rank>`, with the components in
+one flat array, but the rank is a property of each object.  Operations between
+objects of different ranks work like the mixed-rank operations of `complex_it`:
+the lower-ranked value is treated as padded with zeros, and the result has the
+higher rank.
+
+The Cayley product runs on one non-recursive loop engine for every rank, so
+high ranks need no deep call stacks, and there is no per-rank code for the
+instruction cache to hold.
+
+The components come from `Allocator`, e.g. a #boost::math::arena_allocator.
+Results of operators use the allocator of the (left-most) `complex_dyn`
+operand.  A moved-from object is left a zero of rank 0, kept in an inline slot
+instead of allocated storage.
+
+    \pre  `Number` meets the requirements of #boost::math::complex_it.
+    \pre  `Allocator` meets the C++2011 allocator requirements for `Number`.
+
+    \tparam Number     The component type
+    \tparam Allocator  The source of the component storage.  If not given, it
+                       defaults to `std::allocator<Number>`.
+ */
+template < typename Number, class Allocator = std::allocator<Number> >
+class complex_dyn
+{
+    typedef std::allocator_traits<Allocator>  traits_type;
+
+public:
+    // Core types
+    //! \copydoc  #boost::math::complex_it::size_type
+    typedef std::size_t          size_type;
+    //! \copydoc  #boost::math::complex_it::value_type
+    typedef Number               value_type;
+    //! The source of component storage.  Gives access to a template parameter.
+    typedef Allocator            allocator_type;
+    //! The type for iterating over mutable components.
+    typedef value_type *         iterator;
+    //! The type for iterating over immutable components.
+    typedef value_type const *   const_iterator;
+
+    // Lifetime management
+    /** \brief  Create a zero value of rank 0.
+        \param[in] a  The allocator to use.
+     */
+    explicit  complex_dyn( allocator_type const &a = allocator_type() )
+        : complex_dyn( 0u, a )
+    {}
+    /** \brief  Create a zero value of the given rank.
+        \param[in] rank  The Cayley-Dickson construction level.
+        \param[in] a     The allocator to use.
+        \post  `this->rank() == rank`, and each component is zero.
+     */
+    explicit  complex_dyn( size_type rank, allocator_type const &a =
+     allocator_type() )
+        : alloc( a ), r{ rank }, c{ make_storage() }
+    {}
+    /** \brief  Create a value of the given rank from a list of components.
+        \pre  `list.size() <= (1 << rank)`.
+        \param[in] rank  The Cayley-Dickson construction level.
+        \param[in] list  The leading components; the rest are zero.
+        \param[in] a     The allocator to use.
+     */
+    complex_dyn( size_type rank, std::initializer_list<value_type> list,
+     allocator_type const &a = allocator_type() )
+        : complex_dyn( rank, a )
+    { std::copy( list.begin(), list.end(), c ); }
+    /** \brief  Convert from `complex_it`.
+        \param[in] x  The fixed-rank value.
+        \param[in] a  The allocator to use.
+        \post  `this->rank() == R`, and each component matches.
+     */
+    template < std::size_t R >
+    explicit  complex_dyn( complex_it<Number, R> const &x, allocator_type const
+     &a = allocator_type() )
+        : complex_dyn( R, a )
+    { std::copy( math::begin(x), math::end(x), c ); }
+    /** \brief  Convert from `complex_rt`.
+        \param[in] x  The fixed-rank value.
+        \param[in] a  The allocator to use.
+        \post  `this->rank() == R`, and each component matches.
+     */
+    template < std::size_t R >
+    explicit  complex_dyn( complex_rt<Number, R> const &x, allocator_type const
+     &a = allocator_type() )
+        : complex_dyn( R, a )
+    { std::copy( math::begin(x), math::end(x), c ); }
+    //! Copy, with the allocator the copy-construction traits pick.
+    complex_dyn( complex_dyn const &other )
+        : complex_dyn( other,
+          traits_type::select_on_container_copy_construction(other.alloc) )
+    {}
+    //! Copy, with the given allocator.
+    complex_dyn( complex_dyn const &other, allocator_type const &a )
+        : complex_dyn( other.r, a )
+    { std::copy( other.begin(), other.end(), c ); }
+    /** \brief  Take over another object's storage.
+        \post  `other` is a zero of rank 0, held in its own inline slot, so it
+               can still be read, written, assigned to, or swapped.
+     */
+    complex_dyn( complex_dyn &&other ) noexcept
+        : alloc( std::move(other.alloc) ), r{ other.r }, c{ other.c }
+    {
+        if ( other.is_inline() )
+        {
+            z = std::move( other.z );
+            c = &z;
+        }
+        other.r = 0u;
+        other.c = &other.z;
+        other.z = value_type{};
+    }
+    //! Give back the storage.
+    ~complex_dyn()  { free_storage(); }
+
+    /** \brief  Copy-assignment
+    The storage is reused when the ranks match; the allocator stays.
+     */
+    complex_dyn &  operator =( complex_dyn const &other )
+    {
+        if ( this != &other )
+        {
+            if ( r != other.r )
+            {
+                complex_dyn  temp( other, alloc );
+
+                swap_storage( temp );
+            }
+            else
+                std::copy( other.begin(), other.end(), c );
+        }
+        return *this;
+    }
+    /** \brief  Move-assignment
+    The storage is taken over when the allocators are equal; otherwise, this
+    copies.
+     */
+    complex_dyn &  operator =( complex_dyn &&other )
+    {
+        if ( alloc == other.alloc )
+            swap_storage( other );
+        else
+            operator =( static_cast<complex_dyn const &>(other) );
+        return *this;
+    }
+
+    // Conversions
+    /** \brief  Convert to `complex_it`.
+        \pre  `this->rank() <= R`.
+        \returns  This value, padded with zeros.
+     */
+    template < std::size_t R >
+    explicit  operator complex_it<Number, R>() const
+    {
+        complex_it<Number, R>  result{};
+
+        std::copy( begin(), end(), math::begin(result) );
+        return result;
+    }
+    /** \brief  Convert to `complex_rt`.
+        \pre  `this->rank() <= R`.
+        \returns  This value, padded with zeros.
+     */
+    template < std::size_t R >
+    explicit  operator complex_rt<Number, R>() const
+    {
+        complex_rt<Number, R>  result{};
+        auto                   rb = math::begin( result );
+
+        for ( auto const &cc : *this )
+            *rb++ = cc;
+        return result;
+    }
+    //! \copydoc  #boost::math::complex_it::operator bool()const
+    explicit  operator bool() const
+    {
+        return std::any_of( begin(), end(), []( value_type const &x ){ return
+         static_cast<bool>(x); } );
+    }
+
+    // Sizing
+    //! \returns  The Cayley-Dickson construction level.
+    auto  rank() const noexcept -> size_type  { return r; }
+    //! \returns  The total number of components, `2 ^ rank()`.
+    auto  size() const noexcept -> size_type  { return size_type( 1u ) << r; }
+
+    // Component(s) access
+    /** \brief  Access to component data.
+        \pre  *i* \< #size()
+        \param[in] i  The index of the selected component.
+        \returns  A reference to the given component.
+     */
+    auto  operator []( size_type i ) const noexcept -> value_type const &
+    { return c[i]; }
+    //! \overload
+    auto  operator []( size_type i ) noexcept -> value_type &  { return c[i]; }
+
+    //! \returns  `(*this)[0]`.
+    auto  real() const -> value_type  { return c[0]; }
+    //! \post  `(*this)[0] == r`.
+    void  real( value_type const &r )  { c[0] = r; }
+    //! \returns  `(*this)[1]`, or zero when #rank() is 0.
+    auto  imag() const -> value_type  { return r ? c[1] : value_type{}; }
+
+    //! \returns  The start of the components.
+    auto  begin() noexcept -> iterator  { return c; }
+    //! \overload
+    auto  begin() const noexcept -> const_iterator  { return c; }
+    //! \returns  The end of the components.
+    auto  end() noexcept -> iterator  { return c + size(); }
+    //! \overload
+    auto  end() const noexcept -> const_iterator  { return c + size(); }
+
+    //! \returns  A copy of the allocator.
+    auto  get_allocator() const -> allocator_type  { return alloc; }
+
+    //! Exchange state with another object that has an equal allocator.
+    void  swap( complex_dyn &other ) noexcept  { swap_storage( other ); }
+
+private:
+    auto  make_storage() -> value_type *
+    {
+        size_type const     n = size();
+        value_type * const  p = traits_type::allocate( alloc, n );
+        size_type           k = 0u;
+
+        try
+        {
+            for ( ; k < n ; ++k )
+                traits_type::construct( alloc, p + k );
+        }
+        catch ( ... )
+        {
+            while ( k-- )
+                traits_type::destroy( alloc, p + k );
+            traits_type::deallocate( alloc, p, n );
+            throw;
+        }
+        return p;
+    }
+    auto  is_inline() const noexcept -> bool  { return c == &z; }
+    void  free_storage() noexcept
+    {
+        if ( !is_inline() )
+        {
+            for ( auto &cc : *this )
+                traits_type::destroy( alloc, &cc );
+            traits_type::deallocate( alloc, c, size() );
+            c = &z;
+        }
+    }
+    // An inline slot has to stay with its object, so its value moves instead.
+    void  swap_storage( complex_dyn &other ) noexcept
+    {
+        bool const  mine = is_inline(), theirs = other.is_inline();
+
+        std::swap( r, other.r );
+        std::swap( c, other.c );
+        std::swap( z, other.z );
+        if ( mine )
+            other.c = &other.z;
+        if ( theirs )
+            c = &z;
+    }
+
+    // Member data
+    allocator_type  alloc;
+    size_type       r;
+    value_type *    c;
+    value_type      z{};  // the component of a moved-from (rank 0) object
+};
+
+
+//  Object support functions  ------------------------------------------------//
+
+/** \brief  Swap
+
+Exchanges the state of two objects.
+
+    \relates  #boost::math::complex_dyn
+
+    \pre  The objects' allocators are equal.
+
+    \param[in,out] a  The first object to be swapped.
+    \param[in,out] b  The second object to be swapped.
+ */
+template < typename T, class A >
+inline
+void  swap( complex_dyn<T, A> &a, complex_dyn<T, A> &b ) noexcept
+{ a.swap( b ); }
+
+/** \brief  Start of component iteration
+
+    \relatesalso  #boost::math::complex_dyn
+
+    \param[in] c  The object to iterate over.
+
+    \returns  `c.begin()`.
+ */
+template < typename T, class A >
+inline
+auto  begin( complex_dyn<T, A> const &c ) noexcept -> T const *
+{ return c.begin(); }
+
+//! \overload
+template < typename T, class A >
+inline
+auto  begin( complex_dyn<T, A> &c ) noexcept -> T *
+{ return c.begin(); }
+
+/** \brief  End of component iteration
+
+    \relatesalso  #boost::math::complex_dyn
+
+    \param[in] c  The object to iterate over.
+
+    \returns  `c.end()`.
+ */
+template < typename T, class A >
+inline
+auto  end( complex_dyn<T, A> const &c ) noexcept -> T const *
+{ return c.end(); }
+
+//! \overload
+template < typename T, class A >
+inline
+auto  end( complex_dyn<T, A> &c ) noexcept -> T *
+{ return c.end(); }
+
+
+//  Equality operators  ------------------------------------------------------//
+
+/** \brief  Equality comparison
+
+    \relates  #boost::math::complex_dyn
+
+    \param l  The left-side argument.
+    \param r  The right-side argument.
+
+    \returns  Whether every component in *l* equals the corresponding one in
+              *r*, with the excess components of the longer object all zero.
+ */
+template < typename T, class A >
+bool  operator ==( complex_dyn<T, A> const &l, complex_dyn<T, A> const &r )
+{
+    auto const  n = std::min( l.size(), r.size() );
+    auto const  nonzero = []( T const &x ){ return static_cast<bool>(x); };
+
+    return std::equal( l.begin(), l.begin() + n, r.begin() ) && std::none_of(
+     l.begin() + n, l.end(), nonzero ) && std::none_of( r.begin() + n, r.end(),
+     nonzero );
+}
+
+/** \overload
+    \relates  #boost::math::complex_dyn
+ */
+template < typename T, class A >
+bool  operator ==( complex_dyn<T, A> const &l, T const &r )
+{
+    return l[ 0 ] == r && std::none_of( l.begin() + 1, l.end(), [](T const &x){
+     return static_cast<bool>(x); } );
+}
+
+/** \overload
+    \relates  #boost::math::complex_dyn
+ */
+template < typename T, class A >
+inline
+bool  operator ==( T const &l, complex_dyn<T, A> const &r )
+{ return r == l; }
+
+/** \brief  Inequality comparison
+
+    \relates  #boost::math::complex_dyn
+
+    \param l  The left-side argument.
+    \param r  The right-side argument.
+
+    \returns  `!(l == r)`.
+ */
+template < typename T, class A >
+inline
+bool  operator !=( complex_dyn<T, A> const &l, complex_dyn<T, A> const &r )
+{ return not operator ==(l, r); }
+
+/** \overload
+    \relates  #boost::math::complex_dyn
+ */
+template < typename T, class A >
+inline
+bool  operator !=( complex_dyn<T, A> const &l, T const &r )
+{ return not operator ==(l, r); }
+
+/** \overload
+    \relates  #boost::math::complex_dyn
+ */
+template < typename T, class A >
+inline
+bool  operator !=( T const &l, complex_dyn<T, A> const &r )
+{ return not operator ==(l, r); }
+
+
+//  Input/output operators  --------------------------------------------------//
+
+/** \brief  Output-streaming
+
+Writes the same text as a `complex_it` of the same rank: just the real
+component for rank 0, otherwise a parenthesized comma-separated list.
+
+    \relatesalso  #boost::math::complex_dyn
+
+    \param[in,out] o  The stream to send the output
+    \param[in]     x  The complex number to be written
+
+    \returns  `o`
+ */
+template < typename Ch, class Tr, typename T, class A >
+std::basic_ostream<Ch, Tr> &
+operator <<( std::basic_ostream<Ch, Tr> &o, complex_dyn<T, A> const &x )
+{
+    if ( !x.rank() )
+        return o << x[0];
+
+    std::basic_ostringstream<Ch, Tr>  s;
+    auto                              b = x.begin();
+
+    s.flags( o.flags() );
+    s.imbue( o.getloc() );
+    s.precision( o.precision() );
+    s << '(' << *b++;
+    while ( x.end() != b )
+        s << ',' << *b++;
+    s << ')';
+    return o << s.str();
+}
+
+
+//  Addition and subtraction operators  --------------------------------------//
+
+/** \brief  Identity operator
+
+    \relates  #boost::math::complex_dyn
+
+    \param[in] x  The input value.
+
+    \returns  A copy of `x`.
+ */
+template < typename T, class A >
+inline
+auto  operator +( complex_dyn<T, A> const &x ) -> complex_dyn<T, A>
+{ return x; }
+
+/** \brief  Negation operator
+
+    \relates  #boost::math::complex_dyn
+
+    \param[in] x  The input value.
+
+    \returns  The additive inverse of `x`.
+ */
+template < typename T, class A >
+auto  operator -( complex_dyn<T, A> const &x ) -> complex_dyn<T, A>
+{
+    complex_dyn<T, A>  result( x.rank(), x.get_allocator() );
+
+    std::transform( x.begin(), x.end(), result.begin(), [](T const &xx){ return
+     -xx; } );
+    return result;
+}
+
+/** \brief  Addition-assignment
+
+    \relates  #boost::math::complex_dyn
+
+    \param[in,out] augend_sum  The first term, and the place for the sum.  It
+                               is promoted first if `addend` has a higher rank.
+    \param[in]     addend      The second term.
+
+    \returns  A reference to `augend_sum`.
+ */
+template < typename T, class A >
+auto  operator +=( complex_dyn<T, A> &augend_sum, complex_dyn<T, A> const
+ &addend ) -> complex_dyn<T, A> &
+{
+    if ( augend_sum.rank() < addend.rank() )
+    {
+        complex_dyn<T, A>  sum( addend, augend_sum.get_allocator() );
+
+        std::transform( augend_sum.begin(), augend_sum.end(), addend.begin(),
+         sum.begin(), []( T const &a, T const &b ){ return a + b; } );
+        augend_sum = std::move( sum );
+    }
+    else
+        std::transform( addend.begin(), addend.end(), augend_sum.begin(),
+         augend_sum.begin(), []( T const &b, T const &a ){ return a + b; } );
+    return augend_sum;
+}
+
+/** \overload
+    \relates  #boost::math::complex_dyn
+ */
+template < typename T, class A >
+inline
+auto  operator +=( complex_dyn<T, A> &augend_sum, T const &addend )
+ -> complex_dyn<T, A> &
+{
+    augend_sum[ 0 ] += addend;
+    return augend_sum;
+}
+
+/** \brief  Subtraction-assignment
+
+    \relates  #boost::math::complex_dyn
+
+    \param[in,out] minuend_difference  The value to be subtracted from, and the
+                                       place for the difference.  It is
+                                       promoted first if `subtrahend` has a
+                                       higher rank.
+    \param[in]     subtrahend          The value to subtract.
+
+    \returns  A reference to `minuend_difference`.
+ */
+template < typename T, class A >
+auto  operator -=( complex_dyn<T, A> &minuend_difference, complex_dyn<T, A>
+ const &subtrahend ) -> complex_dyn<T, A> &
+{
+    if ( minuend_difference.rank() < subtrahend.rank() )
+    {
+        complex_dyn<T, A>  difference( subtrahend.rank(),
+         minuend_difference.get_allocator() );
+
+        std::copy( minuend_difference.begin(), minuend_difference.end(),
+         difference.begin() );
+        minuend_difference = std::move( difference );
+    }
+    std::transform( subtrahend.begin(), subtrahend.end(),
+     minuend_difference.begin(), minuend_difference.begin(), []( T const &s, T
+     const &m ){ return m - s; } );
+    return minuend_difference;
+}
+
+/** \overload
+    \relates  #boost::math::complex_dyn
+ */
+template < typename T, class A >
+inline
+auto  operator -=( complex_dyn<T, A> &minuend_difference, T const &subtrahend )
+ -> complex_dyn<T, A> &
+{
+    minuend_difference[ 0 ] -= subtrahend;
+    return minuend_difference;
+}
+
+/** \brief  Addition
+
+    \relates  #boost::math::complex_dyn
+
+    \param[in] augend  The first term.
+    \param[in] addend  The second term.
+
+    \returns  The sum, at the higher of the two ranks.
+ */
+template < typename T, class A >
+inline
+auto  operator +( complex_dyn<T, A> const &augend, complex_dyn<T, A> const
+ &addend ) -> complex_dyn<T, A>
+{
+    complex_dyn<T, A>  sum( augend );
+
+    sum += addend;
+    return sum;
+}
+
+/** \overload
+    \relates  #boost::math::complex_dyn
+ */
+template < typename T, class A >
+inline
+auto  operator +( complex_dyn<T, A> const &augend, T const &addend )
+ -> complex_dyn<T, A>
+{
+    complex_dyn<T, A>  sum( augend );
+
+    sum += addend;
+    return sum;
+}
+
+/** \overload
+    \relates  #boost::math::complex_dyn
+ */
+template < typename T, class A >
+inline
+auto  operator +( T const &augend, complex_dyn<T, A> const &addend )
+ -> complex_dyn<T, A>
+{
+    complex_dyn<T, A>  sum( addend );
+
+    sum[ 0 ] = augend + sum[ 0 ];
+    return sum;
+}
+
+/** \brief  Subtraction
+
+    \relates  #boost::math::complex_dyn
+
+    \param[in] minuend     The value to be subtracted from.
+    \param[in] subtrahend  The value to subtract.
+
+    \returns  The difference, at the higher of the two ranks.
+ */
+template < typename T, class A >
+inline
+auto  operator -( complex_dyn<T, A> const &minuend, complex_dyn<T, A> const
+ &subtrahend ) -> complex_dyn<T, A>
+{
+    complex_dyn<T, A>  difference( minuend );
+
+    difference -= subtrahend;
+    return difference;
+}
+
+/** \overload
+    \relates  #boost::math::complex_dyn
+ */
+template < typename T, class A >
+inline
+auto  operator -( complex_dyn<T, A> const &minuend, T const &subtrahend )
+ -> complex_dyn<T, A>
+{
+    complex_dyn<T, A>  difference( minuend );
+
+    difference -= subtrahend;
+    return difference;
+}
+
+/** \overload
+    \relates  #boost::math::complex_dyn
+ */
+template < typename T, class A >
+inline
+auto  operator -( T const &minuend, complex_dyn<T, A> const &subtrahend )
+ -> complex_dyn<T, A>
+{
+    auto  difference = -subtrahend;
+
+    difference[ 0 ] += minuend;
+    return difference;
+}
+
+
+//  Conjugation and component functions  -------------------------------------//
+
+/** \brief  Conjugation
+
+    \relatesalso  #boost::math::complex_dyn
+
+    \param[in] x  The input value.
+
+    \returns  `x` with all but its real component negated.
+ */
+template < typename T, class A >
+auto  conj( complex_dyn<T, A> const &x ) -> complex_dyn<T, A>
+{
+    auto  result = -x;
+
+    result[ 0 ] = x[ 0 ];
+    return result;
+}
+
+/** \brief  Conjugation, in operator form
+
+    \relates  #boost::math::complex_dyn
+
+    \param[in] x  The input value.
+
+    \returns  `conj( x )`.
+ */
+template < typename T, class A >
+inline
+auto  operator ~( complex_dyn<T, A> const &x ) -> complex_dyn<T, A>
+{ return conj( x ); }
+
+/** \brief  Real part
+
+    \relatesalso  #boost::math::complex_dyn
+
+    \param[in] x  The input value.
+
+    \returns  `x.real()`.
+ */
+template < typename T, class A >
+inline
+auto  real( complex_dyn<T, A> const &x ) -> T
+{ return x.real(); }
+
+/** \brief  Imaginary part
+
+    \relatesalso  #boost::math::complex_dyn
+
+    \param[in] x  The input value.
+
+    \returns  `x.imag()`.
+ */
+template < typename T, class A >
+inline
+auto  imag( complex_dyn<T, A> const &x ) -> T
+{ return x.imag(); }
+
+/** \brief  Unreal part
+
+    \relatesalso  #boost::math::complex_dyn
+
+    \param[in] x  The input value.
+
+    \returns  `x` with its real component zeroed.
+ */
+template < typename T, class A >
+auto  unreal( complex_dyn<T, A> const &x ) -> complex_dyn<T, A>
+{
+    complex_dyn<T, A>  result( x );
+
+    result[ 0 ] = T{};
+    return result;
+}
+
+
+//  Multiplication and division operators  -----------------------------------//
+
+/** \brief  Multiplication, scalar
+
+    \relates  #boost::math::complex_dyn
+
+    \param[in] multiplicand  The hypercomplex factor.
+    \param[in] multiplier    The real factor.
+
+    \returns  `multiplicand` with each component scaled.
+ */
+template < typename T, class A >
+auto  operator *( complex_dyn<T, A> const &multiplicand, T const &multiplier )
+ -> complex_dyn<T, A>
+{
+    complex_dyn<T, A>  product( multiplicand.rank(),
+     multiplicand.get_allocator() );
+
+    std::transform( multiplicand.begin(), multiplicand.end(), product.begin(),
+     [&multiplier]( T const &x ){ return x * multiplier; } );
+    return product;
+}
+
+/** \overload
+    \relates  #boost::math::complex_dyn
+ */
+template < typename T, class A >
+auto  operator *( T const &multiplicand, complex_dyn<T, A> const &multiplier )
+ -> complex_dyn<T, A>
+{
+    complex_dyn<T, A>  product( multiplier.rank(), multiplier.get_allocator() );
+
+    std::transform( multiplier.begin(), multiplier.end(), product.begin(),
+     [&multiplicand]( T const &x ){ return multiplicand * x; } );
+    return product;
+}
+
+/** \brief  Multiplication, Cayley
+
+Gives the same results as the `complex_it` operator, at the higher of the two
+ranks, through the non-recursive loop engine.
+
+    \relates  #boost::math::complex_dyn
+
+    \see  #boost::math::operator*(complex_it<T,R>const&,complex_it<U,S>const&)
+
+    \param[in] multiplicand  The first factor.
+    \param[in] multiplier    The second factor.
+
+    \returns  The product of `multiplicand` and `multiplier`.
+ */
+template < typename T, class A >
+auto  operator *( complex_dyn<T, A> const &multiplicand, complex_dyn<T, A>
+ const &multiplier ) -> complex_dyn<T, A>
+{
+    complex_dyn<T, A>  product( std::max(multiplicand.rank(),
+     multiplier.rank()), multiplicand.get_allocator() );
+
+    detail::dyn_cayley_product<false>( product.rank(), product.begin(),
+     multiplicand.begin(), multiplicand.size(), multiplier.begin(),
+     multiplier.size() );
+    return product;
+}
+
+/** \brief  Multiplication-assignment
+
+    \relates  #boost::math::complex_dyn
+
+    \param[in,out] multiplicand_product  The first factor, and the place for the
+                                         product.
+    \param[in]     multiplier            The second factor.
+
+    \returns  A reference to `multiplicand_product`.
+ */
+template < typename T, class A >
+inline
+auto  operator *=( complex_dyn<T, A> &multiplicand_product, complex_dyn<T, A>
+ const &multiplier ) -> complex_dyn<T, A> &
+{ return multiplicand_product = multiplicand_product * multiplier; }
+
+/** \overload
+    \relates  #boost::math::complex_dyn
+ */
+template < typename T, class A >
+auto  operator *=( complex_dyn<T, A> &multiplicand_product, T const
+ &multiplier ) -> complex_dyn<T, A> &
+{
+    for ( auto &x : multiplicand_product )
+        x *= multiplier;
+    return multiplicand_product;
+}
+
+/** \brief  Division, scalar
+
+    \relates  #boost::math::complex_dyn
+
+    \pre  `divisor` is *not* zero.
+
+    \param[in] dividend  The hypercomplex value to be divided.
+    \param[in] divisor   The real value to divide by.
+
+    \returns  `dividend` with each component divided.
+ */
+template < typename T, class A >
+auto  operator /( complex_dyn<T, A> const &dividend, T const &divisor )
+ -> complex_dyn<T, A>
+{
+    complex_dyn<T, A>  quotient( dividend.rank(), dividend.get_allocator() );
+
+    std::transform( dividend.begin(), dividend.end(), quotient.begin(),
+     [&divisor]( T const &x ){ return x / divisor; } );
+    return quotient;
+}
+
+/** \brief  Division, Cayley
+
+Right division, as `complex_it` does it: the dividend is multiplied by the
+divisor's conjugate (folded into the product loop), then each component is
+divided by the divisor's norm.  If the norm or a product component leaves the
+normal range, the quotient is redone with the divisor first scaled down by its
+largest component.
+
+    \relates  #boost::math::complex_dyn
+
+    \see  #boost::math::operator/(complex_it<T,R>const&,complex_it<U,S>const&)
+
+    \pre  `divisor` is *not* zero.
+
+    \param[in] dividend  The value to be divided.
+    \param[in] divisor   The value to divide by.
+
+    \returns  The quotient, at the higher of the two ranks.
+ */
+template < typename T, class A >
+auto  operator /( complex_dyn<T, A> const &dividend, complex_dyn<T, A> const
+ &divisor ) -> complex_dyn<T, A>
+{
+    typedef std::integral_constant<bool, std::numeric_limits<T>::is_integer>
+      is_integer;
+
+    complex_dyn<T, A>  quotient( std::max(dividend.rank(), divisor.rank()),
+     dividend.get_allocator() );
+
+    detail::dyn_cayley_product<true>( quotient.rank(), quotient.begin(),
+     dividend.begin(), dividend.size(), divisor.begin(), divisor.size() );
+    if ( !detail::dyn_scale_quotient(quotient.begin(), quotient.end(), norm(
+     divisor ), is_integer{}) )
+    {
+        // As detail::prescaled_quotient
+        T const     largest = detail::largest_magnitude( divisor );
+        auto const  unit = divisor / largest;
+
+        quotient = dividend * ( conj(unit) / norm(unit) ) / largest;
+    }
+    return quotient;
+}
+
+/** \brief  Division-assignment
+
+    \relates  #boost::math::complex_dyn
+
+    \pre  `divisor` is *not* zero.
+
+    \param[in,out] dividend_quotient  The value to be divided, and the place for
+                                      the quotient.
+    \param[in]     divisor            The value to divide by.
+
+    \returns  A reference to `dividend_quotient`.
+ */
+template < typename T, class A >
+inline
+auto  operator /=( complex_dyn<T, A> &dividend_quotient, complex_dyn<T, A> const
+ &divisor ) -> complex_dyn<T, A> &
+{ return dividend_quotient = dividend_quotient / divisor; }
+
+/** \overload
+    \relates  #boost::math::complex_dyn
+ */
+template < typename T, class A >
+auto  operator /=( complex_dyn<T, A> &dividend_quotient, T const &divisor )
+ -> complex_dyn<T, A> &
+{
+    for ( auto &x : dividend_quotient )
+        x /= divisor;
+    return dividend_quotient;
+}
+
+
+//  Norm functions  ----------------------------------------------------------//
+
+/** \brief  Cayley norm
+
+    \relatesalso  #boost::math::complex_dyn
+
+    \param[in] x  The input value.
+
+    \returns  The sum of the squares of the components.
+ */
+template < typename T, class A >
+inline
+auto  norm( complex_dyn<T, A> const &x )
+ -> decltype( std::declval<T>() * std::declval<T>() )
+{ return std::inner_product( x.begin(), x.end(), x.begin(), decltype(norm(
+ x ))() ); }
+
+/** \brief  Absolute value
+
+    \relatesalso  #boost::math::complex_dyn
+
+    \pre  `sqrt( declval<T>() )` is well-formed, and `sqrt` can be found through
+          ADL.
+
+    \param[in] x  The input value.
+
+    \returns  The square root of `norm( x )`.
+ */
+template < typename T, class A >
+inline
+auto  abs( complex_dyn<T, A> const &x )
+ -> decltype( sqrt(std::declval<T>() * std::declval<T>()) )
+{
+    using std::sqrt;
+
+    return sqrt( norm(x) );
+}
+
+
+}  // namespace math
+}  // namespace boost
+
+
+#endif // BOOST_MATH_COMPLEX_DYN_HPP
@@ -0,0 +1,846 @@
+//  Boost Complex Numbers, half-width storage header file  -------------------//
+
+//  Copyright 2013 Daryle Walker.
+//  Distributed under the Boost Software License, Version 1.0.  (See the
+//  accompanying file LICENSE_1_0.txt or a copy at
+//  <http://www.boost.org/LICENSE_1_0.txt>.)
+
+//  See <http://www.boost.org/libs/math/> for the library's home page.
+
+/** \file   boost/math/complex_half.hpp
+    \brief  Hypercomplex number sequences stored with 16-bit components.
+
+    \author  Daryle Walker
+
+    \version  0.1
+
+    \copyright  Boost Software License, version 1.0
+
+    Contains the declaration (and definition) of class template
+    `complex_half_vector`, a sequence of `complex_it<float, Rank>` values that
+    keeps each component in 16 bits, either as IEEE 754 binary16 or as
+    bfloat16, halving the memory traffic of `float` storage.  Values are
+    widened to `float` for computation and narrowed (rounding to nearest, ties
+    to even) when stored back.  Bulk conversions use the F16C or AVX-512 BF16
+    instructions when the processor has them.
+
+    \warning  This library requires C++2011 features.
+ */
+
+#ifndef BOOST_MATH_COMPLEX_HALF_HPP
+#define BOOST_MATH_COMPLEX_HALF_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "boost/math/complex.hpp"
+#include "boost/math/complex_it.hpp"
+#include "boost/math/complex_rt.hpp"
+
+#if BOOST_MATH_COMPLEX_SIMD_DISPATCH
+#include <immintrin.h>
+#endif
+
+
+// Flag to check if bfloat16 narrowing can dispatch to AVX-512 BF16
+#if BOOST_MATH_COMPLEX_SIMD_DISPATCH && !defined(__clang__) && (__GNUC__ >= 10)
+#define BOOST_MATH_COMPLEX_BF16_DISPATCH  1
+#else
+#define BOOST_MATH_COMPLEX_BF16_DISPATCH  0
+#endif
+/** \def  BOOST_MATH_COMPLEX_BF16_DISPATCH
+    \brief  Flag for run-time selection of AVX-512 BF16 conversions.
+
+    If this pre-processor flag is set to non-zero, then narrowing `float`
+    components to bfloat16 in bulk uses the AVX-512 BF16 conversion instruction
+    when the processor supports it.  That instruction treats subnormal inputs
+    and results as zero; otherwise the results match the portable conversion.
+
+    The flag is set automatically with
+    #BOOST_MATH_COMPLEX_SIMD_DISPATCH, for GCC 10 and later.
+ */
+
+
+namespace boost
+{
+namespace math
+{
+
+
+//  Storage format policies  -------------------------------------------------//
+
+/** \brief  IEEE 754 binary16 ("half precision") component storage
+
+1 sign bit, 5 exponent bits, and 10 fraction bits.  The range reaches 65504,
+with about 3 significant decimal digits.
+ */
+struct binary16_format
+{
+    //! The type of a stored component.
+    typedef std::uint16_t  storage_type;
+
+    /** \brief  Widen a stored component
+
+        \param[in] h  The stored bits.
+
+        \returns  The exact `float` value of `h`.
+     */
+    static  auto  widen( storage_type h ) noexcept -> float
+    {
+        std::uint32_t const  sign = std::uint32_t( h & 0x8000u ) << 16;
+        std::uint32_t const  exponent = ( h >> 10 ) & 0x1Fu;
+        std::uint32_t const  fraction = h & 0x3FFu;
+        std::uint32_t        bits;
+
+        if ( exponent == 0x1Fu )
+            bits = sign | 0x7F800000u | ( fraction << 13 );
+        else if ( exponent )
+            bits = sign | ( (exponent + 112u) << 23 ) | ( fraction << 13 );
+        else
+        {
+            // Zero or subnormal: fraction * 2^-24
+            float const  f = float( fraction ) * 5.9604644775390625e-8f;
+
+            return sign ? -f : f;
+        }
+        return as_float( bits );
+    }
+
+    /** \brief  Narrow a component for storage
+
+        \param[in] f  The value to store.
+
+        \returns  The bits of `f` rounded to the nearest binary16 value, ties
+                  to even.  Values too large become infinities; NaNs stay NaNs.
+     */
+    static  auto  narrow( float f ) noexcept -> storage_type
+    {
+        std::uint32_t  x;
+
+        std::memcpy( &x, &f, sizeof(x) );
+
+        std::uint32_t const  sign = ( x >> 16 ) & 0x8000u;
+
+        x &= 0x7FFFFFFFu;
+        if ( x >= 0x7F800000u )  // infinity or NaN, which is kept quiet
+            return sign | 0x7C00u | ( (x > 0x7F800000u) ? 0x200u | (x >> 13 &
+             0x3FFu) : 0u );
+        if ( x >= 0x477FF000u )  // at least 65520, which rounds up to infinity
+            return sign | 0x7C00u;
+        if ( x >= 0x38800000u )  // normal result
+            return sign | ( (x + 0xFFFu + (x >> 13 & 1u) - 0x38000000u) >> 13 );
+        if ( x < 0x33000000u )   // at most half the least subnormal
+            return sign;
+
+        // Subnormal result, possibly rounding up to the least normal
+        std::uint32_t const  shift = 126u - ( x >> 23 );
+        std::uint32_t const  fraction = ( x & 0x7FFFFFu ) | 0x800000u;
+        std::uint32_t        result = fraction >> shift;
+        std::uint32_t const  rest = fraction & ( (1u << shift) - 1u );
+        std::uint32_t const  half = 1u << ( shift - 1u );
+
+        if ( rest > half || (rest == half && (result & 1u)) )
+            ++result;
+        return sign | result;
+    }
+
+private:
+    static  auto  as_float( std::uint32_t bits ) noexcept -> float
+    {
+        float  result;
+
+        std::memcpy( &result, &bits, sizeof(result) );
+        return result;
+    }
+};
+
+/** \brief  bfloat16 ("brain floating point") component storage
+
+The upper half of a `float`: 1 sign bit, 8 exponent bits, and 7 fraction bits.
+The range matches `float`, with about 2 significant decimal digits.
+ */
+struct bfloat16_format
+{
+    //! The type of a stored component.
+    typedef std::uint16_t  storage_type;
+
+    /** \brief  Widen a stored component
+
+        \param[in] h  The stored bits.
+
+        \returns  The exact `float` value of `h`.
+     */
+    static  auto  widen( storage_type h ) noexcept -> float
+    {
+        std::uint32_t const  bits = std::uint32_t( h ) << 16;
+        float                result;
+
+        std::memcpy( &result, &bits, sizeof(result) );
+        return result;
+    }
+
+    /** \brief  Narrow a component for storage
+
+        \param[in] f  The value to store.
+
+        \returns  The bits of `f` rounded to the nearest bfloat16 value, ties to
+                  even.  NaNs stay NaNs.
+     */
+    static  auto  narrow( float f ) noexcept -> storage_type
+    {
+        std::uint32_t  x;
+
+        std::memcpy( &x, &f, sizeof(x) );
+        if ( (x & 0x7FFFFFFFu) > 0x7F800000u )
+            return ( x >> 16 ) | 0x40u;
+        return ( x + 0x7FFFu + (x >> 16 & 1u) ) >> 16;
+    }
+};
+
+
+//  Bulk conversion functions  -----------------------------------------------//
+
+//! \cond
+namespace detail
+{
+    // Portable bulk conversions, through the vector-extension dispatcher
+    template < class Format >
+    struct half_widen_body
+    {
+        typename Format::storage_type const *  in;
+        float *                                out;
+
+        void  operator ()( std::size_t i ) const
+        { out[ i ] = Format::widen( in[i] ); }
+    };
+
+    template < class Format >
+    struct half_narrow_body
+    {
+        float const *                    in;
+        typename Format::storage_type *  out;
+
+        void  operator ()( std::size_t i ) const
+        { out[ i ] = Format::narrow( in[i] ); }
+    };
+
+#if BOOST_MATH_COMPLEX_SIMD_DISPATCH
+    // Whether F16C (with the AVX registers it uses) is available
+    inline
+    auto  has_f16c() -> bool
+    {
+        static bool const  result = []() -> bool {
+            __builtin_cpu_init();
+            return __builtin_cpu_supports( "avx" ) && __builtin_cpu_supports(
+             "f16c" );
+        }();
+
+        return result;
+    }
+
+    __attribute__(( target("avx,f16c") ))
+    inline
+    void  widen_binary16_f16c( std::uint16_t const *in, float *out, std::size_t
+     n )
+    {
+        std::size_t  i = 0u;
+
+        for ( ; i + 8u <= n ; i += 8u )
+            _mm256_storeu_ps( out + i, _mm256_cvtph_ps(_mm_loadu_si128(
+             reinterpret_cast<__m128i const *>(in + i) )) );
+        for ( ; i < n ; ++i )
+            out[ i ] = binary16_format::widen( in[i] );
+    }
+
+    __attribute__(( target("avx,f16c") ))
+    inline
+    void  narrow_binary16_f16c( float const *in, std::uint16_t *out, std::size_t
+     n )
+    {
+        std::size_t  i = 0u;
+
+        for ( ; i + 8u <= n ; i += 8u )
+            _mm_storeu_si128( reinterpret_cast<__m128i *>(out + i),
+             _mm256_cvtps_ph(_mm256_loadu_ps( in + i ),
+             _MM_FROUND_TO_NEAREST_INT) );
+        for ( ; i < n ; ++i )
+            out[ i ] = binary16_format::narrow( in[i] );
+    }
+#endif
+
+#if BOOST_MATH_COMPLEX_BF16_DISPATCH
+    // Whether AVX-512 BF16 is available
+    inline
+    auto  has_avx512_bf16() -> bool
+    {
+        static bool const  result = []() -> bool {
+            __builtin_cpu_init();
+            return __builtin_cpu_supports( "avx512bf16" );
+        }();
+
+        return result;
+    }
+
+    __attribute__(( target("avx512f,avx512bf16") ))
+    inline
+    void  narrow_bfloat16_avx512( float const *in, std::uint16_t *out,
+     std::size_t n )
+    {
+        std::size_t  i = 0u;
+
+        for ( ; i + 16u <= n ; i += 16u )
+            _mm256_storeu_si256( reinterpret_cast<__m256i *>(out + i),
+             reinterpret_cast<__m256i>(_mm512_cvtneps_pbh( _mm512_loadu_ps(in +
+             i) )) );
+        for ( ; i < n ; ++i )
+            out[ i ] = bfloat16_format::narrow( in[i] );
+    }
+#endif
+
+    // Conversions for any format
+    template < class Format >
+    inline
+    void  widen_components( Format, typename Format::storage_type const *in,
+     float *out, std::size_t n )
+    { batch_dispatch( half_widen_body<Format>{in, out}, n ); }
+
+    template < class Format >
+    inline
+    void  narrow_components( Format, float const *in, typename
+     Format::storage_type *out, std::size_t n )
+    { batch_dispatch( half_narrow_body<Format>{in, out}, n ); }
+
+    // Conversions with dedicated instructions
+    inline
+    void  widen_components( binary16_format, std::uint16_t const *in, float
+     *out, std::size_t n )
+    {
+#if BOOST_MATH_COMPLEX_SIMD_DISPATCH
+        if ( has_f16c() )
+            return widen_binary16_f16c( in, out, n );
+#endif
+        batch_dispatch( half_widen_body<binary16_format>{in, out}, n );
+    }
+
+    inline
+    void  narrow_components( binary16_format, float const *in, std::uint16_t
+     *out, std::size_t n )
+    {
+#if BOOST_MATH_COMPLEX_SIMD_DISPATCH
+        if ( has_f16c() )
+            return narrow_binary16_f16c( in, out, n );
+#endif
+        batch_dispatch( half_narrow_body<binary16_format>{in, out}, n );
+    }
+
+    inline
+    void  narrow_components( bfloat16_format, float const *in, std::uint16_t
+     *out, std::size_t n )
+    {
+#if BOOST_MATH_COMPLEX_BF16_DISPATCH
+        if ( has_avx512_bf16() )
+            return narrow_bfloat16_avx512( in, out, n );
+#endif
+        batch_dispatch( half_narrow_body<bfloat16_format>{in, out}, n );
+    }
+
+}  // namespace detail
+//! \endcond
+
+/** \brief  Widen stored components to `float`, in bulk
+
+    \pre  [`first`, `last`) is a valid range, and the segment starting at
+          `result` has room for as many values.
+
+    \tparam Format  #boost::math::binary16_format or
+                    #boost::math::bfloat16_format.
+
+    \param[in]  first   The start of the stored components.
+    \param[in]  last    The end of the stored components.
+    \param[out] result  The start of the widened values.
+
+    \returns  The end of the output range.
+ */
+template < class Format >
+inline
+auto  widen_components( typename Format::storage_type const *first, typename
+ Format::storage_type const *last, float *result ) -> float *
+{
+    detail::widen_components( Format{}, first, result, last - first );
+    return result + ( last - first );
+}
+
+/** \brief  Narrow `float` values to stored components, in bulk
+
+    \pre  [`first`, `last`) is a valid range, and the segment starting at
+          `result` has room for as many components.
+
+    \tparam Format  #boost::math::binary16_format or
+                    #boost::math::bfloat16_format.
+
+    \param[in]  first   The start of the values.
+    \param[in]  last    The end of the values.
+    \param[out] result  The start of the stored components.
+
+    \returns  The end of the output range.
+ */
+template < class Format >
+inline
+auto  narrow_components( float const *first, float const *last, typename
+ Format::storage_type *result ) -> typename Format::storage_type *
+{
+    detail::narrow_components( Format{}, first, result, last - first );
+    return result + ( last - first );
+}
+
+
+//  Half-width sequence class template definition  ---------------------------//
+
+/** \brief  A sequence of hypercomplex numbers, stored with 16-bit components
+
+Holds the components of `complex_it<float, Rank>` values interleaved, like a
+`std::vector` of them would, but each in 16 bits as given by `Format`.  Reading
+an element widens it to `float`, and writing one narrows it; the whole-sequence
+operators (`+ - *` and `norm`) widen cache-sized blocks of elements, run the
+batch functions on them, and narrow the results, so only half as many bytes
+cross the memory bus as with `float` storage.
+
+Elements are accessed through proxies that convert to and from `complex_it`
+and `complex_rt` objects.
+
+    \tparam Rank    The Cayley-Dickson construction level.  If not given, it
+                    defaults to 1, in order to model regular complex numbers.
+    \tparam Format  The component encoding, #boost::math::binary16_format (the
+                    default) or #boost::math::bfloat16_format.
+ */
+template < std::size_t Rank = 1u, class Format = binary16_format >
+class complex_half_vector
+{
+public:
+    // Core types
+    //! \copydoc  #boost::math::complex_it::size_type
+    typedef std::size_t                    size_type;
+    //! The type components are computed with.
+    typedef float                          value_type;
+    //! The type components are stored as.
+    typedef typename Format::storage_type  storage_type;
+    //! The component encoding.
+    typedef Format                         format_type;
+    //! The type of an element, when separated from the container.
+    typedef complex_it<float, Rank>        element_type;
+
+    // Sizing parameters
+    //! \copydoc  #boost::math::complex_it::rank
+    static constexpr  size_type  rank = Rank;
+    //! The number of components per element.
+    static constexpr  size_type  static_size = element_type::static_size;
+
+    /** \brief  Mutable access to one element
+
+    Refers to the stored components of one element.  It converts to an element
+    (or `complex_rt`) value, and assigning to it narrows the value into the
+    storage.
+     */
+    class reference
+    {
+    public:
+        //! Read the element.
+        operator element_type() const
+        {
+            element_type  result;
+
+            for ( size_type k = 0u ; k < static_size ; ++k )
+                result[ k ] = Format::widen( p[k] );
+            return result;
+        }
+        //! Read the element, in recursive form.
+        operator complex_rt<float, Rank>() const
+        { return complex_rt<float, Rank>( static_cast<element_type>(*this) ); }
+
+        //! Write the element.
+        auto  operator =( element_type const &x ) -> reference &
+        {
+            for ( size_type k = 0u ; k < static_size ; ++k )
+                p[ k ] = Format::narrow( x[k] );
+            return *this;
+        }
+        //! \overload
+        auto  operator =( complex_rt<float, Rank> const &x ) -> reference &
+        { return *this = static_cast<element_type>( x ); }
+        //! Copy another element's value, not the reference.
+        auto  operator =( reference const &x ) -> reference &
+        {
+            std::copy( x.p, x.p + static_size, p );
+            return *this;
+        }
+
+        /** \brief  Stored component access
+            \pre  *k* \< #static_size
+            \param[in] k  The index of the selected component.
+            \returns  The stored bits of component `k`.
+         */
+        auto  operator []( size_type k ) const -> storage_type &
+        { return p[ k ]; }
+
+    private:
+        friend class complex_half_vector;
+
+        explicit  reference( storage_type *components ) noexcept
+            : p{ components }
+        {}
+
+        storage_type *  p;
+    };
+
+    // Lifetime management
+    //! Create an empty sequence.
+    complex_half_vector() = default;
+    /** \brief  Create a sequence of zeros.
+        \param[in] n  The number of elements.
+        \post  `this->size() == n`, and each element is zero.
+     */
+    explicit  complex_half_vector( size_type n )
+        : c( n * static_size )
+    {}
+    /** \brief  Create a sequence from a range of elements.
+
+    Each element is narrowed into the storage; both `complex_it<float, Rank>`
+    and `complex_rt<float, Rank>` elements are accepted.  An array segment of
+    `complex_it<float, Rank>` is narrowed in bulk.
+
+        \param[in] first  The start of the elements.
+        \param[in] last   The end of the elements.
+        \post  `this->size() == std::distance(first, last)`.
+     */
+    template < typename InputIt >
+    complex_half_vector( InputIt first, InputIt last )
+    {
+        assign_range( first, last, std::integral_constant<bool,
+         std::is_convertible<InputIt, element_type const *>::value>{} );
+    }
+    //! Create a sequence from a list of elements.
+    complex_half_vector( std::initializer_list<element_type> list )
+        : complex_half_vector( list.begin(), list.end() )
+    {}
+
+    // Size inspection and control
+    //! \returns  The number of elements.
+    auto  size() const noexcept -> size_type  { return c.size() / static_size; }
+    //! \returns  `this->size() == 0`.
+    auto  empty() const noexcept -> bool  { return c.empty(); }
+    //! Reserve room for `n` elements.
+    void  reserve( size_type n )  { c.reserve( n * static_size ); }
+    //! Change the number of elements, with new ones being zero.
+    void  resize( size_type n )  { c.resize( n * static_size ); }
+    //! Remove all elements.
+    void  clear() noexcept  { c.clear(); }
+    /** \brief  Append an element.
+        \param[in] x  The element to add, as a `complex_it` or `complex_rt`.
+        \post  `(*this)[this->size() - 1]` is `x`, narrowed.
+     */
+    template < class Element >
+    void  push_back( Element const &x )
+    {
+        for ( size_type k = 0u ; k < static_size ; ++k )
+            c.push_back( Format::narrow(x[ k ]) );
+    }
+
+    // Element and storage access
+    /** \brief  Element access
+        \pre  *i* \< `this->size()`.
+        \param[in] i  The index of the selected element.
+        \returns  A proxy for the element (or a widened copy of it, for `const`
+                  containers).
+     */
+    auto  operator []( size_type i ) noexcept -> reference
+    { return reference{ c.data() + i * static_size }; }
+    //! \overload
+    auto  operator []( size_type i ) const -> element_type
+    {
+        element_type  result;
+
+        for ( size_type k = 0u ; k < static_size ; ++k )
+            result[ k ] = Format::widen( c[i * static_size + k] );
+        return result;
+    }
+
+    /** \brief  Storage access
+        \returns  The start of the stored components, element by element.
+     */
+    auto  data() noexcept -> storage_type *  { return c.data(); }
+    //! \overload
+    auto  data() const noexcept -> storage_type const *  { return c.data(); }
+
+    /** \brief  Copy out a segment of the elements, widened.
+
+        \pre  `first + count <= this->size()`, and the array segment starting
+              at `result` has room for `count` elements.
+        \param[in]  first   The index of the first element to copy.
+        \param[in]  count   The number of elements to copy.
+        \param[out] result  The start of the output numbers.
+        \returns  The end of the output range.
+     */
+    auto  load( size_type first, size_type count, element_type *result ) const
+     -> element_type *
+    {
+        auto const  scalars = as_scalars( result, result + count );
+
+        detail::widen_components( Format{}, c.data() + first * static_size,
+         scalars.first, scalars.second - scalars.first );
+        return result + count;
+    }
+    /** \brief  Copy out the elements, widened.
+
+        \pre  The array segment starting at `result` has room for
+              `this->size()` elements.
+        \param[out] result  The start of the output numbers.
+        \returns  The end of the output range.
+     */
+    auto  copy_to( element_type *result ) const -> element_type *
+    { return load( 0u, size(), result ); }
+    /** \brief  Overwrite a segment of the elements, narrowed.
+
+        \pre  [`first`, `last`) is a valid range, and `position + (last -
+              first) <= this->size()`.
+        \param[in] first     The start of the input numbers.
+        \param[in] last      The end of the input numbers.
+        \param[in] position  The index of the first element to overwrite.
+     */
+    void  store( element_type const *first, element_type const *last,
+     size_type position )
+    {
+        auto const  scalars = as_scalars( first, last );
+
+        detail::narrow_components( Format{}, scalars.first, c.data() + position
+         * static_size, scalars.second - scalars.first );
+    }
+
+    //! Exchange state with another sequence.
+    void  swap( complex_half_vector &other ) noexcept  { c.swap( other.c ); }
+
+private:
+    template < typename InputIt >
+    void  assign_range( InputIt first, InputIt last, std::false_type )
+    {
+        for ( ; first != last ; ++first )
+            push_back( *first );
+    }
+    void  assign_range( element_type const *first, element_type const *last,
+     std::true_type )
+    {
+        resize( last - first );
+        store( first, last, 0u );
+    }
+
+    // Member data
+    std::vector<storage_type>  c;
+};
+
+/** Gives access to a template parameter.
+ */
+template < std::size_t Rank, class Format >
+constexpr
+typename complex_half_vector<Rank, Format>::size_type
+  complex_half_vector<Rank, Format>::rank;
+
+/** Matches `complex_it<float, Rank>`.
+ */
+template < std::size_t Rank, class Format >
+constexpr
+typename complex_half_vector<Rank, Format>::size_type
+  complex_half_vector<Rank, Format>::static_size;
+
+
+//  Object support functions  ------------------------------------------------//
+
+/** \brief  Swap
+
+Exchanges the state of two sequences.
+
+    \relates  #boost::math::complex_half_vector
+
+    \param[in,out] a  The first object to be swapped.
+    \param[in,out] b  The second object to be swapped.
+ */
+template < std::size_t R, class F >
+inline
+void  swap( complex_half_vector<R, F> &a, complex_half_vector<R, F> &b )
+ noexcept
+{ a.swap( b ); }
+
+
+//  Whole-sequence operators  ------------------------------------------------//
+
+//! \cond
+namespace detail
+{
+    // Elements widened at a time; the widened blocks of both operands and the
+    // result stay within the L1 cache.
+    constexpr std::size_t  half_block_components = 2048u;
+
+    // Widen blocks of two sequences, combine them with the given batch
+    // function, and narrow each block of results.
+    template < std::size_t R, class F, class Batch >
+    auto  half_blockwise( complex_half_vector<R, F> const &a,
+     complex_half_vector<R, F> const &b, Batch batch )
+     -> complex_half_vector<R, F>
+    {
+        typedef complex_it<float, R>  element_type;
+
+        std::size_t const          n = a.size();
+        std::size_t const          block = std::max<std::size_t>( 1u,
+         half_block_components / element_type::static_size );
+        complex_half_vector<R, F>  result( n );
+        std::vector<element_type>  x( std::min(block, n) ), y( x.size() ),
+                                   z( x.size() );
+
+        for ( std::size_t base = 0u ; base < n ; base += block )
+        {
+            std::size_t const  m = std::min( block, n - base );
+
+            a.load( base, m, x.data() );
+            b.load( base, m, y.data() );
+            batch( x.data(), x.data() + m, y.data(), z.data() );
+            result.store( z.data(), z.data() + m, base );
+        }
+        return result;
+    }
+
+    // Adaptors for the overloaded batch function templates
+    struct half_batch_add
+    {
+        template < typename T >
+        void  operator ()( T const *first1, T const *last1, T const *first2, T
+         *result ) const
+        { batch_add( first1, last1, first2, result ); }
+    };
+
+    struct half_batch_subtract
+    {
+        template < typename T >
+        void  operator ()( T const *first1, T const *last1, T const *first2, T
+         *result ) const
+        { batch_subtract( first1, last1, first2, result ); }
+    };
+
+    struct half_batch_multiply
+    {
+        template < typename T >
+        void  operator ()( T const *first1, T const *last1, T const *first2, T
+         *result ) const
+        { batch_multiply( first1, last1, first2, result ); }
+    };
+
+}  // namespace detail
+//! \endcond
+
+/** \brief  Addition, block-wise
+
+Adds corresponding elements of the given sequences, in `float`, and narrows the
+sums.
+
+    \relates  #boost::math::complex_half_vector
+
+    \pre  `augend.size() == addend.size()`.
+
+    \param[in] augend  The first sequence of terms.
+    \param[in] addend  The second sequence of terms.
+
+    \returns  The sequence of sums.
+ */
+template < std::size_t R, class F >
+inline
+auto  operator +( complex_half_vector<R, F> const &augend,
+ complex_half_vector<R, F> const &addend ) -> complex_half_vector<R, F>
+{ return detail::half_blockwise( augend, addend, detail::half_batch_add{} ); }
+
+/** \brief  Subtraction, block-wise
+
+Subtracts corresponding elements of the given sequences, in `float`, and
+narrows the differences.
+
+    \relates  #boost::math::complex_half_vector
+
+    \pre  `minuend.size() == subtrahend.size()`.
+
+    \param[in] minuend     The sequence of values to be subtracted from.
+    \param[in] subtrahend  The sequence of values to subtract.
+
+    \returns  The sequence of differences.
+ */
+template < std::size_t R, class F >
+inline
+auto  operator -( complex_half_vector<R, F> const &minuend,
+ complex_half_vector<R, F> const &subtrahend ) -> complex_half_vector<R, F>
+{
+    return detail::half_blockwise( minuend, subtrahend,
+     detail::half_batch_subtract{} );
+}
+
+/** \brief  Multiplication, Cayley, block-wise
+
+Multiplies corresponding elements of the given sequences, in `float`, and
+narrows the products.
+
+    \relates  #boost::math::complex_half_vector
+
+    \pre  `multiplicand.size() == multiplier.size()`.
+
+    \param[in] multiplicand  The sequence of first factors.
+    \param[in] multiplier    The sequence of second factors.
+
+    \returns  The sequence of products.
+ */
+template < std::size_t R, class F >
+inline
+auto  operator *( complex_half_vector<R, F> const &multiplicand,
+ complex_half_vector<R, F> const &multiplier ) -> complex_half_vector<R, F>
+{
+    return detail::half_blockwise( multiplicand, multiplier,
+     detail::half_batch_multiply{} );
+}
+
+
+//  Whole-sequence functions  ------------------------------------------------//
+
+/** \brief  Cayley norm, block-wise
+
+    \relatesalso  #boost::math::complex_half_vector
+
+    \param[in] x  The input sequence.
+
+    \returns  The norms of the elements of `x`, computed and kept in `float`.
+ */
+template < std::size_t R, class F >
+auto  norm( complex_half_vector<R, F> const &x ) -> std::vector<float>
+{
+    typedef complex_it<float, R>  element_type;
+
+    std::size_t const          n = x.size();
+    std::size_t const          block = std::max<std::size_t>( 1u,
+     detail::half_block_components / element_type::static_size );
+    std::vector<float>         result( n );
+    std::vector<element_type>  y( std::min(block, n) );
+
+    for ( std::size_t base = 0u ; base < n ; base += block )
+    {
+        std::size_t const  m = std::min( block, n - base );
+
+        x.load( base, m, y.data() );
+        batch_norm( y.data(), y.data() + m, result.data() + base );
+    }
+    return result;
+}
+
+
+}  // namespace math
+}  // namespace boost
+
+
+#endif // BOOST_MATH_COMPLEX_HALF_HPP
@@ -31,7 +31,9 @@
 #include <cinttypes>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
 #include <cstdlib>
+#include <cstring>
 #include <functional>
 #include <iterator>
 #include <limits>
@@ -51,6 +53,12 @@ namespace math
 {
 
 
+//  Forward declarations  ----------------------------------------------------//
+
+template < typename Number, std::size_t Rank >  class barrage_view;
+template < typename Number, std::size_t Rank >  class const_barrage_view;
+
+
 //  Hypercomplex number (iterative) class template definition  ---------------//
 
 /** \brief  A complex number class storing its components in an array.
@@ -226,6 +234,43 @@ struct complex_it
     void  upper_barrage( barrage_type const &b )
     { std::copy(&b[0 ], &b[static_size / 2u + !rank ], &c[static_size / 2u ]); }
 
+    /** \brief  View of the lower decomposed half of this object
+
+    Refers to the same components as #lower_barrage()const, but in place,
+    instead of copying them.  Recursive (divide-and-conquer) algorithms can
+    descend the barrages this way at no cost per level.
+
+        \see  #upper_view()
+
+        \returns  A #boost::math::barrage_view of `{ c[0]; ...; c[2^(Rank - 1)
+                  - 1] }`, or of all of `*this` when #rank is 0.
+     */
+    auto  lower_view() noexcept -> barrage_view<value_type, rank - !!rank>
+    { return barrage_view<value_type, rank - !!rank>{ &c[0] }; }
+    //! \overload
+    auto  lower_view() const noexcept
+     -> const_barrage_view<value_type, rank - !!rank>
+    { return const_barrage_view<value_type, rank - !!rank>{ &c[0] }; }
+    /** \brief  View of the upper decomposed half of this object
+
+    Refers to the same components as #upper_barrage()const, but in place,
+    instead of copying them.
+
+        \see  #lower_view()
+
+        \returns  A #boost::math::barrage_view of `{ c[2^(Rank - 1)]; ...;
+                  c[2^Rank - 1] }`, or of all of `*this` when #rank is 0.
+     */
+    auto  upper_view() noexcept -> barrage_view<value_type, rank - !!rank>
+    { return barrage_view<value_type, rank - !!rank>{ &c[static_size / 2u] }; }
+    //! \overload
+    auto  upper_view() const noexcept
+     -> const_barrage_view<value_type, rank - !!rank>
+    {
+        return const_barrage_view<value_type, rank - !!rank>{ &c[static_size /
+         2u] };
+    }
+
     /** \brief  Unreal-components inspector
 
     The generalization of `imag` from regular-complex numbers to higher-level
@@ -459,6 +504,35 @@ constexpr
 bool  complex_it<Number, Rank>::has_padding;
 
 
+//  Multiplication strategy  -------------------------------------------------//
+
+/** \brief  Opt-in for Cayley products that trade multiplies for additions.
+
+By default, the Cayley product of two rank-*n* values uses `4 ^ n` component
+multiplies.  When this trait is specialized to derive from `std::true_type` for
+a component type, products with that component type (both for `complex_it` and
+`complex_rt`) instead use:
+- Gauss's method for complex numbers, with 3 multiplies instead of 4.
+- The Howell-Lafon method for quaternions, with 8 multiplies instead of 16.
+- Barrage-wise recursion down to the quaternion method for higher ranks, e.g.
+  32 multiplies instead of 64 for octonions.
+
+These methods use several more additions and subtractions, so they only pay off
+when multiplying components costs much more than adding them (multi-precision
+types, for instance).  Mixed-rank products still use the regular method.
+
+    \pre  Component arithmetic is exact, without wraparound.  (The quaternion
+          method halves some intermediate sums, which are always even in exact
+          arithmetic.)
+
+    \tparam Number  The component type of the product.
+ */
+template < typename Number >
+struct use_reduced_multiplication
+    : std::false_type
+{ };
+
+
 //  Implementation details  --------------------------------------------------//
 
 //! \cond
@@ -474,65 +548,223 @@ namespace detail
         return noexcept( swap(std::declval<T &>(), std::declval<U &>()) );
     }
 
-    /** \brief  Adds the product of two hypercomplex numbers to another.
-        \param[in,out] augend_sum  Array segment where the products are added
-                                   to.  Must point to at least `2 ^ Max(rank_md,
-                                   rank_mr)` elements.  The memory can *not*
-                                   overlap with `multiplicand` or `multiplier`.
-        \param[in] do_subtract     Whether the products should be subtracted
-                                   from `augend_sum` instead of added.
-        \param[in] multiplicand    Array segment for the components of the
-                                   first factor.  Must point to at least
-                                   `2 ^ rank_md` elements.
-        \param[in] rank_md         Cayley-Dickson level of `multiplicand`.
-        \param[in] conjugate_md    Use the conjugate of `multiplicand` instead
-                                   of its value directly.
-        \param[in] multiplier      Array segment for the components of the
-                                   second factor.  Must point to at least
-                                   `2 ^ rank_mr` elements.
-        \param[in] rank_mr         Cayley-Dickson level of `multiplier`.
-        \param[in] conjugate_mr    Use the conjugate of `multiplier` instead of
-                                   its value directly.
+    //! Adds (or subtracts) the product of two components to another.
+    template < bool DoSubtract >
+    struct component_product
+    {
+        template < typename As, typename Md, typename Mr >
+        static  void  add( As &augend_sum, Md const &multiplicand, Mr const
+         &multiplier )
+        { augend_sum += multiplicand * multiplier; }
+    };
+
+    //! \overload
+    template < >
+    struct component_product< true >
+    {
+        template < typename As, typename Md, typename Mr >
+        static  void  add( As &augend_sum, Md const &multiplicand, Mr const
+         &multiplier )
+        { augend_sum -= multiplicand * multiplier; }
+    };
+
+    //! Adds (or subtracts) a value to another.
+    template < bool DoSubtract >
+    struct component_sum
+    {
+        template < typename As, typename Ad >
+        static  void  add( As &augend_sum, Ad const &addend )
+        { augend_sum += addend; }
+    };
+
+    //! \overload
+    template < >
+    struct component_sum< true >
+    {
+        template < typename As, typename Ad >
+        static  void  add( As &augend_sum, Ad const &addend )
+        { augend_sum -= addend; }
+    };
+
+    //! Copies a hypercomplex number's components, maybe conjugating them.
+    template < bool Conjugate, std::size_t Size, typename T >
+    void  copy_components( T (&destination)[Size], T const *source )
+    {
+        destination[ 0 ] = source[ 0 ];
+        for ( std::size_t i = 1u ; i < Size ; ++i )
+            destination[ i ] = Conjugate ? T( -source[i] ) : source[ i ];
+    }
+
+    /** \brief  Kernels for Cayley products using fewer component multiplies.
+
+    Only the complex and quaternion levels are defined; higher levels get here
+    through the regular barrage-wise recursion.
+
+        \see  #boost::math::use_reduced_multiplication
+     */
+    template < std::size_t Rank >
+    struct reduced_cayley_product;
+
+    // Gauss's method: 3 multiplies
+    template < >
+    struct reduced_cayley_product< 1u >
+    {
+        template < bool DoSubtract, bool ConjugateMd, bool ConjugateMr, typename
+         As, typename Md, typename Mr >
+        static  void  add( As *augend_sum, Md const *multiplicand, Mr const
+         *multiplier )
+        {
+            Md  a[ 2 ];
+            Mr  b[ 2 ];
+
+            copy_components<ConjugateMd>( a, multiplicand );
+            copy_components<ConjugateMr>( b, multiplier );
+
+            As const  k1 = b[ 0 ] * ( a[0] + a[1] ), k2 = a[ 0 ] * ( b[1] - b[0]
+             ), k3 = a[ 1 ] * ( b[0] + b[1] );
+
+            component_sum<DoSubtract>::add( augend_sum[0], k1 - k3 );
+            component_sum<DoSubtract>::add( augend_sum[1], k1 + k2 );
+        }
+    };
+
+    // Howell-Lafon method: 8 multiplies
+    template < >
+    struct reduced_cayley_product< 2u >
+    {
+        template < bool DoSubtract, bool ConjugateMd, bool ConjugateMr, typename
+         As, typename Md, typename Mr >
+        static  void  add( As *augend_sum, Md const *multiplicand, Mr const
+         *multiplier )
+        {
+            Md  a[ 4 ];
+            Mr  b[ 4 ];
+
+            copy_components<ConjugateMd>( a, multiplicand );
+            copy_components<ConjugateMr>( b, multiplier );
+
+            As const  p1 = ( a[0] + a[1] ) * ( b[0] + b[1] ), p2 = ( a[3] - a[2]
+             ) * ( b[2] - b[3] ), p3 = ( a[0] - a[1] ) * ( b[2] + b[3] ), p4 = (
+             a[2] + a[3] ) * ( b[0] - b[1] ), p5 = ( a[1] + a[3] ) * ( b[1] +
+             b[2] ), p6 = ( a[1] - a[3] ) * ( b[1] - b[2] ), p7 = ( a[0] + a[2]
+             ) * ( b[0] - b[3] ), p8 = ( a[0] - a[2] ) * ( b[0] + b[3] );
+
+            component_sum<DoSubtract>::add( augend_sum[0], p2 + (p7 + p8 - p5 -
+             p6) / 2 );
+            component_sum<DoSubtract>::add( augend_sum[1], p1 - (p5 + p6 + p7 +
+             p8) / 2 );
+            component_sum<DoSubtract>::add( augend_sum[2], p3 + (p5 - p6 + p7 -
+             p8) / 2 );
+            component_sum<DoSubtract>::add( augend_sum[3], p4 + (p5 - p6 - p7 +
+             p8) / 2 );
+        }
+    };
+
+    //! Categories for splitting a Cayley product based on its factors' ranks.
+    enum cayley_split
+    {
+        split_real_real,    // Both factors are real
+        split_real_vector,  // Only the multiplier is hypercomplex
+        split_vector_real,  // Only the multiplicand is hypercomplex
+        split_widen_mr,     // The multiplier is of higher rank
+        split_widen_md,     // The multiplicand is of higher rank
+        split_same_rank     // Both factors share a non-zero rank
+    };
+
+    //! Determine which category of split is needed for the given ranks.
+    inline constexpr
+    auto  classify_cayley_split( std::size_t rank_md, std::size_t rank_mr )
+     noexcept -> cayley_split
+    {
+        return ( !rank_md && !rank_mr ) ? split_real_real : !rank_md ?
+         split_real_vector : !rank_mr ? split_vector_real : ( rank_md < rank_mr
+         ) ? split_widen_mr : ( rank_md > rank_mr ) ? split_widen_md :
+         split_same_rank;
+    }
+
+    /** \brief  Compile-time kernel for adding a Cayley product to another.
+
+    Every decision from the run-time recursion (which factor to split, whether
+    to subtract, and which factors get conjugated) is a template parameter, so
+    each instantiation is a straight-line sequence of component multiplies and
+    adds (or subtracts) that the compiler can fully inline and schedule.
+
+        \tparam DoSubtract   Whether the products are subtracted instead of
+                             added.
+        \tparam RankMd       Cayley-Dickson level of the multiplicand.
+        \tparam ConjugateMd  Whether the multiplicand's conjugate is used.
+        \tparam RankMr       Cayley-Dickson level of the multiplier.
+        \tparam ConjugateMr  Whether the multiplier's conjugate is used.
      */
-    template < typename As, typename Md, typename Mr >
-    void  add_cayley_product( As *augend_sum, bool do_subtract,
-     Md const *multiplicand, std::size_t rank_md, bool conjugate_md,
-     Mr const *  multiplier, std::size_t rank_mr, bool conjugate_mr )
+    template < bool DoSubtract, std::size_t RankMd, bool ConjugateMd,
+     std::size_t RankMr, bool ConjugateMr, cayley_split Split =
+     classify_cayley_split(RankMd, RankMr) >
+    struct cayley_product_kernel;
+
+    // As +/-= realMd * realMr
+    template < bool DoSubtract, bool ConjugateMd, bool ConjugateMr >
+    struct cayley_product_kernel< DoSubtract, 0u, ConjugateMd, 0u, ConjugateMr,
+     split_real_real >
+    {
+        template < typename As, typename Md, typename Mr >
+        static  void  add( As *augend_sum, Md const *multiplicand, Mr const
+         *multiplier )
+        {
+            component_product<DoSubtract>::add( *augend_sum, *multiplicand,
+             *multiplier );
+        }
+    };
+
+    // As +/-= realMd * vectorMr
+    template < bool DoSubtract, bool ConjugateMd, std::size_t RankMr, bool
+     ConjugateMr >
+    struct cayley_product_kernel< DoSubtract, 0u, ConjugateMd, RankMr,
+     ConjugateMr, split_real_vector >
+    {
+        template < typename As, typename Md, typename Mr >
+        static  void  add( As *augend_sum, Md const *multiplicand, Mr const
+         *multiplier )
+        {
+            // For conjugated numbers, reverse the add/subtract action, but only
+            // for the unreal parts.
+            component_product<DoSubtract>::add( augend_sum[0], *multiplicand,
+             multiplier[0] );
+            for ( std::size_t i = 1u ; i < (1ULL << RankMr) ; ++i )
+                component_product<DoSubtract != ConjugateMr>::add(
+                 augend_sum[i], *multiplicand, multiplier[i] );
+        }
+    };
+
+    // As +/-= vectorMd * realMr
+    template < bool DoSubtract, std::size_t RankMd, bool ConjugateMd, bool
+     ConjugateMr >
+    struct cayley_product_kernel< DoSubtract, RankMd, ConjugateMd, 0u,
+     ConjugateMr, split_vector_real >
+    {
+        template < typename As, typename Md, typename Mr >
+        static  void  add( As *augend_sum, Md const *multiplicand, Mr const
+         *multiplier )
+        {
+            component_product<DoSubtract>::add( augend_sum[0], multiplicand[0],
+             *multiplier );
+            for ( std::size_t i = 1u ; i < (1ULL << RankMd) ; ++i )
+                component_product<DoSubtract != ConjugateMd>::add(
+                 augend_sum[i], multiplicand[i], *multiplier );
+        }
+    };
+
+    // As +/-= { Md * lowerMr, upperMr * Md }
+    template < bool DoSubtract, std::size_t RankMd, bool ConjugateMd,
+     std::size_t RankMr, bool ConjugateMr >
+    struct cayley_product_kernel< DoSubtract, RankMd, ConjugateMd, RankMr,
+     ConjugateMr, split_widen_mr >
     {
-        using std::size_t;
-
-        std::function<void(As*, Md const*, Mr const*)>  action[] = {
-            []( As *as, Md const *md, Mr const *mr ) -> void  // add
-             { *as += *md * *mr; },
-            []( As *as, Md const *md, Mr const *mr ) -> void  // subtract
-             { *as -= *md * *mr; }
-        };
-        size_t const  md_length = 1ULL << rank_md, mr_length = 1ULL << rank_mr;
-        auto const    as_length = std::max( md_length, mr_length );
-
-        if ( !rank_md && !rank_mr )
-            // As +/-= realMd * realMr
-            action[ do_subtract ]( augend_sum, multiplicand, multiplier );
-        else if ( !rank_md )
-            // As +/-= realMd * vectorMr
-            for ( size_t i = 0u ; i < mr_length ; ++i )
-                // For conjugated numbers, reverse the add/subtract action,
-                // but only for the unreal parts.
-                action[ do_subtract != (conjugate_mr && i) ]( augend_sum++,
-                 multiplicand, multiplier++ );
-        else if ( !rank_mr )
-            // As +/-= vectorMd * realMr
-            for ( size_t i = 0u ; i < md_length ; ++i )
-                action[ do_subtract != (conjugate_md && i) ]( augend_sum++,
-                 multiplicand++, multiplier );
-        else if ( rank_md < rank_mr )
+        template < typename As, typename Md, typename Mr >
+        static  void  add( As *augend_sum, Md const *multiplicand, Mr const
+         *multiplier )
         {
-            // As +/-= { Md * lowerMr, upperMr * Md }
-            add_cayley_product( augend_sum, do_subtract, multiplicand, rank_md,
-             conjugate_md, multiplier, rank_mr - 1u, conjugate_mr );
-            add_cayley_product( augend_sum + as_length / 2u, do_subtract !=
-             conjugate_mr, multiplier + mr_length / 2u, rank_mr - 1u, false,
-             multiplicand, rank_md, conjugate_md );
+            constexpr std::size_t  half = 1ULL << ( RankMr - 1u );
+
             // Rules for splitting a number, starting a Ptr, of length Len:
             // * Lower barrage: same Ptr, length Len / 2.
             // * Upper barrage: start at Ptr + Len / 2, length Len / 2.
@@ -540,37 +772,276 @@ namespace detail
             // * Conjugate number -> negated upper barrage
             //   -> swtich add/subtract status and strip conjugate state
             //   (unless the barrage is to be conjugated itself)
+            cayley_product_kernel<DoSubtract, RankMd, ConjugateMd, RankMr - 1u,
+             ConjugateMr>::add( augend_sum, multiplicand, multiplier );
+            cayley_product_kernel<DoSubtract != ConjugateMr, RankMr - 1u, false,
+             RankMd, ConjugateMd>::add( augend_sum + half, multiplier + half,
+             multiplicand );
+        }
+    };
+
+    // As +/-= { lowerMd * Mr, upperMd * conj(Mr) }
+    template < bool DoSubtract, std::size_t RankMd, bool ConjugateMd,
+     std::size_t RankMr, bool ConjugateMr >
+    struct cayley_product_kernel< DoSubtract, RankMd, ConjugateMd, RankMr,
+     ConjugateMr, split_widen_md >
+    {
+        template < typename As, typename Md, typename Mr >
+        static  void  add( As *augend_sum, Md const *multiplicand, Mr const
+         *multiplier )
+        {
+            constexpr std::size_t  half = 1ULL << ( RankMd - 1u );
+
+            cayley_product_kernel<DoSubtract, RankMd - 1u, ConjugateMd, RankMr,
+             ConjugateMr>::add( augend_sum, multiplicand, multiplier );
+            cayley_product_kernel<DoSubtract != ConjugateMd, RankMd - 1u, false,
+             RankMr, !ConjugateMr>::add( augend_sum + half, multiplicand + half,
+             multiplier );
+        }
+    };
+
+    // As +/-= { lowerMd * lowerMr - conj(upperMr) * upperMd, upperMr * lowerMd
+    //  + upperMd * conj(lowerMr) }
+    template < bool DoSubtract, std::size_t Rank, bool ConjugateMd, bool
+     ConjugateMr >
+    struct cayley_product_kernel< DoSubtract, Rank, ConjugateMd, Rank,
+     ConjugateMr, split_same_rank >
+    {
+        template < typename As, typename Md, typename Mr >
+        static  void  add( As *augend_sum, Md const *multiplicand, Mr const
+         *multiplier )
+        {
+            add( augend_sum, multiplicand, multiplier, std::integral_constant<
+             bool, (Rank <= 2u) && use_reduced_multiplication<As>::value >{} );
         }
-        else if ( rank_md > rank_mr )
+
+    private:
+        // Fewer multiplies, for expensive component types
+        template < typename As, typename Md, typename Mr >
+        static  void  add( As *augend_sum, Md const *multiplicand, Mr const
+         *multiplier, std::true_type )
         {
-            // As +/-= { lowerMd * Mr, upperMd * conj(Mr) }
-            add_cayley_product( augend_sum, do_subtract, multiplicand, rank_md -
-             1u, conjugate_md, multiplier, rank_mr, conjugate_mr );
-            add_cayley_product( augend_sum + as_length / 2u, do_subtract !=
-             conjugate_md, multiplicand + md_length / 2u, rank_md - 1u, false,
-             multiplier, rank_mr, !conjugate_mr );
+            reduced_cayley_product<Rank>::template add<DoSubtract, ConjugateMd,
+             ConjugateMr>( augend_sum, multiplicand, multiplier );
         }
-        else  // rank_md == rank_mr, both > 0
+
+        // Regular barrage-wise split
+        template < typename As, typename Md, typename Mr >
+        static  void  add( As *augend_sum, Md const *multiplicand, Mr const
+         *multiplier, std::false_type )
         {
-            // As +/-= { lowerMd * lowerMr - conj(upperMr) * upperMd, upperMr *
-            //  lowerMd + upperMd * conj(lowerMr) }
-            add_cayley_product( augend_sum, do_subtract, multiplicand, rank_md -
-             1u, conjugate_md, multiplier, rank_mr - 1u, conjugate_mr );
-            add_cayley_product( augend_sum, !do_subtract != (conjugate_mr !=
-             conjugate_md), multiplier + mr_length / 2u, rank_mr - 1u, true,
-             multiplicand + md_length / 2u, rank_md - 1u, false );
-            add_cayley_product( augend_sum + as_length / 2u, do_subtract !=
-             conjugate_mr, multiplier + mr_length / 2u, rank_mr - 1u, false,
-             multiplicand, rank_md - 1u, conjugate_md );
-            add_cayley_product( augend_sum + as_length / 2u, do_subtract !=
-             conjugate_md, multiplicand + md_length / 2u, rank_md - 1u, false,
-             multiplier, rank_mr - 1u, !conjugate_mr );
+            constexpr std::size_t  half = 1ULL << ( Rank - 1u );
+
+            cayley_product_kernel<DoSubtract, Rank - 1u, ConjugateMd, Rank - 1u,
+             ConjugateMr>::add( augend_sum, multiplicand, multiplier );
+            cayley_product_kernel<!DoSubtract != (ConjugateMr != ConjugateMd),
+             Rank - 1u, true, Rank - 1u, false>::add( augend_sum, multiplier +
+             half, multiplicand + half );
+            cayley_product_kernel<DoSubtract != ConjugateMr, Rank - 1u, false,
+             Rank - 1u, ConjugateMd>::add( augend_sum + half, multiplier + half,
+             multiplicand );
+            cayley_product_kernel<DoSubtract != ConjugateMd, Rank - 1u, false,
+             Rank - 1u, !ConjugateMr>::add( augend_sum + half, multiplicand +
+             half, multiplier );
         }
+    };
+
+    /** \brief  Adds the product of two hypercomplex numbers to another.
+        \tparam DoSubtract         Whether the products should be subtracted
+                                   from `augend_sum` instead of added.
+        \tparam RankMd             Cayley-Dickson level of `multiplicand`.
+        \tparam ConjugateMd        Use the conjugate of `multiplicand` instead
+                                   of its value directly.
+        \tparam RankMr             Cayley-Dickson level of `multiplier`.
+        \tparam ConjugateMr        Use the conjugate of `multiplier` instead of
+                                   its value directly.
+        \param[in,out] augend_sum  Array segment where the products are added
+                                   to.  Must point to at least `2 ^ Max(RankMd,
+                                   RankMr)` elements.  The memory can *not*
+                                   overlap with `multiplicand` or `multiplier`.
+        \param[in] multiplicand    Array segment for the components of the
+                                   first factor.  Must point to at least
+                                   `2 ^ RankMd` elements.
+        \param[in] multiplier      Array segment for the components of the
+                                   second factor.  Must point to at least
+                                   `2 ^ RankMr` elements.
+     */
+    template < bool DoSubtract, std::size_t RankMd, bool ConjugateMd,
+     std::size_t RankMr, bool ConjugateMr, typename As, typename Md, typename
+     Mr >
+    inline
+    void  add_cayley_product( As *augend_sum, Md const *multiplicand, Mr const
+     *multiplier )
+    {
+        cayley_product_kernel<DoSubtract, RankMd, ConjugateMd, RankMr,
+         ConjugateMr>::add( augend_sum, multiplicand, multiplier );
+    }
+
+    //! Compile-time list of indices, for pack expansion.
+    template < std::size_t ...I >
+    struct index_list
+    {
+        typedef index_list  type;
+    };
+
+    //! Joins two index lists, the second one shifted past the first.
+    template < class L, class M >
+    struct concat_index_lists;
+
+    //! \overload
+    template < std::size_t ...I, std::size_t ...J >
+    struct concat_index_lists< index_list<I...>, index_list<J...> >
+        : index_list< I..., (sizeof...( I ) + J)... >
+    { };
+
+    //! Makes the list 0, 1, ..., N - 1, with logarithmic instantiation depth.
+    template < std::size_t N >
+    struct make_index_list
+        : concat_index_lists< typename make_index_list<N / 2u>::type, typename
+           make_index_list<N - N / 2u>::type >
+    { };
+
+    //! \overload
+    template < >
+    struct make_index_list< 0u >  : index_list<>  { };
+
+    //! \overload
+    template < >
+    struct make_index_list< 1u >  : index_list<0u>  { };
+
+    inline constexpr
+    int  basis_product_sign( std::size_t rank, std::size_t i, std::size_t j )
+     noexcept;
+
+    // Sign of e_i * e_j after splitting both units at the given half-length.
+    // Units with an index below the split are (e, 0), the rest are (0, e).
+    inline constexpr
+    int  basis_product_sign_split( std::size_t rank, std::size_t half,
+     std::size_t i, std::size_t j ) noexcept
+    {
+        return ( i < half ) ? ( (j < half) ? basis_product_sign(rank, i, j) :
+         basis_product_sign(rank, j - half, i) ) : ( j < half ) ? ( j ? -1 : 1 )
+         * basis_product_sign( rank, i - half, j ) : ( (j - half) ? 1 : -1 ) *
+         basis_product_sign( rank, j - half, i - half );
+    }
+
+    /** \brief  Sign of the product of two Cayley-Dickson basis units.
+        \param rank  The Cayley-Dickson level the units are taken from.
+        \param i     Index of the left factor.  Must be less than `2 ^ rank`.
+        \param j     Index of the right factor.  Must be less than `2 ^ rank`.
+        \returns  +1 or -1, such that `e_i * e_j == sign * e_(i XOR j)`.
+     */
+    inline constexpr
+    int  basis_product_sign( std::size_t rank, std::size_t i, std::size_t j )
+     noexcept
+    {
+        return rank ? basis_product_sign_split( rank - 1u, 1ULL << (rank - 1u),
+         i, j ) : 1;
     }
+}  // namespace detail
+//! \endcond
+
+
+//  Basis multiplication table  ----------------------------------------------//
+
+/** \brief  An entry of the Cayley-Dickson basis multiplication table.
+
+Multiplying two basis units always results in a single basis unit, possibly
+negated.
+ */
+struct cayley_basis_product
+{
+    //! The index of the basis unit of the product.
+    std::size_t  index;
+    //! The multiplier applied to that unit, either +1 or -1.
+    signed char  sign;
+};
+
+//! \cond
+namespace detail
+{
+    // Stores the multiplication table for a rank, given the flat entry indices.
+    template < std::size_t Rank, class Indices >
+    struct cayley_basis_table;
+
+    template < std::size_t Rank, std::size_t ...I >
+    struct cayley_basis_table< Rank, index_list<I...> >
+    {
+        static constexpr  cayley_basis_product  table[ sizeof...(I) ] = { {
+         (I >> Rank) ^ (I & ((1ULL << Rank) - 1u)), static_cast<signed char>(
+         basis_product_sign(Rank, I >> Rank, I & ((1ULL << Rank) - 1u)) ) }...
+         };
+    };
+
+    template < std::size_t Rank, std::size_t ...I >
+    constexpr
+    cayley_basis_product  cayley_basis_table<Rank, index_list<I...>>::table[
+     sizeof...(I) ];
 
 }  // namespace detail
 //! \endcond
 
+/** \brief  The multiplication table for the basis units of a Cayley-Dickson
+            level.
+
+The basis units `e_0` (i.e. 1), `e_1` (i.e. the classic *i*), ..., `e_(N-1)`
+multiply among themselves to give `e_i * e_j == sign(i, j) * e_(i XOR j)`.  The
+signs follow the same barrage-wise definition used by the multiplication
+operators, so the table for a lower rank is the upper-left corner of the table
+for any higher rank.
+
+Besides the `constexpr` inspectors, the table is materialized as a flat array
+in row-major order, so the entry for `e_i * e_j` is at `table[i * N + j]`.  The
+table has `4 ^ Rank` entries, so it should be limited to the lower ranks.
+
+    \tparam Rank  The Cayley-Dickson construction level.
+ */
+template < std::size_t Rank >
+struct cayley_basis
+    : private detail::cayley_basis_table< Rank, typename
+       detail::make_index_list<(1ULL << ( 2u * Rank ))>::type >
+{
+    //! The type for size-based meta-data and access indices.
+    typedef std::size_t  size_type;
+
+    //! The rung of Cayley-Dickson construction.
+    static constexpr  size_type  rank = Rank;
+    //! The number of basis units.
+    static constexpr  size_type  static_size = 1ULL << rank;
+
+    /** \brief  Index of a basis product
+        \pre  *i* \< #static_size and *j* \< #static_size.
+        \param i  The index of the left factor.
+        \param j  The index of the right factor.
+        \returns  `k` such that `e_i * e_j == ±e_k`.
+     */
+    static constexpr
+    auto  index( size_type i, size_type j ) noexcept -> size_type
+    { return i ^ j; }
+    /** \brief  Sign of a basis product
+        \pre  *i* \< #static_size and *j* \< #static_size.
+        \param i  The index of the left factor.
+        \param j  The index of the right factor.
+        \returns  `s` (+1 or -1) such that `e_i * e_j == s * e_(i XOR j)`.
+     */
+    static constexpr
+    auto  sign( size_type i, size_type j ) noexcept -> int
+    { return detail::basis_product_sign( rank, i, j ); }
+
+    using detail::cayley_basis_table< Rank, typename
+     detail::make_index_list<(1ULL << ( 2u * Rank ))>::type >::table;
+};
+
+//! The Cayley-Dickson level of the table.
+template < std::size_t Rank >
+constexpr
+typename cayley_basis<Rank>::size_type  cayley_basis<Rank>::rank;
+
+//! The number of rows, and columns, of the table.
+template < std::size_t Rank >
+constexpr
+typename cayley_basis<Rank>::size_type  cayley_basis<Rank>::static_size;
+
 
 //  Object support functions  ------------------------------------------------//
 
@@ -1209,72 +1680,329 @@ auto  operator --(complex_it<T, R> &minuend_difference, int) -> complex_it<T, R>
 }
 
 
-//  Hypercomplex condition operator and functions  ---------------------------//
-
-/** \brief  Complex conjugate, in operator form
+//  Conjugate expression class template definition  --------------------------//
 
-Returns the complex conjugate of the given value.  This is commonly given as
-`conj(x)` in computer code, but the `~x` notation is reminiscent of the compact
-notations of this operation in prose.  (The `operator ~` would be otherwise
-unused, anyway.)
+/** \brief  Deferred conjugate of an iteration-based hypercomplex number
 
-    \relates  #boost::math::complex_it
+Refers to a `complex_it` object and reads its components as if they had been
+conjugated, without making a negated copy.  This is what
+#boost::math::lazy_conj returns.  The Cayley multiplication and division
+operators, `norm`, and the fused multiply-add functions recognize this type and
+fold the conjugation into the Cayley product kernel.  Any other use can convert
+it (implicitly) to a `complex_it`.
 
-    \param[in] x  The input value.
+    \pre  The referenced object outlives this expression object.
 
-    \returns  `Conj(x)`.
+    \tparam Number  The component type
+    \tparam Rank    The Cayley-Dickson construction level.
  */
-template < typename T, std::size_t R >
-auto  operator ~( complex_it<T, R> const &x ) -> complex_it<T, R>
+template < typename Number, std::size_t Rank >
+class conjugate_expression
 {
-    decltype( operator~(x) )  result;  // "decltype(~x)" causes ICE
-    auto                      rb = begin( result );
-    auto const                re = end( result );
-    auto                      xb = begin( x );
+public:
+    // Core types
+    //! \copydoc  #boost::math::complex_it::size_type
+    typedef std::size_t                 size_type;
+    //! \copydoc  #boost::math::complex_it::value_type
+    typedef Number                      value_type;
+    //! The type of the conjugated object.
+    typedef complex_it<Number, Rank>  argument_type;
 
-    *rb++ = +*xb++;
-    while ( re != rb )
-        *rb++ = -*xb++;
-    return result;
-}
+    // Sizing parameters
+    //! \copydoc  #boost::math::complex_it::rank
+    static constexpr  size_type  rank = Rank;
+    //! \copydoc  #boost::math::complex_it::static_size
+    static constexpr  size_type  static_size = argument_type::static_size;
 
-/** \brief  Complex conjugate
+    /** \brief  Refer to an object to be conjugated.
+        \param[in] x  The object whose conjugate is expressed.
+        \post  `&this->argument() == &x`.
+     */
+    explicit constexpr
+    conjugate_expression( argument_type const &x ) noexcept
+        : x{ &x }
+    {}
 
-Returns the complex conjugate of the given value.  This function is a core
-operation for complex numbers.  The component type must *not* have a version of
-this function (or at least one that differs from the identity function), since
-that implementation will be ignored.
+    /** \brief  Access to the conjugated component data.
+        \pre  *i* \< #static_size
+        \param[in] i  The index of the selected component.
+        \returns  `(*this)[0]` is the real component of the argument; the others
+                  are the negations of the argument's components.
+     */
+    auto  operator []( size_type i ) const -> value_type
+    { return i ? value_type( -(*x)[i] ) : (*x)[ i ]; }
 
-The definition can be broken down as:
-- Real: `+r`
-- Component-wise: `{ +c[0], -c[1], ..., -c[2^Rank - 1] }`
-- Barrage-wise: `{ Conj(Lower); -Upper }`
+    /** \brief    The object that is conjugated
+        \returns  A reference to the object given at construction.
+     */
+    constexpr
+    auto  argument() const noexcept -> argument_type const &  { return *x; }
 
-This function has to act as an anti-involution (modulo real-life computing
-issues), which means:
-- Self-inverse: `Conj( Conj(x) ) == x`.
-- Linear w/ Adding: `Conj( x + y ) == Conj( x ) + Conj( y )`.
-- Linear w/ Scale: `Conj( scalar * x ) == scalar * Conj( x )`.
-- Reversed w/ Multiplying: `Conj( x * y ) == Conj( y ) * Conj( x )`.
+    /** \brief    Materialize the conjugate
+        \returns  `~this->argument()`.
+     */
+    operator argument_type() const  { return ~*x; }
 
-    \relatesalso  #boost::math::complex_it
+private:
+    argument_type const *  x;
+};
 
-    \param[in] x  The input value.
+/** Gives access to a template parameter.
+ */
+template < typename Number, std::size_t Rank >
+constexpr
+typename conjugate_expression<Number, Rank>::size_type
+  conjugate_expression<Number, Rank>::rank;
 
-    \returns  The reflection of `x` on the real axis.
+/** Matches the component count of the conjugated type.
  */
-template < typename T, std::size_t R >
-inline
-auto  conj( complex_it<T, R> const &x ) -> complex_it<T, R>
-{ return ~x; }
+template < typename Number, std::size_t Rank >
+constexpr
+typename conjugate_expression<Number, Rank>::size_type
+  conjugate_expression<Number, Rank>::static_size;
 
-/** \brief  Cayley norm
+//! \cond
+namespace detail
+{
+    // Treat numbers, deferred conjugates, and views as Cayley-product operands,
+    // described as a component array plus a conjugation flag.
+    template < class X >
+    struct cayley_operand
+    {
+        static constexpr  bool         value = false;
+        static constexpr  std::size_t  rank = 0u;
+        static constexpr  bool         conjugated = false;
+    };
 
-Returns the Cayley norm of the given value.  This is formed by multiplying a
-value by its conjugate, which results in the square of the conventional norm
-(i.e. Euclidean norm, absolute value, or distance).
+    template < typename T, std::size_t R >
+    struct cayley_operand< complex_it<T, R> >
+    {
+        typedef T                 value_type;
+        typedef complex_it<T, R>  object_type;
 
-The Cayley norm is always a non-negative real number.  It is zero only when the
+        static constexpr  bool         value = true;
+        static constexpr  std::size_t  rank = R;
+        static constexpr  bool         conjugated = false;
+
+        static  auto  data( object_type const &x ) -> T const *
+        { return &x[0]; }
+    };
+
+    template < typename T, std::size_t R >
+    struct cayley_operand< conjugate_expression<T, R> >
+    {
+        typedef T                 value_type;
+        typedef complex_it<T, R>  object_type;
+
+        static constexpr  bool         value = true;
+        static constexpr  std::size_t  rank = R;
+        static constexpr  bool         conjugated = true;
+
+        static  auto  data( conjugate_expression<T, R> const &x ) -> T const *
+        { return &x.argument()[0]; }
+    };
+
+    // The product type for two operands
+    template < class Md, class Mr >
+    struct cayley_operand_product
+    {
+        typedef complex_it<decltype( std::declval<typename
+         cayley_operand<Md>::value_type>() * std::declval<typename
+         cayley_operand<Mr>::value_type>() ), (cayley_operand<Md>::rank <
+         cayley_operand<Mr>::rank) ? cayley_operand<Mr>::rank :
+         cayley_operand<Md>::rank>  type;
+    };
+
+    // Whether two component arrays share any storage
+    template < typename T, typename U >
+    inline
+    auto  overlapping( T const *a, std::size_t m, U const *b, std::size_t n )
+     -> bool
+    {
+        std::less<void const *> const  before{};
+
+        return before( b, a + m ) && before( a, b + n );
+    }
+
+    // As +/-= Md * Mr, where the flags are applied on top of any deferred
+    // conjugation in the operands.  The accumulator may overlap an operand.
+    template < bool DoSubtract, bool ConjugateMd, bool ConjugateMr, std::size_t
+     Q, typename T, class Md, class Mr >
+    void  add_operand_product( T *augend_sum, Md const &multiplicand, Mr const
+     &multiplier )
+    {
+        typedef cayley_operand<Md>  md_traits;
+        typedef cayley_operand<Mr>  mr_traits;
+
+        auto const * const  md = md_traits::data( multiplicand );
+        auto const * const  mr = mr_traits::data( multiplier );
+
+        if ( overlapping(augend_sum, std::size_t(1) << Q, md, std::size_t(1) <<
+         md_traits::rank) || overlapping(augend_sum, std::size_t(1) << Q, mr,
+         std::size_t(1) << mr_traits::rank) )
+        {
+            typename md_traits::object_type  md_copy;
+            typename mr_traits::object_type  mr_copy;
+
+            std::copy( md, md + md_copy.static_size, &md_copy[0] );
+            std::copy( mr, mr + mr_copy.static_size, &mr_copy[0] );
+            add_cayley_product<DoSubtract, md_traits::rank, ConjugateMd !=
+             md_traits::conjugated, mr_traits::rank, ConjugateMr !=
+             mr_traits::conjugated>( augend_sum, &md_copy[0], &mr_copy[0] );
+        }
+        else
+            add_cayley_product<DoSubtract, md_traits::rank, ConjugateMd !=
+             md_traits::conjugated, mr_traits::rank, ConjugateMr !=
+             mr_traits::conjugated>( augend_sum, md, mr );
+    }
+
+    //! \overload
+    template < bool DoSubtract, bool ConjugateMd, bool ConjugateMr, typename
+     T, std::size_t Q, class Md, class Mr >
+    void  add_operand_product( complex_it<T, Q> &augend_sum, Md const
+     &multiplicand, Mr const &multiplier )
+    {
+        add_operand_product<DoSubtract, ConjugateMd, ConjugateMr, Q>(
+         &augend_sum[0], multiplicand, multiplier );
+    }
+
+    // Md * Mr, with deferred conjugations applied
+    template < class Md, class Mr >
+    auto  operand_product( Md const &multiplicand, Mr const &multiplier )
+     -> typename cayley_operand_product<Md, Mr>::type
+    {
+        typename cayley_operand_product<Md, Mr>::type  product{};
+
+        add_cayley_product<false, cayley_operand<Md>::rank,
+         cayley_operand<Md>::conjugated, cayley_operand<Mr>::rank,
+         cayley_operand<Mr>::conjugated>( &product[0], cayley_operand<
+         Md>::data(multiplicand), cayley_operand<Mr>::data(multiplier) );
+        return product;
+    }
+
+}  // namespace detail
+//! \endcond
+
+
+//  Hypercomplex condition operator and functions  ---------------------------//
+
+/** \brief  Complex conjugate, in operator form
+
+Returns the complex conjugate of the given value.  This is commonly given as
+`conj(x)` in computer code, but the `~x` notation is reminiscent of the compact
+notations of this operation in prose.  (The `operator ~` would be otherwise
+unused, anyway.)
+
+    \relates  #boost::math::complex_it
+
+    \param[in] x  The input value.
+
+    \returns  `Conj(x)`.
+ */
+template < typename T, std::size_t R >
+auto  operator ~( complex_it<T, R> const &x ) -> complex_it<T, R>
+{
+    decltype( operator~(x) )  result;  // "decltype(~x)" causes ICE
+    auto                      rb = begin( result );
+    auto const                re = end( result );
+    auto                      xb = begin( x );
+
+    *rb++ = +*xb++;
+    while ( re != rb )
+        *rb++ = -*xb++;
+    return result;
+}
+
+/** \brief  Complex conjugate
+
+Returns the complex conjugate of the given value.  This function is a core
+operation for complex numbers.  The component type must *not* have a version of
+this function (or at least one that differs from the identity function), since
+that implementation will be ignored.
+
+The definition can be broken down as:
+- Real: `+r`
+- Component-wise: `{ +c[0], -c[1], ..., -c[2^Rank - 1] }`
+- Barrage-wise: `{ Conj(Lower); -Upper }`
+
+This function has to act as an anti-involution (modulo real-life computing
+issues), which means:
+- Self-inverse: `Conj( Conj(x) ) == x`.
+- Linear w/ Adding: `Conj( x + y ) == Conj( x ) + Conj( y )`.
+- Linear w/ Scale: `Conj( scalar * x ) == scalar * Conj( x )`.
+- Reversed w/ Multiplying: `Conj( x * y ) == Conj( y ) * Conj( x )`.
+
+The result is a new object; use #boost::math::lazy_conj to have the Cayley
+products and quotients read the conjugate from `x` instead.
+
+    \relatesalso  #boost::math::complex_it
+
+    \param[in] x  The input value.
+
+    \returns  The reflection of `x` on the real axis.
+ */
+template < typename T, std::size_t R >
+inline
+auto  conj( complex_it<T, R> const &x ) -> complex_it<T, R>
+{ return ~x; }
+
+/** \overload
+    \relatesalso  #boost::math::complex_it
+ */
+template < typename T, std::size_t R >
+auto  conj( complex_it<T, R> &&x ) -> complex_it<T, R>
+{
+    for ( std::size_t i = 1u ; i < complex_it<T, R>::static_size ; ++i )
+        x[ i ] = -x[ i ];
+    return std::move( x );
+}
+
+/** \overload
+    \relatesalso  #boost::math::conjugate_expression
+
+    \returns  The original object, since conjugation is self-inverse.
+ */
+template < typename T, std::size_t R >
+inline constexpr
+auto  conj( conjugate_expression<T, R> const &x ) noexcept
+ -> complex_it<T, R> const &
+{ return x.argument(); }
+
+/** \brief  Complex conjugate, deferred
+
+Returns the complex conjugate of the given value as a
+#boost::math::conjugate_expression that refers to `x`.  The Cayley products
+and quotients, `norm`, and the fused multiply-add functions fold the conjugation
+into their kernels, so `lazy_conj(a) * b` and the like never make a negated
+copy.  Other uses convert the expression to a `complex_it`.
+
+    \relatesalso  #boost::math::complex_it
+
+    \pre  `x` outlives the returned expression.  (Rvalues are rejected.)
+
+    \param[in] x  The input value.
+
+    \returns  An expression of `Conj(x)`.
+ */
+template < typename T, std::size_t R >
+inline constexpr
+auto  lazy_conj( complex_it<T, R> const &x ) noexcept
+ -> conjugate_expression<T, R>
+{ return conjugate_expression<T, R>{x}; }
+
+/** \overload
+    \relatesalso  #boost::math::complex_it
+ */
+template < typename T, std::size_t R >
+void  lazy_conj( complex_it<T, R> && ) = delete;
+
+/** \brief  Cayley norm
+
+Returns the Cayley norm of the given value.  This is formed by multiplying a
+value by its conjugate, which results in the square of the conventional norm
+(i.e. Euclidean norm, absolute value, or distance).
+
+The Cayley norm is always a non-negative real number.  It is zero only when the
 input value is zero.  Real-life computational arithmetic may result in negative
 values or a zero-norm from a non-zero value due to overflow, wraparound, or
 other condition events.
@@ -1296,6 +2024,17 @@ auto  norm( complex_it<T, R> const &x )
  -> decltype( std::declval<T>() * std::declval<T>() )
 { return std::inner_product(begin(x), end(x), begin(x), decltype(norm(x)){}); }
 
+/** \overload
+    \relatesalso  #boost::math::conjugate_expression
+
+    \returns  `Norm(x) == Norm( Conj(x) )`.
+ */
+template < typename T, std::size_t R >
+inline
+auto  norm( conjugate_expression<T, R> const &x )
+ -> decltype( std::declval<T>() * std::declval<T>() )
+{ return norm( x.argument() ); }
+
 
 //  Multiplication operators  ------------------------------------------------//
 
@@ -1377,79 +2116,1104 @@ Quaternion and Octonion libraries, and the Cayley-Dickson Construction page on
 Wikipedia.  It was also used by R. Shafer in his 1954 paper "On the algebras
 formed by the Cayley-Dickson process."
 
-    \relates  #boost::math::complex_it
+    \relates  #boost::math::complex_it
+
+    \pre  `declval<T>() * declval<U>()` is well-formed.
+    \pre  The various additive/subtractive operators are well-formed.
+
+    \param[in] multiplicand  The first factor to be multiplied.
+    \param[in] multiplier    The second factor to be multiplied.
+
+    \returns  The product of `multiplicand` and `multiplier`.
+ */
+template < typename T, std::size_t R, typename U, std::size_t S >
+inline
+auto  operator *( complex_it<T, R> const &multiplicand, complex_it<U, S> const
+ &multiplier )
+ -> complex_it<decltype( std::declval<T>() * std::declval<U>() ), ( R < S ) ? S
+ : R>
+{
+    decltype( multiplicand * multiplier )  product{};
+
+    detail::add_cayley_product<false, R, false, S, false>( &product[0],
+     &multiplicand[0], &multiplier[0] );
+    return product;
+}
+
+/** \overload
+    \relates  #boost::math::conjugate_expression
+
+    The conjugation is applied while multiplying; no negated copy is made.
+ */
+template < typename T, std::size_t R, typename U, std::size_t S >
+inline
+auto  operator *( conjugate_expression<T, R> const &multiplicand,
+ complex_it<U, S> const &multiplier )
+ -> complex_it<decltype( std::declval<T>() * std::declval<U>() ), ( R < S ) ? S
+ : R>
+{ return detail::operand_product( multiplicand, multiplier ); }
+
+/** \overload
+    \relates  #boost::math::conjugate_expression
+ */
+template < typename T, std::size_t R, typename U, std::size_t S >
+inline
+auto  operator *( complex_it<T, R> const &multiplicand,
+ conjugate_expression<U, S> const &multiplier )
+ -> complex_it<decltype( std::declval<T>() * std::declval<U>() ), ( R < S ) ? S
+ : R>
+{ return detail::operand_product( multiplicand, multiplier ); }
+
+/** \overload
+    \relates  #boost::math::conjugate_expression
+ */
+template < typename T, std::size_t R, typename U, std::size_t S >
+inline
+auto  operator *( conjugate_expression<T, R> const &multiplicand,
+ conjugate_expression<U, S> const &multiplier )
+ -> complex_it<decltype( std::declval<T>() * std::declval<U>() ), ( R < S ) ? S
+ : R>
+{ return detail::operand_product( multiplicand, multiplier ); }
+
+/** \brief  Multiply-and-assign, scalar
+
+Calculates the product of the given objects into the first.
+
+    \relates  #boost::math::complex_it
+
+    \pre  `declval<T &>() *= declval<T>()` is well-formed.
+
+    \param[in,out] multiplicand_product  The first factor to be multiplied, and
+                                         the location of the future product.
+    \param[in]     multiplier            The second factor to be multiplied.
+
+    \returns  A reference to post-multiplication `multiplicand_product`.
+ */
+template < typename T, std::size_t R >
+auto  operator *=( complex_it<T, R> &multiplicand_product, T const &multiplier )
+ -> complex_it<T, R> &
+{
+    for ( auto &mp : multiplicand_product )
+        mp *= multiplier;
+    return multiplicand_product;
+}
+
+/** \brief  Multiply-and-assign, Cayley
+
+Calculates the product of the given objects into the first.
+
+    \relates  #boost::math::complex_it
+
+    \pre  `declval<T &>() *= declval<U>()` is well-formed.
+    \pre  The various additive/subtractive operators are well-formed.
+    \pre  `multiplier`'s rank doesn't exceed that of `multiplicand_product`.
+
+    \param[in,out] multiplicand_product  The first factor to be added, and the
+                                         location of the future product.
+    \param[in]     multiplier            The second factor to be multiplied.
+
+    \returns  A reference to post-multiplication `multiplicand_product`.
+ */
+template < typename T, std::size_t R, typename U, std::size_t S >
+inline
+auto  operator *=( complex_it<T, R> &multiplicand_product, complex_it<U, S>
+ const &multiplier )
+ -> typename std::enable_if< (R >= S), complex_it<T, R> >::type &
+{ return multiplicand_product = multiplicand_product * multiplier; }
+
+/** \overload
+    \relates  #boost::math::conjugate_expression
+ */
+template < typename T, std::size_t R, typename U, std::size_t S >
+inline
+auto  operator *=( complex_it<T, R> &multiplicand_product,
+ conjugate_expression<U, S> const &multiplier )
+ -> typename std::enable_if< (R >= S), complex_it<T, R> >::type &
+{ return multiplicand_product = multiplicand_product * multiplier; }
+
+/** \brief  Multiplication, Cayley, via the basis table
+
+Calculates the same product as the Cayley multiplication operator, but with an
+engine driven by #boost::math::cayley_basis instead of barrage-wise recursion.
+Each component pair is a single multiply-add (or multiply-subtract) into the
+product component the table directs it to, so the work is a flat double loop
+without any recursion.
+
+    \relates  #boost::math::complex_it
+
+    \pre  `declval<T>() * declval<U>()` is well-formed.
+    \pre  The various additive/subtractive operators are well-formed.
+
+    \param[in] multiplicand  The first factor to be multiplied.
+    \param[in] multiplier    The second factor to be multiplied.
+
+    \returns  `multiplicand * multiplier`.
+ */
+template < typename T, std::size_t R, typename U, std::size_t S >
+auto  cayley_table_product( complex_it<T, R> const &multiplicand, complex_it<U,
+ S> const &multiplier ) -> decltype( multiplicand * multiplier )
+{
+    typedef cayley_basis<( R < S ) ? S : R>  basis_type;
+
+    decltype( multiplicand * multiplier )  product{};
+    auto                                   entry = &basis_type::table[ 0 ];
+
+    for ( std::size_t i = 0u ; i < (1ULL << R) ; ++i, entry +=
+     basis_type::static_size )
+        for ( std::size_t j = 0u ; j < (1ULL << S) ; ++j )
+        {
+            auto const  term = multiplicand[ i ] * multiplier[ j ];
+
+            if ( entry[j].sign < 0 )
+                product[ entry[j].index ] -= term;
+            else
+                product[ entry[j].index ] += term;
+        }
+    return product;
+}
+
+
+//  Fused multiply-add functions  --------------------------------------------//
+
+/** \brief  Multiply-and-accumulate, Cayley
+
+Adds the product of the given factors to the accumulator, without forming the
+product as a temporary.  Either factor can be conjugated on the fly, so all of
+`acc += a * b`, `acc += conj(a) * b`, `acc += a * conj(b)`, and `acc += conj(a)
+* conj(b)` are covered.  A conjugation can be requested with a flag or by
+passing the #boost::math::conjugate_expression from `lazy_conj`.
+
+    \relatesalso  #boost::math::complex_it
+
+    \pre  Each factor is a `complex_it`, a `conjugate_expression`, or a barrage
+          view.
+    \pre  `declval<T &>() += a * b` is well-formed for components `a` and `b`
+          of the factors.
+    \pre  The rank of the accumulator is at least as large as that of either
+          factor.
+
+    \tparam ConjugateMd  Whether `conj( multiplicand )` is used instead.
+    \tparam ConjugateMr  Whether `conj( multiplier )` is used instead.
+
+    \param[in,out] accumulator   The object to be added to.  It may be the same
+                                 object as either factor.
+    \param[in]     multiplicand  The first factor to be multiplied.
+    \param[in]     multiplier    The second factor to be multiplied.
+
+    \returns  A reference to the updated `accumulator`.
+ */
+template < bool ConjugateMd = false, bool ConjugateMr = false, typename T,
+ std::size_t Q, class Md, class Mr >
+inline
+auto  fma_assign( complex_it<T, Q> &accumulator, Md const &multiplicand, Mr
+ const &multiplier )
+ -> typename std::enable_if< detail::cayley_operand<Md>::value &&
+ detail::cayley_operand<Mr>::value && (Q >= detail::cayley_operand<Md>::rank)
+ && (Q >= detail::cayley_operand<Mr>::rank), complex_it<T, Q> >::type &
+{
+    detail::add_operand_product<false, ConjugateMd, ConjugateMr>( accumulator,
+     multiplicand, multiplier );
+    return accumulator;
+}
+
+/** \brief  Multiply-and-deduct, Cayley
+
+Subtracts the product of the given factors from the accumulator, without
+forming the product as a temporary.
+
+    \relatesalso  #boost::math::complex_it
+
+    \see  #boost::math::fma_assign
+
+    \tparam ConjugateMd  Whether `conj( multiplicand )` is used instead.
+    \tparam ConjugateMr  Whether `conj( multiplier )` is used instead.
+
+    \param[in,out] accumulator   The object to be subtracted from.  It may be
+                                 the same object as either factor.
+    \param[in]     multiplicand  The first factor to be multiplied.
+    \param[in]     multiplier    The second factor to be multiplied.
+
+    \returns  A reference to the updated `accumulator`.
+ */
+template < bool ConjugateMd = false, bool ConjugateMr = false, typename T,
+ std::size_t Q, class Md, class Mr >
+inline
+auto  fms_assign( complex_it<T, Q> &accumulator, Md const &multiplicand, Mr
+ const &multiplier )
+ -> typename std::enable_if< detail::cayley_operand<Md>::value &&
+ detail::cayley_operand<Mr>::value && (Q >= detail::cayley_operand<Md>::rank)
+ && (Q >= detail::cayley_operand<Mr>::rank), complex_it<T, Q> >::type &
+{
+    detail::add_operand_product<true, ConjugateMd, ConjugateMr>( accumulator,
+     multiplicand, multiplier );
+    return accumulator;
+}
+
+/** \brief  Fused multiply-add, Cayley
+
+Calculates the product of the first two values plus the third, with the
+product accumulated straight into the result.
+
+    \relatesalso  #boost::math::complex_it
+
+    \param[in] multiplicand  The first factor to be multiplied.
+    \param[in] multiplier    The second factor to be multiplied.
+    \param[in] addend        The value to be added.
+
+    \returns  `multiplicand * multiplier + addend`.
+ */
+template < typename T, std::size_t R, typename U, std::size_t S, typename V,
+ std::size_t Q >
+auto  fma( complex_it<T, R> const &multiplicand, complex_it<U, S> const
+ &multiplier, complex_it<V, Q> const &addend )
+ -> decltype( multiplicand * multiplier + addend )
+{
+    decltype( multiplicand * multiplier + addend )  result( addend );
+
+    return fma_assign( result, multiplicand, multiplier );
+}
+
+/** \brief  Fused multiply-subtract, Cayley
+
+Calculates the product of the first two values minus the third, with the
+product accumulated straight into the result.
+
+    \relatesalso  #boost::math::complex_it
+
+    \param[in] multiplicand  The first factor to be multiplied.
+    \param[in] multiplier    The second factor to be multiplied.
+    \param[in] subtrahend    The value to be subtracted.
+
+    \returns  `multiplicand * multiplier - subtrahend`.
+ */
+template < typename T, std::size_t R, typename U, std::size_t S, typename V,
+ std::size_t Q >
+auto  fms( complex_it<T, R> const &multiplicand, complex_it<U, S> const
+ &multiplier, complex_it<V, Q> const &subtrahend )
+ -> decltype( multiplicand * multiplier - subtrahend )
+{
+    decltype( multiplicand * multiplier - subtrahend )  result{};
+
+    fma_assign( result, multiplicand, multiplier );
+    return result -= subtrahend;
+}
+
+
+//  Barrage view class template definitions  ---------------------------------//
+
+/** \brief  Non-owning, read-only view of a flat hypercomplex component array
+
+Refers to `2^Rank` contiguous components, such as a whole `complex_it<Number,
+Rank>` or one of the barrages of a higher-ranked `complex_it`, without copying
+them.  Splitting a view into its barrages gives views again, so recursive
+algorithms can work on any level of the Cayley-Dickson construction in place.
+The arithmetic operators, `norm`, and the fused multiply-add functions take
+views wherever they take `complex_it` values.
+
+    \pre  The viewed components outlive the view.
+
+    \tparam Number  The component type
+    \tparam Rank    The Cayley-Dickson construction level.
+ */
+template < typename Number, std::size_t Rank >
+class const_barrage_view
+{
+public:
+    // Core types
+    //! \copydoc  #boost::math::complex_it::size_type
+    typedef std::size_t                 size_type;
+    //! \copydoc  #boost::math::complex_it::value_type
+    typedef Number                      value_type;
+    //! The type of the viewed value, when copied out.
+    typedef complex_it<Number, Rank>  object_type;
+    //! The view type for each decomposed half.
+    typedef const_barrage_view<Number, Rank - !!Rank>  barrage_type;
+
+    // Sizing parameters
+    //! \copydoc  #boost::math::complex_it::rank
+    static constexpr  size_type  rank = Rank;
+    //! \copydoc  #boost::math::complex_it::static_size
+    static constexpr  size_type  static_size = object_type::static_size;
+
+    /** \brief  View an array of components.
+        \param[in] data  The start of the #static_size components.
+        \post  `this->data() == data`.
+     */
+    explicit constexpr
+    const_barrage_view( value_type const *data ) noexcept
+        : p{ data }
+    {}
+    /** \brief  View a whole number.
+        \param[in] x  The object to view.
+        \post  `this->data() == &x[0]`.
+     */
+    constexpr
+    const_barrage_view( object_type const &x ) noexcept
+        : p{ &x[0] }
+    {}
+
+    //! \copydoc  #boost::math::complex_it::operator[](size_type)const
+    constexpr
+    auto  operator []( size_type i ) const noexcept -> value_type const &
+    { return p[i]; }
+    //! \returns  The start of the viewed components.
+    constexpr
+    auto  data() const noexcept -> value_type const *  { return p; }
+
+    /** \brief  View of the lower decomposed half
+        \returns  A view of the first half of the components, or of all of them
+                  when #rank is 0.
+     */
+    constexpr
+    auto  lower_barrage() const noexcept -> barrage_type
+    { return barrage_type{ p }; }
+    /** \brief  View of the upper decomposed half
+        \returns  A view of the second half of the components, or of all of
+                  them when #rank is 0.
+     */
+    constexpr
+    auto  upper_barrage() const noexcept -> barrage_type
+    { return barrage_type{ p + static_size / 2u }; }
+    //! \copydoc  #lower_barrage
+    constexpr
+    auto  lower_view() const noexcept -> barrage_type
+    { return lower_barrage(); }
+    //! \copydoc  #upper_barrage
+    constexpr
+    auto  upper_view() const noexcept -> barrage_type
+    { return upper_barrage(); }
+
+    /** \brief    Copy out the viewed value
+        \returns  A `complex_it` with the viewed components.
+     */
+    auto  value() const -> object_type
+    {
+        object_type  result;
+
+        std::copy( p, p + static_size, &result[0] );
+        return result;
+    }
+    //! \copydoc  #value
+    operator object_type() const  { return value(); }
+
+    //! \copydoc  #boost::math::complex_it::operator bool
+    explicit
+    operator bool() const
+    { return std::any_of( p, p + static_size, [](value_type const &x){
+     return static_cast<bool>(x); } ); }
+
+private:
+    value_type const *  p;
+};
+
+/** Gives access to a template parameter.
+ */
+template < typename Number, std::size_t Rank >
+constexpr
+typename const_barrage_view<Number, Rank>::size_type
+  const_barrage_view<Number, Rank>::rank;
+
+/** Matches the component count of the viewed type.
+ */
+template < typename Number, std::size_t Rank >
+constexpr
+typename const_barrage_view<Number, Rank>::size_type
+  const_barrage_view<Number, Rank>::static_size;
+
+/** \brief  Non-owning, mutable view of a flat hypercomplex component array
+
+Like #boost::math::const_barrage_view, but writable, with the semantics of a
+reference: copying a view makes another view of the same components, while
+assigning to a view (from a view or a value) overwrites the viewed components.
+The compound-assignment operators and the fused multiply-add functions update
+the viewed components in place.
+
+    \pre  The viewed components outlive the view.
+
+    \tparam Number  The component type
+    \tparam Rank    The Cayley-Dickson construction level.
+ */
+template < typename Number, std::size_t Rank >
+class barrage_view
+{
+public:
+    // Core types
+    //! \copydoc  #boost::math::complex_it::size_type
+    typedef std::size_t                 size_type;
+    //! \copydoc  #boost::math::complex_it::value_type
+    typedef Number                      value_type;
+    //! \copydoc  #boost::math::const_barrage_view::object_type
+    typedef complex_it<Number, Rank>  object_type;
+    //! \copydoc  #boost::math::const_barrage_view::barrage_type
+    typedef barrage_view<Number, Rank - !!Rank>  barrage_type;
+
+    // Sizing parameters
+    //! \copydoc  #boost::math::complex_it::rank
+    static constexpr  size_type  rank = Rank;
+    //! \copydoc  #boost::math::complex_it::static_size
+    static constexpr  size_type  static_size = object_type::static_size;
+
+    //! View an array of components.
+    explicit constexpr
+    barrage_view( value_type *data ) noexcept
+        : p{ data }
+    {}
+    //! View a whole number.
+    barrage_view( object_type &x ) noexcept
+        : p{ &x[0] }
+    {}
+    //! Refer to the same components as another view.
+    barrage_view( barrage_view const & ) = default;
+
+    /** \brief  Overwrite the viewed components.
+        \param[in] x  The new value.  It may overlap the viewed components.
+        \post  `*this == x`.
+        \returns  `*this`.
+     */
+    auto  operator =( const_barrage_view<Number, Rank> const &x ) const
+     -> barrage_view const &
+    {
+        object_type const  v = x;  // might overlap
+
+        std::copy( &v[0], &v[0] + static_size, p );
+        return *this;
+    }
+    //! \overload
+    auto  operator =( barrage_view const &x ) const -> barrage_view const &
+    { return *this = const_barrage_view<Number, Rank>( x.data() ); }
+    //! \overload
+    auto  operator =( object_type const &x ) const -> barrage_view const &
+    { return *this = const_barrage_view<Number, Rank>( x ); }
+
+    /** \brief  Add to the viewed components, in place.
+        \param[in] x  The value to add.
+        \returns  `*this`.
+     */
+    auto  operator +=( const_barrage_view<Number, Rank> const &x ) const
+     -> barrage_view const &
+    {
+        for ( size_type k = 0u ; k < static_size ; ++k )
+            p[ k ] += x[ k ];
+        return *this;
+    }
+    /** \brief  Subtract from the viewed components, in place.
+        \param[in] x  The value to subtract.
+        \returns  `*this`.
+     */
+    auto  operator -=( const_barrage_view<Number, Rank> const &x ) const
+     -> barrage_view const &
+    {
+        for ( size_type k = 0u ; k < static_size ; ++k )
+            p[ k ] -= x[ k ];
+        return *this;
+    }
+    /** \brief  Multiply the viewed value, Cayley, in place.
+        \param[in] x  The right factor.  It may overlap the viewed components.
+        \returns  `*this`.
+     */
+    auto  operator *=( const_barrage_view<Number, Rank> const &x ) const
+     -> barrage_view const &
+    {
+        return *this = detail::operand_product( const_barrage_view<Number,
+         Rank>(p), x );
+    }
+    /** \brief  Scale the viewed components, in place.
+        \param[in] s  The scalar factor.
+        \returns  `*this`.
+     */
+    auto  operator *=( value_type const &s ) const -> barrage_view const &
+    {
+        for ( size_type k = 0u ; k < static_size ; ++k )
+            p[ k ] *= s;
+        return *this;
+    }
+    /** \brief  Divide the viewed components by a scalar, in place.
+        \param[in] s  The scalar divisor.
+        \returns  `*this`.
+     */
+    auto  operator /=( value_type const &s ) const -> barrage_view const &
+    {
+        for ( size_type k = 0u ; k < static_size ; ++k )
+            p[ k ] /= s;
+        return *this;
+    }
+
+    //! \copydoc  #boost::math::complex_it::operator[](size_type)
+    constexpr
+    auto  operator []( size_type i ) const noexcept -> value_type &
+    { return p[i]; }
+    //! \copydoc  #boost::math::const_barrage_view::data
+    constexpr
+    auto  data() const noexcept -> value_type *  { return p; }
+
+    //! \copydoc  #boost::math::const_barrage_view::lower_barrage
+    constexpr
+    auto  lower_barrage() const noexcept -> barrage_type
+    { return barrage_type{ p }; }
+    //! \copydoc  #boost::math::const_barrage_view::upper_barrage
+    constexpr
+    auto  upper_barrage() const noexcept -> barrage_type
+    { return barrage_type{ p + static_size / 2u }; }
+    //! \copydoc  #boost::math::const_barrage_view::lower_barrage
+    constexpr
+    auto  lower_view() const noexcept -> barrage_type
+    { return lower_barrage(); }
+    //! \copydoc  #boost::math::const_barrage_view::upper_barrage
+    constexpr
+    auto  upper_view() const noexcept -> barrage_type
+    { return upper_barrage(); }
+
+    //! \copydoc  #boost::math::const_barrage_view::value
+    auto  value() const -> object_type
+    { return const_barrage_view<Number, Rank>( p ).value(); }
+    //! \copydoc  #boost::math::const_barrage_view::value
+    operator object_type() const  { return value(); }
+    //! Read-only view of the same components.
+    constexpr
+    operator const_barrage_view<Number, Rank>() const noexcept
+    { return const_barrage_view<Number, Rank>( p ); }
+
+    //! \copydoc  #boost::math::complex_it::operator bool
+    explicit
+    operator bool() const
+    { return static_cast<bool>( const_barrage_view<Number, Rank>(p) ); }
+
+private:
+    value_type *  p;
+};
+
+/** Gives access to a template parameter.
+ */
+template < typename Number, std::size_t Rank >
+constexpr
+typename barrage_view<Number, Rank>::size_type
+  barrage_view<Number, Rank>::rank;
+
+/** Matches the component count of the viewed type.
+ */
+template < typename Number, std::size_t Rank >
+constexpr
+typename barrage_view<Number, Rank>::size_type
+  barrage_view<Number, Rank>::static_size;
+
+//! \cond
+namespace detail
+{
+    // Views are Cayley-product operands over their viewed components.
+    template < typename T, std::size_t R >
+    struct cayley_operand< const_barrage_view<T, R> >
+    {
+        typedef T                 value_type;
+        typedef complex_it<T, R>  object_type;
+
+        static constexpr  bool         value = true;
+        static constexpr  std::size_t  rank = R;
+        static constexpr  bool         conjugated = false;
+
+        static  auto  data( const_barrage_view<T, R> const &x ) -> T const *
+        { return x.data(); }
+    };
+
+    template < typename T, std::size_t R >
+    struct cayley_operand< barrage_view<T, R> >
+        : cayley_operand< const_barrage_view<T, R> >
+    {
+        static  auto  data( barrage_view<T, R> const &x ) -> T const *
+        { return x.data(); }
+    };
+
+    // Checks if a type is a view, for the operators shared with numbers.
+    template < class X >
+    struct is_barrage_view
+        : std::false_type
+    { };
+
+    template < typename T, std::size_t R >
+    struct is_barrage_view< const_barrage_view<T, R> >
+        : std::true_type
+    { };
+
+    template < typename T, std::size_t R >
+    struct is_barrage_view< barrage_view<T, R> >
+        : std::true_type
+    { };
+
+    // Checks if two operands, at least one a view, can be read directly.
+    template < class X, class Y >
+    struct is_view_operation
+        : std::integral_constant< bool, (is_barrage_view<X>::value ||
+           is_barrage_view<Y>::value) && cayley_operand<X>::value &&
+           cayley_operand<Y>::value && !cayley_operand<X>::conjugated &&
+           !cayley_operand<Y>::conjugated >
+    { };
+
+    // The result of a component-wise operation on operands of equal rank, at
+    // least one of them a view.
+    template < class X, class Y, class Op, bool = is_view_operation<X,
+     Y>::value && (cayley_operand<X>::rank == cayley_operand<Y>::rank) >
+    struct view_operation
+    { };
+
+    template < class X, class Y, class Op >
+    struct view_operation< X, Y, Op, true >
+    {
+        typedef complex_it<decltype( std::declval<Op>()( std::declval<typename
+         cayley_operand<X>::value_type>(), std::declval<typename
+         cayley_operand<Y>::value_type>()) ), cayley_operand<X>::rank>  type;
+    };
+
+    // The result of a Cayley product with at least one view operand
+    template < class X, class Y, bool = (is_barrage_view<X>::value ||
+     is_barrage_view<Y>::value) && cayley_operand<X>::value &&
+     cayley_operand<Y>::value >
+    struct view_product
+    { };
+
+    template < class X, class Y >
+    struct view_product< X, Y, true >
+        : cayley_operand_product< X, Y >
+    { };
+
+    // Component-wise operation objects
+    struct view_plus
+    {
+        template < typename T, typename U >
+        auto  operator ()( T const &a, U const &b ) const -> decltype( a + b )
+        { return a + b; }
+    };
+
+    struct view_minus
+    {
+        template < typename T, typename U >
+        auto  operator ()( T const &a, U const &b ) const -> decltype( a - b )
+        { return a - b; }
+    };
+
+    // Apply a component-wise operation, reading operands through their arrays.
+    template < class X, class Y, class Op >
+    auto  view_apply( X const &x, Y const &y, Op op )
+     -> typename view_operation<X, Y, Op>::type
+    {
+        typename view_operation<X, Y, Op>::type  result;
+        auto const * const  xx = cayley_operand<X>::data( x );
+        auto const * const  yy = cayley_operand<Y>::data( y );
+
+        for ( std::size_t k = 0u ; k < result.static_size ; ++k )
+            result[ k ] = op( xx[k], yy[k] );
+        return result;
+    }
+
+}  // namespace detail
+//! \endcond
+
+
+//  Barrage view operators and functions  ------------------------------------//
+
+/** \brief  Negation, viewed value
+
+    \relates  #boost::math::const_barrage_view
+    \relatesalso  #boost::math::barrage_view
+
+    \param[in] x  The input view.
+
+    \returns  `-x.value()`.
+ */
+template < class X >
+inline
+auto  operator -( X const &x )
+ -> typename std::enable_if< detail::is_barrage_view<X>::value,
+ decltype( -x.value() ) >::type
+{ return -x.value(); }
+
+/** \brief  Complex conjugate, viewed value
+
+    \relates  #boost::math::const_barrage_view
+    \relatesalso  #boost::math::barrage_view
+
+    \param[in] x  The input view.
+
+    \returns  `~x.value()`.
+ */
+template < class X >
+inline
+auto  operator ~( X const &x )
+ -> typename std::enable_if< detail::is_barrage_view<X>::value,
+ typename X::object_type >::type
+{ return ~x.value(); }
+
+/** \brief  Addition, with views
+
+Adds two values of the same rank, at least one of them a view, reading the
+viewed components in place.
+
+    \relates  #boost::math::const_barrage_view
+    \relatesalso  #boost::math::barrage_view
+
+    \param[in] augend  The first value to be added.
+    \param[in] addend  The second value to be added.
+
+    \returns  The sum of `augend` and `addend`.
+ */
+template < class X, class Y >
+inline
+auto  operator +( X const &augend, Y const &addend )
+ -> typename detail::view_operation<X, Y, detail::view_plus>::type
+{ return detail::view_apply( augend, addend, detail::view_plus{} ); }
+
+/** \brief  Subtraction, with views
+
+Subtracts two values of the same rank, at least one of them a view, reading the
+viewed components in place.
+
+    \relates  #boost::math::const_barrage_view
+    \relatesalso  #boost::math::barrage_view
+
+    \param[in] minuend     The value to be subtracted from.
+    \param[in] subtrahend  The value to subtract.
+
+    \returns  The difference of `minuend` and `subtrahend`.
+ */
+template < class X, class Y >
+inline
+auto  operator -( X const &minuend, Y const &subtrahend )
+ -> typename detail::view_operation<X, Y, detail::view_minus>::type
+{ return detail::view_apply( minuend, subtrahend, detail::view_minus{} ); }
+
+/** \brief  Multiplication, Cayley, with views
+
+Calculates the product of two values, at least one of them a view, reading the
+viewed components in place.  The operands may be of different ranks, and either
+may be a #boost::math::conjugate_expression.
+
+    \relates  #boost::math::const_barrage_view
+    \relatesalso  #boost::math::barrage_view
+
+    \param[in] multiplicand  The first factor to be multiplied.
+    \param[in] multiplier    The second factor to be multiplied.
+
+    \returns  The product of `multiplicand` and `multiplier`.
+ */
+template < class X, class Y >
+inline
+auto  operator *( X const &multiplicand, Y const &multiplier )
+ -> typename detail::view_product<X, Y>::type
+{ return detail::operand_product( multiplicand, multiplier ); }
+
+/** \brief  Multiplication, viewed value by scalar
+
+    \relates  #boost::math::const_barrage_view
+    \relatesalso  #boost::math::barrage_view
+
+    \param[in] multiplicand  The view of the value to be scaled.
+    \param[in] multiplier    The scalar factor.
+
+    \returns  `multiplicand.value() * multiplier`.
+ */
+template < class X >
+inline
+auto  operator *( X const &multiplicand, typename X::value_type const
+ &multiplier ) -> typename std::enable_if< detail::is_barrage_view<X>::value,
+ typename X::object_type >::type
+{
+    typename X::object_type  result;
+
+    for ( std::size_t k = 0u ; k < result.static_size ; ++k )
+        result[ k ] = multiplicand[ k ] * multiplier;
+    return result;
+}
+
+/** \brief  Division, viewed value by scalar
+
+    \relates  #boost::math::const_barrage_view
+    \relatesalso  #boost::math::barrage_view
+
+    \param[in] dividend  The view of the value to be divided.
+    \param[in] divisor   The scalar divisor.
+
+    \returns  `dividend.value() / divisor`.
+ */
+template < class X >
+inline
+auto  operator /( X const &dividend, typename X::value_type const &divisor )
+ -> typename std::enable_if< detail::is_barrage_view<X>::value,
+ typename X::object_type >::type
+{
+    typename X::object_type  result;
+
+    for ( std::size_t k = 0u ; k < result.static_size ; ++k )
+        result[ k ] = dividend[ k ] / divisor;
+    return result;
+}
 
-    \pre  `declval<T>() * declval<U>()` is well-formed.
-    \pre  The various additive/subtractive operators are well-formed.
+/** \brief  Equality, with views
 
-    \param[in] multiplicand  The first factor to be multiplied.
-    \param[in] multiplier    The second factor to be multiplied.
+Compares two values of the same rank, at least one of them a view, reading the
+viewed components in place.
 
-    \returns  The product of `multiplicand` and `multiplier`.
+    \relates  #boost::math::const_barrage_view
+    \relatesalso  #boost::math::barrage_view
+
+    \param[in] l  The left-side operand to be compared.
+    \param[in] r  The right-side operand to be compared.
+
+    \returns  Whether the components are pair-wise equal.
  */
-template < typename T, std::size_t R, typename U, std::size_t S >
+template < class X, class Y >
 inline
-auto  operator *( complex_it<T, R> const &multiplicand, complex_it<U, S> const
- &multiplier )
- -> complex_it<decltype( std::declval<T>() * std::declval<U>() ), ( R < S ) ? S
- : R>
+auto  operator ==( X const &l, Y const &r )
+ -> typename std::enable_if< detail::is_view_operation<X, Y>::value &&
+ (detail::cayley_operand<X>::rank == detail::cayley_operand<Y>::rank),
+ bool >::type
 {
-    decltype( multiplicand * multiplier )  product{};
+    auto const * const  ll = detail::cayley_operand<X>::data( l );
 
-    detail::add_cayley_product( &product[0], false, &multiplicand[0], R, false,
-     &multiplier[0], S, false );
-    return product;
+    return std::equal( ll, ll + (std::size_t(1) << detail::cayley_operand<
+     X>::rank), detail::cayley_operand<Y>::data(r) );
 }
 
-/** \brief  Multiply-and-assign, scalar
+/** \brief  Inequality, with views
 
-Calculates the product of the given objects into the first.
+    \relates  #boost::math::const_barrage_view
+    \relatesalso  #boost::math::barrage_view
 
-    \relates  #boost::math::complex_it
+    \param[in] l  The left-side operand to be compared.
+    \param[in] r  The right-side operand to be compared.
 
-    \pre  `declval<T &>() *= declval<T>()` is well-formed.
+    \returns  `!( l == r )`.
+ */
+template < class X, class Y >
+inline
+auto  operator !=( X const &l, Y const &r )
+ -> typename std::enable_if< detail::is_view_operation<X, Y>::value &&
+ (detail::cayley_operand<X>::rank == detail::cayley_operand<Y>::rank),
+ bool >::type
+{ return !( l == r ); }
 
-    \param[in,out] multiplicand_product  The first factor to be multiplied, and
-                                         the location of the future product.
-    \param[in]     multiplier            The second factor to be multiplied.
+/** \brief  Cayley norm, viewed value
 
-    \returns  A reference to post-multiplication `multiplicand_product`.
+    \relates  #boost::math::const_barrage_view
+    \relatesalso  #boost::math::barrage_view
+
+    \param[in] x  The input view.
+
+    \returns  `norm( x.value() )`, computed in place.
  */
-template < typename T, std::size_t R >
-auto  operator *=( complex_it<T, R> &multiplicand_product, T const &multiplier )
- -> complex_it<T, R> &
+template < class X >
+auto  norm( X const &x ) -> typename std::enable_if<
+ detail::is_barrage_view<X>::value, decltype( std::declval<typename
+ X::value_type>() * std::declval<typename X::value_type>() ) >::type
 {
-    for ( auto &mp : multiplicand_product )
-        mp *= multiplier;
-    return multiplicand_product;
+    return std::inner_product( x.data(), x.data() + x.static_size, x.data(),
+     decltype(norm( x )){} );
 }
 
-/** \brief  Multiply-and-assign, Cayley
+/** \brief  Multiply-and-accumulate, Cayley, into a view
 
-Calculates the product of the given objects into the first.
+Like #boost::math::fma_assign for `complex_it` accumulators, but updates the
+viewed components in place, so a sub-barrage of a larger number can accumulate
+a product directly.
 
-    \relates  #boost::math::complex_it
+    \relates  #boost::math::barrage_view
 
-    \pre  `declval<T &>() *= declval<U>()` is well-formed.
-    \pre  The various additive/subtractive operators are well-formed.
-    \pre  `multiplier`'s rank doesn't exceed that of `multiplicand_product`.
+    \tparam ConjugateMd  Whether `conj( multiplicand )` is used instead.
+    \tparam ConjugateMr  Whether `conj( multiplier )` is used instead.
 
-    \param[in,out] multiplicand_product  The first factor to be added, and the
-                                         location of the future product.
-    \param[in]     multiplier            The second factor to be multiplied.
+    \param[in] accumulator   The view of the components to be added to.  They
+                             may overlap either factor.
+    \param[in] multiplicand  The first factor to be multiplied.
+    \param[in] multiplier    The second factor to be multiplied.
 
-    \returns  A reference to post-multiplication `multiplicand_product`.
+    \returns  `accumulator`.
  */
-template < typename T, std::size_t R, typename U, std::size_t S >
+template < bool ConjugateMd = false, bool ConjugateMr = false, typename T,
+ std::size_t Q, class Md, class Mr >
 inline
-auto  operator *=( complex_it<T, R> &multiplicand_product, complex_it<U, S>
+auto  fma_assign( barrage_view<T, Q> accumulator, Md const &multiplicand, Mr
  const &multiplier )
- -> typename std::enable_if< (R >= S), complex_it<T, R> >::type &
-{ return multiplicand_product = multiplicand_product * multiplier; }
+ -> typename std::enable_if< detail::cayley_operand<Md>::value &&
+ detail::cayley_operand<Mr>::value && (Q >= detail::cayley_operand<Md>::rank)
+ && (Q >= detail::cayley_operand<Mr>::rank), barrage_view<T, Q> >::type
+{
+    detail::add_operand_product<false, ConjugateMd, ConjugateMr, Q>(
+     accumulator.data(), multiplicand, multiplier );
+    return accumulator;
+}
+
+/** \brief  Multiply-and-deduct, Cayley, into a view
+
+    \relates  #boost::math::barrage_view
+
+    \see  #boost::math::fma_assign
+
+    \tparam ConjugateMd  Whether `conj( multiplicand )` is used instead.
+    \tparam ConjugateMr  Whether `conj( multiplier )` is used instead.
+
+    \param[in] accumulator   The view of the components to be subtracted from.
+    \param[in] multiplicand  The first factor to be multiplied.
+    \param[in] multiplier    The second factor to be multiplied.
+
+    \returns  `accumulator`.
+ */
+template < bool ConjugateMd = false, bool ConjugateMr = false, typename T,
+ std::size_t Q, class Md, class Mr >
+inline
+auto  fms_assign( barrage_view<T, Q> accumulator, Md const &multiplicand, Mr
+ const &multiplier )
+ -> typename std::enable_if< detail::cayley_operand<Md>::value &&
+ detail::cayley_operand<Mr>::value && (Q >= detail::cayley_operand<Md>::rank)
+ && (Q >= detail::cayley_operand<Mr>::rank), barrage_view<T, Q> >::type
+{
+    detail::add_operand_product<true, ConjugateMd, ConjugateMr, Q>(
+     accumulator.data(), multiplicand, multiplier );
+    return accumulator;
+}
 
 
 //  Division operators  ------------------------------------------------------//
 
+//! \cond
+namespace detail
+{
+    // Whether a value of a bounded type is finite and, unless zero, normal
+    template < typename T >
+    bool  in_normal_range( T const &x, std::true_type )
+    {
+        T const  magnitude = ( x < T{} ) ? T( -x ) : x;
+
+        // (NaN fails every comparison.)
+        return magnitude <= std::numeric_limits<T>::max() && ( magnitude == T{}
+         || magnitude >= std::numeric_limits<T>::min() );
+    }
+
+    // Values of unbounded types are always in range
+    template < typename T >
+    constexpr
+    bool  in_normal_range( T const &, std::false_type )  { return true; }
+
+    // The largest component magnitude, without needing abs
+    template < class X >
+    auto  largest_magnitude( X const &x ) -> typename X::value_type
+    {
+        typedef typename X::value_type  T;
+
+        T  result{};
+
+        for ( auto const &xx : x )
+        {
+            T const  magnitude = ( xx < T{} ) ? T( -xx ) : xx;
+
+            if ( result < magnitude )
+                result = magnitude;
+        }
+        return result;
+    }
+
+    // Write back a Cayley product (or deferred conjugate) divided by a norm:
+    // truncating division for integer types, which can't go out of range
+    template < typename Q, std::size_t R, class Product, typename N >
+    bool  scale_quotient( complex_it<Q, R> &quotient, Product const &product,
+     N const &norm, std::true_type )
+    {
+        typedef typename Product::value_type  P;
+
+        P const  divisor = static_cast<P>( norm );
+
+        for ( std::size_t i = 0u ; i < quotient.static_size ; ++i )
+            quotient[ i ] = product[ i ] / divisor;
+        return true;
+    }
+
+    // Write back a Cayley product (or deferred conjugate) divided by a norm:
+    // reciprocal multiplication otherwise.  Returns false if the reciprocal
+    // overflowed or underflowed (to zero or a subnormal), or a product
+    // component did, so the quotient can't be trusted.
+    template < typename Q, std::size_t R, class Product, typename N >
+    bool  scale_quotient( complex_it<Q, R> &quotient, Product const &product,
+     N const &norm, std::false_type )
+    {
+        typedef typename Product::value_type  P;
+        typedef std::integral_constant<bool,
+         std::numeric_limits<P>::is_bounded>  bounded;
+
+        P  scale{};
+
+        ++scale;
+        scale /= norm;
+
+        bool  in_range = scale != P{} && in_normal_range( scale, bounded{} );
+
+        for ( std::size_t i = 0u ; i < quotient.static_size ; ++i )
+        {
+            P const  p = product[ i ];
+
+            in_range = in_normal_range( p, bounded{} ) && in_range;
+            quotient[ i ] = p * scale;
+        }
+        return in_range;
+    }
+
+    // Dividend * Inv(Divisor), or Inv(Divisor) * Dividend when DivisorFirst,
+    // for when scale_quotient fails.  The divisor is first scaled down by its
+    // largest component, so its norm stays near 1 and no intermediate result
+    // leaves the component type's range unless the quotient itself does.
+    template < bool DivisorFirst, typename Q, std::size_t R, class Dd,
+     typename U, std::size_t S >
+    void  prescaled_quotient( complex_it<Q, R> &quotient, Dd const &dividend,
+     complex_it<U, S> const &divisor )
+    {
+        U const     largest = largest_magnitude( divisor );
+        auto const  unit = divisor / largest;
+        auto const  reciprocal = conj( unit ) / norm( unit );
+        auto const  product = DivisorFirst ? reciprocal * dividend : dividend *
+         reciprocal;
+
+        for ( std::size_t i = 0u ; i < quotient.static_size ; ++i )
+            quotient[ i ] = product[ i ] / largest;
+    }
+
+    // The quotient type for two operands
+    template < class Dd, class Dr >
+    struct cayley_operand_quotient
+    {
+        typedef complex_it<decltype( std::declval<typename
+         cayley_operand<Dd>::value_type>() / std::declval<typename
+         cayley_operand<Dr>::value_type>() ), (cayley_operand<Dd>::rank <
+         cayley_operand<Dr>::rank) ? cayley_operand<Dr>::rank :
+         cayley_operand<Dd>::rank>  type;
+    };
+
+    // Dividend * Conj(Divisor) / Norm(Divisor), or Conj(Divisor) * Dividend /
+    // Norm(Divisor) when DivisorFirst, with the conjugation as a kernel flag
+    // (cancelling any deferred conjugation of the divisor)
+    template < bool DivisorFirst, class Dd, class Dr >
+    auto  cayley_quotient( Dd const &dividend, Dr const &divisor )
+     -> typename cayley_operand_quotient<Dd, Dr>::type
+    {
+        typedef cayley_operand<Dd>  dd_traits;
+        typedef cayley_operand<Dr>  dr_traits;
+
+        typename cayley_operand_product<Dd, Dr>::type    product{};
+        typename cayley_operand_quotient<Dd, Dr>::type  quotient;
+
+        if ( DivisorFirst )
+            add_cayley_product<false, dr_traits::rank, !dr_traits::conjugated,
+             dd_traits::rank, dd_traits::conjugated>( &product[0],
+             dr_traits::data(divisor), dd_traits::data(dividend) );
+        else
+            add_cayley_product<false, dd_traits::rank, dd_traits::conjugated,
+             dr_traits::rank, !dr_traits::conjugated>( &product[0],
+             dd_traits::data(dividend), dr_traits::data(divisor) );
+        if ( !scale_quotient(quotient, product, norm( divisor ),
+         std::integral_constant<bool, std::numeric_limits<typename
+         dr_traits::value_type>::is_integer>{}) )
+            prescaled_quotient<DivisorFirst>( quotient, dividend, typename
+             dr_traits::object_type(divisor) );
+        return quotient;
+    }
+
+}  // namespace detail
+//! \endcond
+
 /** \brief  Division, scalar
 
 Calculates the quotient of the given values.  The divisor is a real scalar;
@@ -1489,26 +3253,53 @@ auto  operator /( complex_it<T, R> const &dividend, T const &divisor )
     return quotient;
 }
 
+/** \overload
+    \relates  #boost::math::conjugate_expression
+
+    The conjugation is applied while dividing; no negated copy is made.
+ */
+template < typename T, std::size_t R >
+auto  operator /( conjugate_expression<T, R> const &dividend, T const &divisor )
+ -> complex_it<decltype( std::declval<T>() / std::declval<T>() ), R>
+{
+    complex_it<decltype( std::declval<T>() / std::declval<T>() ), R>  quotient;
+    auto const &                                                      x =
+     dividend.argument();
+
+    quotient[ 0 ] = x[ 0 ] / divisor;
+    for ( std::size_t i = 1u ; i < quotient.static_size ; ++i )
+        quotient[ i ] = -x[ i ] / divisor;
+    return quotient;
+}
+
 /** \brief  Division, Cayley
 
 Calculates the quotient of the given values, where both operands are
 hypercomplex.  Division works via multiplication of a reciprocal (which makes it
 an exact-quotient type of division).  The dividend is the left-factor (a.k.a.
 the multiplicand) in this altered multiplication, and the reciprocal of the
-divisor is the right factor (a.k.a. the multiplier).
+divisor is the right factor (a.k.a. the multiplier).  So this is right division;
+#boost::math::left_divide is the counterpart.
 
 The problem with just computing the divisor's reciprocal is integer types.  The
 reciprocal of a hypercomplex number is its conjugate divided by its (scalar)
 Cayley norm.  The norm is always larger than any of the components, so the
 reciprocal always reduces to zero in integer arithmetic.  To prevent this, the
-dividend should be multiplied by the divisor's conjugate before the scalar
-division by the divisor's norm, to ensure that the first product is large enough
-to give a useful answer after the division.  This method of applying the
-operations can work in general, but it risks overflow, so it's safer to not use
-it for types that don't need it.
-
-This function uses traits from `std::numeric_limits` to determine if a
-component type is integral before determining the order of operations.
+dividend is multiplied by the divisor's conjugate before the scalar division by
+the divisor's norm, to ensure that the first product is large enough to give a
+useful answer after the division.  This method of applying the operations can
+work in general, but it risks overflow.
+
+The work is fused into one pass: the conjugation is folded into the Cayley
+product, and each product component is divided by the norm (for integer
+types, truncating as before) or multiplied by the norm's reciprocal, computed
+once (for other types), as it is written to the quotient.  For bounded
+non-integer types, if that reciprocal or a product component overflows or
+becomes subnormal, the quotient is redone the safer way: the divisor is scaled
+down by its largest component, and the dividend is multiplied by the scaled
+reciprocal before the scale is divided back out.  This function uses traits
+from `std::numeric_limits` to determine if a component type is integral or
+bounded.
 
     \relates  #boost::math::complex_it
 
@@ -1526,25 +3317,71 @@ template < typename T, std::size_t R, typename U, std::size_t S >
 inline
 auto  operator /( complex_it<T, R> const &dividend, complex_it<U, S> const
  &divisor )
- -> typename std::enable_if< std::numeric_limits<U>::is_integer,
- complex_it<decltype( std::declval<T>() / std::declval<U>() ), ( R < S ) ? S :
- R> >::type  // for integers
-{
-    return (dividend * conj( divisor )) / static_cast<decltype(
-     std::declval<T>() * std::declval<U>() )>(norm( divisor ));
-}
+ -> complex_it<decltype( std::declval<T>() / std::declval<U>() ), ( R < S ) ? S
+ : R>
+{ return detail::cayley_quotient<false>( dividend, divisor ); }
 
 /** \overload
-    \relates  #boost::math::complex_it
+    \relates  #boost::math::conjugate_expression
+
+    The conjugation is applied while dividing; no negated copy is made.
  */
 template < typename T, std::size_t R, typename U, std::size_t S >
 inline
-auto  operator /( complex_it<T, R> const &dividend, complex_it<U, S> const
- &divisor )
- -> typename std::enable_if< not std::numeric_limits<U>::is_integer,
- complex_it<decltype( std::declval<T>() / std::declval<U>() ), ( R < S ) ? S :
- R> >::type
-{ return dividend * (conj( divisor ) / norm( divisor )); }  // for non-integers
+auto  operator /( conjugate_expression<T, R> const &dividend, complex_it<U, S>
+ const &divisor )
+ -> complex_it<decltype( std::declval<T>() / std::declval<U>() ), ( R < S ) ? S
+ : R>
+{ return detail::cayley_quotient<false>( dividend, divisor ); }
+
+/** \overload
+    \relates  #boost::math::conjugate_expression
+ */
+template < typename T, std::size_t R, typename U, std::size_t S >
+inline
+auto  operator /( complex_it<T, R> const &dividend, conjugate_expression<U, S>
+ const &divisor )
+ -> complex_it<decltype( std::declval<T>() / std::declval<U>() ), ( R < S ) ? S
+ : R>
+{ return detail::cayley_quotient<false>( dividend, divisor ); }
+
+/** \overload
+    \relates  #boost::math::conjugate_expression
+ */
+template < typename T, std::size_t R, typename U, std::size_t S >
+inline
+auto  operator /( conjugate_expression<T, R> const &dividend,
+ conjugate_expression<U, S> const &divisor )
+ -> complex_it<decltype( std::declval<T>() / std::declval<U>() ), ( R < S ) ? S
+ : R>
+{ return detail::cayley_quotient<false>( dividend, divisor ); }
+
+/** \brief  Left division, Cayley
+
+Calculates the quotient of the given values with the reciprocal of the divisor
+as the *left* factor, i.e. `Inv(divisor) * dividend`.  Since hypercomplex
+multiplication is not commutative (past rank 1), this generally differs from
+`dividend / divisor`.  It uses the same fused kernel as the division operator.
+
+    \relatesalso  #boost::math::complex_it
+
+    \see  #boost::math::operator/(complex_it<T,R>const&,complex_it<U,S>const&)
+
+    \pre  `declval<T>() / declval<U>()` is well-formed.
+    \pre  `divisor` is *not* zero.
+
+    \param[in] divisor   The value to divide by.
+    \param[in] dividend  The value to be divided.
+
+    \returns  `Conj(divisor) * dividend / Norm(divisor)`.
+ */
+template < typename T, std::size_t R, typename U, std::size_t S >
+inline
+auto  left_divide( complex_it<U, S> const &divisor, complex_it<T, R> const
+ &dividend )
+ -> complex_it<decltype( std::declval<T>() / std::declval<U>() ), ( R < S ) ? S
+ : R>
+{ return detail::cayley_quotient<true>( dividend, divisor ); }
 
 /** \brief  Modulo, scalar
 
@@ -1620,7 +3457,10 @@ auto  operator %( complex_it<T, R> const &dividend, complex_it<U, S> const
  &divisor )
  -> complex_it<decltype( std::declval<T>() % std::declval<U>() ), ( R < S ) ?
  S : R>
-{ return dividend - ((dividend * conj(divisor)) / norm( divisor )) * divisor; }
+{
+    return dividend - ((dividend * lazy_conj(divisor)) / norm( divisor )) *
+     divisor;
+}
 
 /** \brief  Divide-and-assign
 
@@ -1661,26 +3501,10 @@ template < typename T, std::size_t R, typename U, std::size_t S >
 inline
 auto  operator /=( complex_it<T, R> &dividend_quotient, complex_it<U, S> const
  &divisor )
- -> typename std::enable_if< (R >= S) && std::numeric_limits<U>::is_integer,
- complex_it<T, R> >::type &
-{
-    dividend_quotient *= conj( divisor );
-    dividend_quotient /= norm( divisor );
-    return dividend_quotient;
-}
-
-/** \overload
-    \relates  #boost::math::complex_it
- */
-template < typename T, std::size_t R, typename U, std::size_t S >
-inline
-auto  operator /=( complex_it<T, R> &dividend_quotient, complex_it<U, S> const
- &divisor )
- -> typename std::enable_if< (R >= S) && not std::numeric_limits<U>::is_integer,
- complex_it<T, R> >::type &
+ -> typename std::enable_if< (R >= S), complex_it<T, R> >::type &
 {
-    dividend_quotient *= conj( divisor ) / norm( divisor );
-    return dividend_quotient;
+    return dividend_quotient = detail::cayley_quotient<false>(
+     dividend_quotient, divisor );
 }
 
 /** \brief  Modulo-and-assign
@@ -1892,6 +3716,184 @@ auto  sgn( complex_it<T, R> const &x ) -> complex_it<T, R>
 { return x ? x / abs(x) : x; }
 
 
+//  Power functions  ---------------------------------------------------------//
+
+//! \cond
+namespace detail
+{
+    // Reciprocal of a positive, normal float: a bit-level estimate (off by at
+    // most about 5%), then Newton steps that each square the relative error.
+    inline
+    auto  approximate_reciprocal( float x ) noexcept -> float
+    {
+        std::uint32_t  bits;
+        float          r;
+
+        std::memcpy( &bits, &x, sizeof(bits) );
+        bits = UINT32_C( 0x7EF311C3 ) - bits;
+        std::memcpy( &r, &bits, sizeof(r) );
+        r *= 2.0f - x * r;
+        r *= 2.0f - x * r;
+        r *= 2.0f - x * r;
+        return r;
+    }
+
+}  // namespace detail
+//! \endcond
+
+/** \brief  Multiplicative inverse
+
+Returns the reciprocal of the given value, its conjugate divided by its Cayley
+norm.  The norm is computed once; the conjugation is applied while writing the
+result.  For non-integer component types, the norm's reciprocal is computed once
+and multiplied into each component.  (For integer component types, each
+component is divided by the norm, so only units have non-zero inverses.)
+If that reciprocal overflows or becomes subnormal, the value is scaled down by
+its largest component first, as Cayley division does.
+
+    \relatesalso  #boost::math::complex_it
+
+    \pre  `x` is *not* zero.
+
+    \param[in] x  The input value.
+
+    \returns  `Inv(x) := Conj(x) / Norm(x)`, so `x * Inv(x) == Inv(x) * x == 1`.
+ */
+template < typename T, std::size_t R >
+auto  inverse( complex_it<T, R> const &x )
+ -> complex_it<decltype( std::declval<T>() / std::declval<T>() ), R>
+{
+    complex_it<decltype( std::declval<T>() / std::declval<T>() ), R>  result;
+    T                                                                 one{};
+
+    ++one;
+    if ( !detail::scale_quotient(result, lazy_conj( x ), norm( x ),
+     std::integral_constant<bool, std::numeric_limits<T>::is_integer>{}) )
+        detail::prescaled_quotient<false>( result, complex_it<T, 0u>{one}, x );
+    return result;
+}
+
+/** \brief  Multiplicative inverse, estimated
+
+Returns the reciprocal of the given value, like #boost::math::inverse, but the
+reciprocal of the norm is estimated from its bit pattern and refined with Newton
+steps instead of using a division.  The result is within a few units in the last
+place of the divided version, and the loop over an array of these vectorizes
+with multiplies only.
+
+    \relatesalso  #boost::math::complex_it
+
+    \pre  `Norm(x)` is a positive, normal, finite `float`.
+
+    \param[in] x  The input value.
+
+    \returns  An approximation of `Conj(x) / Norm(x)`.
+ */
+template < std::size_t R >
+auto  approximate_inverse( complex_it<float, R> const &x ) -> complex_it<float,
+ R>
+{
+    float const           scale = detail::approximate_reciprocal( norm(x) );
+    complex_it<float, R>  result;
+
+    result[ 0 ] = x[ 0 ] * scale;
+    for ( std::size_t i = 1u ; i < result.static_size ; ++i )
+        result[ i ] = -x[ i ] * scale;
+    return result;
+}
+
+/** \brief  Square
+
+Returns the given value multiplied by itself.  Every Cayley-Dickson number `x`
+satisfies `x^2 == 2 * Re(x) * x - Norm(x)`, so the square takes one scaling and
+one norm, i.e. work proportional to the number of components, instead of a full
+Cayley product.
+
+    \relatesalso  #boost::math::complex_it
+
+    \param[in] x  The input value.
+
+    \returns  `x * x`.
+ */
+template < typename T, std::size_t R >
+auto  square( complex_it<T, R> const &x ) -> complex_it<T, R>
+{
+    T const           twice_real = x[ 0 ] + x[ 0 ];
+    complex_it<T, R>  result;
+    auto              rb = begin( result );
+
+    for ( auto const &xx : x )
+        *rb++ = twice_real * xx;
+    result[ 0 ] -= norm( x );
+    return result;
+}
+
+/** \brief  Integer power
+
+Returns the given value multiplied by itself the given number of times.  Every
+power of `x` lies in the span of `1` and `x`, and multiplying two such values
+only needs the scalars `2 * Re(x)` and `Norm(x)` (see
+#boost::math::square(complex_it<T,R>const&)).  So this function does binary
+exponentiation on the two scalar coefficients and applies them to `x` at the
+end, for work proportional to the number of components plus `log2(n)` scalar
+steps.
+
+    \relatesalso  #boost::math::complex_it
+
+    \pre  When `n` is negative, `x` is *not* zero and `decltype(x)` should
+          support the exact-quotient style of division.
+
+    \param[in] x  The base.
+    \param[in] n  The exponent.
+
+    \returns  `x^n`, where `x^0 == 1` and `x^(-n) == 1 / x^n`.
+ */
+template < typename T, std::size_t R, typename Integer >
+auto  pow( complex_it<T, R> const &x, Integer n )
+ -> typename std::enable_if< std::is_integral<Integer>::value, complex_it<T,
+ R> >::type
+{
+    // The magnitude is taken unsigned, since -n overflows for the minimum.
+    typedef typename std::make_unsigned<Integer>::type  magnitude_type;
+
+    T  one{};
+
+    ++one;
+    if ( n < Integer{} )
+        return inverse( pow(x, magnitude_type( -magnitude_type(n) )) );
+
+    // x^n == a + b * x, (c + d * x) holds the repeated squares of x.
+    T const  trace = x[ 0 ] + x[ 0 ], cayley_norm = norm( x );
+    T        a = one, b{}, c{}, d = one;
+
+    while ( n )
+    {
+        if ( n & 1 )
+        {
+            T const  bd = b * d, ac = a * c;
+
+            b = a * d + b * c + bd * trace;
+            a = ac - bd * cayley_norm;
+        }
+        if ( n >>= 1 )
+        {
+            T const  dd = d * d, cd = c * d;
+
+            c = c * c - dd * cayley_norm;
+            d = cd + cd + dd * trace;
+        }
+    }
+
+    complex_it<T, R>  result;
+    auto              rb = begin( result );
+
+    for ( auto const &xx : x )
+        *rb++ = b * xx;
+    result[ 0 ] += a;
+    return result;
+}
+
+
 }  // namespace math
 }  // namespace boost
 
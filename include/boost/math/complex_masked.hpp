@@ -0,0 +1,637 @@
+//  Boost Complex Numbers, static sparsity mask header file  -----------------//
+
+//  Copyright 2013 Daryle Walker.
+//  Distributed under the Boost Software License, Version 1.0.  (See the
+//  accompanying file LICENSE_1_0.txt or a copy at
+//  <http://www.boost.org/LICENSE_1_0.txt>.)
+
+//  See <http://www.boost.org/libs/math/> for the library's home page.
+
+/** \file   boost/math/complex_masked.hpp
+    \brief  Hypercomplex numbers with a compile-time set of non-zero components.
+
+    \author  Daryle Walker
+
+    \version  0.1
+
+    \copyright  Boost Software License, version 1.0
+
+    Contains the declaration (and definition) of class template
+    `complex_masked`, a `complex_it` variant that stores only the components
+    picked by a bit mask in its type, such as pure-imaginary quaternions or
+    complex numbers embedded in octonions.  Its operators work out the result's
+    mask, and emit only the component products between stored components, at
+    compile time.
+
+    \warning  This library requires C++2011 features.
+ */
+
+#ifndef BOOST_MATH_COMPLEX_MASKED_HPP
+#define BOOST_MATH_COMPLEX_MASKED_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <type_traits>
+
+#include "boost/math/complex_it.hpp"
+
+
+namespace boost
+{
+namespace math
+{
+
+
+//  Mask computation  --------------------------------------------------------//
+
+//! \cond
+namespace detail
+{
+    // The number of set bits
+    inline constexpr
+    auto  mask_popcount( std::uint64_t m ) noexcept -> std::size_t
+    { return m ? ( m & 1u ) + mask_popcount( m >> 1 ) : 0u; }
+
+    // The bits { i XOR j : j in the first n bits of b }
+    inline constexpr
+    auto  mask_xor_spread( std::uint64_t b, std::size_t i, std::size_t n )
+     noexcept -> std::uint64_t
+    {
+        return n ? ( ((b >> (n - 1u)) & 1u) ? 1ULL << ((n - 1u) ^ i) : 0u ) |
+         mask_xor_spread( b, i, n - 1u ) : 0u;
+    }
+
+    // The bits { i XOR j : i in a, j in b }, for the first n bits
+    inline constexpr
+    auto  mask_product( std::uint64_t a, std::uint64_t b, std::size_t n,
+     std::size_t i = 0u ) noexcept -> std::uint64_t
+    {
+        return ( i < n ) ? ( ((a >> i) & 1u) ? mask_xor_spread(b, i, n) : 0u ) |
+         mask_product( a, b, n, i + 1u ) : 0u;
+    }
+
+    // All of the first n bits
+    inline constexpr
+    auto  mask_low_bits( std::size_t n ) noexcept -> std::uint64_t
+    { return ( n >= 64u ) ? ~0ULL : ( 1ULL << n ) - 1u; }
+
+}  // namespace detail
+//! \endcond
+
+/** \brief  The mask of every component of a rank
+
+    \tparam R  The Cayley-Dickson construction level, at most 6.
+ */
+template < std::size_t R >
+struct full_mask
+    : std::integral_constant< std::uint64_t, detail::mask_low_bits(1ULL << R) >
+{ };
+
+/** \brief  The mask of the unreal components of a rank
+
+E.g. pure-imaginary quaternions, used as 3-vectors, are `complex_masked<T, 2,
+pure_imaginary_mask<2>::value>`.
+
+    \tparam R  The Cayley-Dickson construction level, from 1 to 6.
+ */
+template < std::size_t R >
+struct pure_imaginary_mask
+    : std::integral_constant< std::uint64_t, full_mask<R>::value & ~1ULL >
+{ };
+
+/** \brief  The mask of a lower-rank algebra embedded in a higher one
+
+The first `2^S` components of a rank-`R` value form the rank-`S` algebra, e.g.
+complex numbers within octonions are `complex_masked<T, 3,
+subalgebra_mask<1>::value>`.
+
+    \tparam S  The Cayley-Dickson construction level of the sub-algebra.
+ */
+template < std::size_t S >
+struct subalgebra_mask
+    : full_mask< S >
+{ };
+
+/** \brief  The mask of one basis unit
+
+    \tparam K  The index of the unit.
+ */
+template < std::size_t K >
+struct basis_mask
+    : std::integral_constant< std::uint64_t, 1ULL << K >
+{ };
+
+
+//  Masked hypercomplex number class template definition  --------------------//
+
+/** \brief  A hypercomplex number with compile-time known zero components
+
+Models the values of `complex_it<Number, Rank>` whose components outside of
+`Mask` are zero, storing only the components inside it (in index order).  The
+operators compute their results' masks at compile time, and the Cayley product
+expands, at compile time, to just the component products of stored
+components, so the product of two pure-imaginary quaternions does 9 multiplies
+instead of 16.  Use #boost::math::sandwich_product for rotations.
+
+    \pre  `Number` meets the requirements of #boost::math::complex_it.
+    \pre  `Rank` \<= 6, so the mask fits in 64 bits.
+    \pre  `Mask` is non-zero, with no bits past `2^Rank`.
+
+    \tparam Number  The component type
+    \tparam Rank    The Cayley-Dickson construction level
+    \tparam Mask    Bit `k` is set when component `k` may be non-zero.
+ */
+template < typename Number, std::size_t Rank, std::uint64_t Mask >
+struct complex_masked
+{
+    static_assert( Rank <= 6u, "Masks cover at most 64 components" );
+    static_assert( Mask && !(Mask & ~detail::mask_low_bits(1ULL << Rank)),
+     "Mask must pick some components of the rank, and no others" );
+
+    // Core types
+    //! \copydoc  #boost::math::complex_it::size_type
+    typedef std::size_t                 size_type;
+    //! \copydoc  #boost::math::complex_it::value_type
+    typedef Number                      value_type;
+    //! The type with all the components.
+    typedef complex_it<Number, Rank>  dense_type;
+
+    // Sizing parameters
+    //! \copydoc  #boost::math::complex_it::rank
+    static constexpr  size_type      rank = Rank;
+    //! \copydoc  #boost::math::complex_it::static_size
+    static constexpr  size_type      static_size = 1ULL << rank;
+    //! The components that are stored.  Gives access to a template parameter.
+    static constexpr  std::uint64_t  mask = Mask;
+    //! The number of stored components.
+    static constexpr  size_type      active_size = detail::mask_popcount(
+     Mask );
+
+    /** \brief  Whether a component is stored
+        \param[in] i  The index of the component.
+        \returns  Whether bit `i` of #mask is set.
+     */
+    static constexpr
+    auto  is_active( size_type i ) noexcept -> bool  { return mask >> i & 1u; }
+    /** \brief  Where a component is stored
+        \pre  `is_active( i )`.
+        \param[in] i  The index of the component.
+        \returns  The number of stored components before it.
+     */
+    static constexpr
+    auto  position( size_type i ) noexcept -> size_type
+    { return detail::mask_popcount( mask & ((1ULL << i) - 1u) ); }
+
+    // Constructors
+    //! \copydoc  #boost::math::complex_it::complex_it()
+    constexpr  complex_masked() = default;
+    /** \brief  List-of-stored-components constructor
+
+    The list fills the stored components in order, so the first value is the
+    real component only if #mask includes it.  The constructor is `explicit`,
+    so a lone real doesn't silently land elsewhere.
+
+        \pre  `sizeof...(rest)` \< #active_size.
+
+        \param[in] first  The lowest-indexed stored component.
+        \param[in] rest   The other stored components, by increasing index.
+                          The ones left out are zero.
+     */
+    template < typename ...Args >
+    explicit constexpr
+    complex_masked( value_type const &first, Args const &...rest )
+        : c{ first, rest... }
+    {}
+    /** \brief  Convert from `complex_it`.
+        \pre  The components of `x` outside of #mask are zero.
+        \param[in] x  The source to copy.
+        \post  `dense_type( *this ) == x`.
+     */
+    explicit  complex_masked( dense_type const &x )
+    {
+        for ( size_type i = 0u, k = 0u ; i < static_size ; ++i )
+            if ( is_active(i) )
+                c[ k++ ] = x[ i ];
+    }
+
+    // Conversions
+    /** \brief  Convert to `complex_it`.
+        \returns  The value, with zeros in the components outside of #mask.
+     */
+    operator dense_type() const
+    {
+        dense_type  result{};
+
+        for ( size_type i = 0u, k = 0u ; i < static_size ; ++i )
+            if ( is_active(i) )
+                result[ i ] = c[ k++ ];
+        return result;
+    }
+    //! \copydoc  #boost::math::complex_it::operator bool()const
+    explicit
+    operator bool() const
+    { for (auto const &cc : c) if (cc) return true; return false; }
+
+    // Component(s) access
+    /** \brief  Read a component.
+        \pre  *i* \< #static_size
+        \param[in] i  The index of the selected component.
+        \returns  The component, or zero when it's outside of #mask.
+     */
+    auto  operator []( size_type i ) const -> value_type
+    { return is_active( i ) ? c[ position(i) ] : value_type{}; }
+    /** \brief  Access a stored component.
+        \pre  *k* \< #active_size
+        \param[in] k  The position of the component among the stored ones.
+        \returns  A reference to the component.
+     */
+    constexpr
+    auto  active( size_type k ) const noexcept -> value_type const &
+    { return c[k]; }
+    //! \overload
+    auto  active( size_type k ) noexcept -> value_type &  { return c[k]; }
+
+private:
+    // Member data
+    value_type  c[ active_size ];
+};
+
+/** Gives access to a template parameter.
+ */
+template < typename Number, std::size_t Rank, std::uint64_t Mask >
+constexpr
+typename complex_masked<Number, Rank, Mask>::size_type
+  complex_masked<Number, Rank, Mask>::rank;
+
+/** The component count doubles when going to the next rank.
+ */
+template < typename Number, std::size_t Rank, std::uint64_t Mask >
+constexpr
+typename complex_masked<Number, Rank, Mask>::size_type
+  complex_masked<Number, Rank, Mask>::static_size;
+
+/** Gives access to a template parameter.
+ */
+template < typename Number, std::size_t Rank, std::uint64_t Mask >
+constexpr
+std::uint64_t  complex_masked<Number, Rank, Mask>::mask;
+
+/** One per set bit of the mask.
+ */
+template < typename Number, std::size_t Rank, std::uint64_t Mask >
+constexpr
+typename complex_masked<Number, Rank, Mask>::size_type
+  complex_masked<Number, Rank, Mask>::active_size;
+
+
+//  Tuple interface functions  -----------------------------------------------//
+
+/** \brief  Reads a component of a `complex_masked`.
+
+    \pre  0 \<= *I* \< #boost::math::complex_masked::static_size.
+
+    \tparam I  The index of the desired component.
+
+    \param c  The complex number object containing the component.
+
+    \returns  The component, or zero (decided at compile time) when it's outside
+              of the mask.
+ */
+template < std::size_t I, typename T, std::size_t R, std::uint64_t M >
+inline constexpr
+auto  get( complex_masked<T, R, M> const &c ) -> T
+{
+    static_assert( I < complex_masked<T, R, M>::static_size, "Index too large"
+     );
+
+    return ( M >> I & 1u ) ? c.active( complex_masked<T, R, M>::position(I) ) :
+     T{};
+}
+
+
+//  Equality and output operators  -------------------------------------------//
+
+/** \brief  Equality comparison
+
+Values with different masks compare through `complex_it`.
+
+    \relates  #boost::math::complex_masked
+
+    \param l  The left-side argument.
+    \param r  The right-side argument.
+
+    \returns  Whether every component of *l* equals the corresponding one of
+              *r*.
+ */
+template < typename T, std::size_t R, std::uint64_t M, std::uint64_t N >
+inline
+bool  operator ==( complex_masked<T, R, M> const &l, complex_masked<T, R, N>
+ const &r )
+{ return complex_it<T, R>( l ) == complex_it<T, R>( r ); }
+
+/** \overload
+    \relates  #boost::math::complex_masked
+ */
+template < typename T, std::size_t R, std::uint64_t M >
+bool  operator ==( complex_masked<T, R, M> const &l, complex_masked<T, R, M>
+ const &r )
+{
+    for ( std::size_t k = 0u ; k < l.active_size ; ++k )
+        if ( l.active(k) != r.active(k) )
+            return false;
+    return true;
+}
+
+/** \brief  Inequality comparison
+
+    \relates  #boost::math::complex_masked
+
+    \param l  The left-side argument.
+    \param r  The right-side argument.
+
+    \returns  `!(l == r)`.
+ */
+template < typename T, std::size_t R, std::uint64_t M, std::uint64_t N >
+inline
+bool  operator !=( complex_masked<T, R, M> const &l, complex_masked<T, R, N>
+ const &r )
+{ return not operator ==(l, r); }
+
+/** \brief  Output-streaming
+
+Writes the same text as the `complex_it` with the same value.
+
+    \relatesalso  #boost::math::complex_masked
+
+    \param[in,out] o  The stream to send the output
+    \param[in]     x  The complex number to be written
+
+    \returns  `o`
+ */
+template < typename Ch, class Tr, typename T, std::size_t R, std::uint64_t M >
+inline
+std::basic_ostream<Ch, Tr> &
+operator <<( std::basic_ostream<Ch, Tr> &o, complex_masked<T, R, M> const &x )
+{ return o << complex_it<T, R>( x ); }
+
+
+//  Arithmetic operators  ----------------------------------------------------//
+
+//! \cond
+namespace detail
+{
+    // One component product of a masked Cayley product, for the pair index P
+    // (multiplicand index, then multiplier index).  Pairs that involve an
+    // unstored factor, or land outside the product's mask, do nothing.
+    template < std::size_t P, class Z, class X, class Y, std::size_t I = ( P >>
+     X::rank ), std::size_t J = ( P & (X::static_size - 1u) ), bool Active = (
+     X::is_active(I) && Y::is_active(J) && Z::is_active(I ^ J) ) >
+    struct masked_term
+    {
+        static  void  add( Z &, X const &, Y const & )  {}
+    };
+
+    //! \overload
+    template < std::size_t P, class Z, class X, class Y, std::size_t I,
+     std::size_t J >
+    struct masked_term< P, Z, X, Y, I, J, true >
+    {
+        static  void  add( Z &z, X const &x, Y const &y )
+        {
+            component_product<( basis_product_sign(X::rank, I, J) < 0 )>::add(
+             z.active(Z::position( I ^ J )), x.active(X::position( I )),
+             y.active(Y::position( J )) );
+        }
+    };
+
+    // Adds every term of a masked Cayley product
+    template < class Z, class X, class Y, std::size_t ...P >
+    inline
+    void  add_masked_product( Z &z, X const &x, Y const &y, index_list<P...> )
+    {
+        int const  expand[] = { 0, (masked_term<P, Z, X, Y>::add( z, x, y ),
+         0)... };
+
+        (void)expand;
+    }
+
+    // The product type of two masked values
+    template < class X, class Y >
+    struct masked_product_type
+    {
+        typedef complex_masked<typename X::value_type, X::rank,
+         mask_product(X::mask, Y::mask, X::static_size)>  type;
+    };
+
+}  // namespace detail
+//! \endcond
+
+/** \brief  Negation
+
+    \relates  #boost::math::complex_masked
+
+    \param[in] x  The input value.
+
+    \returns  The additive inverse of `x`, with the same mask.
+ */
+template < typename T, std::size_t R, std::uint64_t M >
+auto  operator -( complex_masked<T, R, M> const &x ) -> complex_masked<T, R, M>
+{
+    complex_masked<T, R, M>  result;
+
+    for ( std::size_t k = 0u ; k < x.active_size ; ++k )
+        result.active( k ) = -x.active( k );
+    return result;
+}
+
+/** \brief  Conjugation
+
+    \relatesalso  #boost::math::complex_masked
+
+    \param[in] x  The input value.
+
+    \returns  `x` with its unreal components negated, with the same mask.
+ */
+template < typename T, std::size_t R, std::uint64_t M >
+auto  conj( complex_masked<T, R, M> const &x ) -> complex_masked<T, R, M>
+{
+    complex_masked<T, R, M>  result = -x;
+
+    if ( M & 1u )
+        result.active( 0 ) = x.active( 0 );
+    return result;
+}
+
+/** \brief  Addition
+
+    \relates  #boost::math::complex_masked
+
+    \param[in] augend  The first term.
+    \param[in] addend  The second term.
+
+    \returns  The sum, with the union of the masks.
+ */
+template < typename T, std::size_t R, std::uint64_t M, std::uint64_t N >
+auto  operator +( complex_masked<T, R, M> const &augend, complex_masked<T, R, N>
+ const &addend ) -> complex_masked<T, R, M | N>
+{
+    typedef complex_masked<T, R, M | N>  sum_type;
+
+    sum_type  sum{};
+
+    for ( std::size_t i = 0u ; i < sum.static_size ; ++i )
+        if ( sum_type::is_active(i) )
+            sum.active( sum_type::position(i) ) = augend[ i ] + addend[ i ];
+    return sum;
+}
+
+/** \brief  Subtraction
+
+    \relates  #boost::math::complex_masked
+
+    \param[in] minuend     The value to be subtracted from.
+    \param[in] subtrahend  The value to subtract.
+
+    \returns  The difference, with the union of the masks.
+ */
+template < typename T, std::size_t R, std::uint64_t M, std::uint64_t N >
+auto  operator -( complex_masked<T, R, M> const &minuend, complex_masked<T, R,
+ N> const &subtrahend ) -> complex_masked<T, R, M | N>
+{
+    typedef complex_masked<T, R, M | N>  difference_type;
+
+    difference_type  difference{};
+
+    for ( std::size_t i = 0u ; i < difference.static_size ; ++i )
+        if ( difference_type::is_active(i) )
+            difference.active( difference_type::position(i) ) = minuend[ i ] -
+             subtrahend[ i ];
+    return difference;
+}
+
+/** \brief  Multiplication, scalar
+
+    \relates  #boost::math::complex_masked
+
+    \param[in] multiplicand  The hypercomplex factor.
+    \param[in] multiplier    The real factor.
+
+    \returns  `multiplicand` with each stored component scaled.
+ */
+template < typename T, std::size_t R, std::uint64_t M >
+auto  operator *( complex_masked<T, R, M> const &multiplicand, T const
+ &multiplier ) -> complex_masked<T, R, M>
+{
+    complex_masked<T, R, M>  product;
+
+    for ( std::size_t k = 0u ; k < product.active_size ; ++k )
+        product.active( k ) = multiplicand.active( k ) * multiplier;
+    return product;
+}
+
+//! \overload
+template < typename T, std::size_t R, std::uint64_t M >
+auto  operator *( T const &multiplicand, complex_masked<T, R, M> const
+ &multiplier ) -> complex_masked<T, R, M>
+{
+    complex_masked<T, R, M>  product;
+
+    for ( std::size_t k = 0u ; k < product.active_size ; ++k )
+        product.active( k ) = multiplicand * multiplier.active( k );
+    return product;
+}
+
+/** \brief  Multiplication, Cayley
+
+The product's mask holds the index XOR of each pair of stored components, and
+the product is a compile-time expansion of just those pairs' component
+products, with their signs from the basis multiplication table.
+
+    \relates  #boost::math::complex_masked
+
+    \param[in] multiplicand  The first factor.
+    \param[in] multiplier    The second factor.
+
+    \returns  The product of `multiplicand` and `multiplier`.
+ */
+template < typename T, std::size_t R, std::uint64_t M, std::uint64_t N >
+auto  operator *( complex_masked<T, R, M> const &multiplicand,
+ complex_masked<T, R, N> const &multiplier ) -> typename
+ detail::masked_product_type<complex_masked<T, R, M>, complex_masked<T, R,
+ N>>::type
+{
+    decltype( multiplicand * multiplier )  product{};
+
+    detail::add_masked_product( product, multiplicand, multiplier,
+     detail::make_index_list<(1ULL << 2u * R)>{} );
+    return product;
+}
+
+/** \brief  Sandwich product, i.e. rotation
+
+Computes `q * v * conj(q)`.  When `v` has no real component, neither has the
+result, since `conj( q * v * conj(q) ) == q * conj(v) * conj(q) == -(q * v *
+conj(q))`; the result then has its real component masked off, and the terms
+that would cancel there are never computed.  For a quaternion `q` and a
+pure-imaginary `v`, that is 24 multiplies, against 32 for two full products.
+
+    \relatesalso  #boost::math::complex_masked
+
+    \param[in] q  The outer factor (e.g. a unit quaternion).
+    \param[in] v  The inner factor (e.g. a 3-vector).
+
+    \returns  `q * v * conj(q)`.
+ */
+template < typename T, std::size_t R, std::uint64_t M, std::uint64_t N >
+auto  sandwich_product( complex_masked<T, R, M> const &q, complex_masked<T, R,
+ N> const &v ) -> complex_masked<T, R, detail::mask_product(
+ detail::mask_product(M, N, 1ULL << R), M, 1ULL << R) & ~std::uint64_t( !(N &
+ 1u) )>
+{
+    decltype( sandwich_product(q, v) )  result{};
+    auto const                          qv = q * v;
+
+    detail::add_masked_product( result, qv, conj(q),
+     detail::make_index_list<(1ULL << 2u * R)>{} );
+    return result;
+}
+
+/** \overload
+    \relatesalso  #boost::math::complex_masked
+ */
+template < typename T, std::size_t R, std::uint64_t N >
+inline
+auto  sandwich_product( complex_it<T, R> const &q, complex_masked<T, R, N> const
+ &v ) -> decltype( sandwich_product(complex_masked<T, R,
+ full_mask<R>::value>( q ), v) )
+{ return sandwich_product( complex_masked<T, R, full_mask<R>::value>(q), v ); }
+
+
+//  Norm functions  ----------------------------------------------------------//
+
+/** \brief  Cayley norm
+
+    \relatesalso  #boost::math::complex_masked
+
+    \param[in] x  The input value.
+
+    \returns  The sum of the squares of the stored components.
+ */
+template < typename T, std::size_t R, std::uint64_t M >
+auto  norm( complex_masked<T, R, M> const &x )
+ -> decltype( std::declval<T>() * std::declval<T>() )
+{
+    decltype( norm(x) )  result{};
+
+    for ( std::size_t k = 0u ; k < x.active_size ; ++k )
+        result += x.active( k ) * x.active( k );
+    return result;
+}
+
+
+}  // namespace math
+}  // namespace boost
+
+
+#endif // BOOST_MATH_COMPLEX_MASKED_HPP
@@ -0,0 +1,379 @@
+//  Boost Complex Numbers, parallel high-rank product header file  -----------//
+
+//  Copyright 2013 Daryle Walker.
+//  Distributed under the Boost Software License, Version 1.0.  (See the
+//  accompanying file LICENSE_1_0.txt or a copy at
+//  <http://www.boost.org/LICENSE_1_0.txt>.)
+
+//  See <http://www.boost.org/libs/math/> for the library's home page.
+
+/** \file   boost/math/complex_parallel.hpp
+    \brief  Cache-blocked, multithreaded Cayley products for very high ranks.
+
+    \author  Daryle Walker
+
+    \version  0.1
+
+    \copyright  Boost Software License, version 1.0
+
+    Contains the declaration (and definition) of class `cayley_thread_pool` and
+    the `blocked_product` functions, which compute the Cayley product of two
+    high-rank (e.g. 2^10 or more components) `complex_it` or `complex_dyn`
+    values in cache-sized tiles spread over several threads.
+
+    \warning  This library requires C++2011 features.
+ */
+
+#ifndef BOOST_MATH_COMPLEX_PARALLEL_HPP
+#define BOOST_MATH_COMPLEX_PARALLEL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "boost/math/complex_dyn.hpp"
+#include "boost/math/complex_it.hpp"
+
+
+namespace boost
+{
+namespace math
+{
+
+
+//  Thread pool class definition  --------------------------------------------//
+
+/** \brief  A fixed set of worker threads for parallel loops
+
+The workers start at construction and wait until #parallel_for hands them a
+loop, so repeated products don't pay for thread creation.  The calling thread
+works on each loop too.  Loops from several threads are run one at a time.
+ */
+class cayley_thread_pool
+{
+public:
+    /** \brief  Start the workers.
+        \param[in] threads  The number of threads to use for each loop,
+                            including the caller's.  If zero, it's taken as
+                            one (i.e. no workers).
+        \post  `this->size() == std::max(threads, 1)`.
+     */
+    explicit  cayley_thread_pool( std::size_t threads =
+     std::thread::hardware_concurrency() )
+        : job{ nullptr }, count{ 0u }, generation{ 0u }, busy{ 0u }, stopping{
+          false }
+    {
+        for ( std::size_t i = 1u ; i < threads ; ++i )
+            workers.emplace_back( &cayley_thread_pool::work, this );
+    }
+    //! Pools are not copyable.
+    cayley_thread_pool( cayley_thread_pool const & ) = delete;
+    //! Stop and join the workers.
+    ~cayley_thread_pool()
+    {
+        {
+            std::lock_guard<std::mutex>  lock( state_mutex );
+
+            stopping = true;
+        }
+        wake.notify_all();
+        for ( auto &w : workers )
+            w.join();
+    }
+
+    //! Pools are not copyable.
+    cayley_thread_pool &  operator =( cayley_thread_pool const & ) = delete;
+
+    //! \returns  The number of threads that run each loop.
+    auto  size() const noexcept -> std::size_t  { return workers.size() + 1u; }
+
+    /** \brief  Run a loop across the threads.
+
+    Calls `f(i)` once for each `i` in [0, `n`), in no particular order, then
+    returns once all the calls are done.
+
+        \pre  Calls with different indices may run at the same time.
+        \pre  `f` doesn't throw.
+
+        \param[in] n  The number of iterations.
+        \param[in] f  The loop body.
+     */
+    void  parallel_for( std::size_t n, std::function<void(std::size_t)> const
+     &f )
+    {
+        std::lock_guard<std::mutex>  run_lock( run_mutex );
+
+        {
+            std::lock_guard<std::mutex>  lock( state_mutex );
+
+            job = &f;
+            count = n;
+            next = 0u;
+            busy = workers.size();
+            ++generation;
+        }
+        wake.notify_all();
+        run_iterations( f, n );
+
+        std::unique_lock<std::mutex>  lock( state_mutex );
+
+        done.wait( lock, [this]{ return !busy; } );
+        job = nullptr;
+    }
+
+private:
+    void  run_iterations( std::function<void(std::size_t)> const &f,
+     std::size_t n )
+    {
+        for ( std::size_t i ; (i = next++) < n ; )
+            f( i );
+    }
+
+    void  work()
+    {
+        std::size_t  seen = 0u;
+
+        for ( ;; )
+        {
+            std::function<void(std::size_t)> const *  f;
+            std::size_t                               n;
+
+            {
+                std::unique_lock<std::mutex>  lock( state_mutex );
+
+                wake.wait( lock, [&]{ return stopping || generation != seen;
+                 } );
+                if ( stopping )
+                    return;
+                seen = generation;
+                f = job;
+                n = count;
+            }
+            run_iterations( *f, n );
+            {
+                std::lock_guard<std::mutex>  lock( state_mutex );
+
+                if ( !--busy )
+                    done.notify_one();
+            }
+        }
+    }
+
+    std::vector<std::thread>                   workers;
+    std::mutex                                 run_mutex, state_mutex;
+    std::condition_variable                    wake, done;
+    std::function<void(std::size_t)> const *  job;
+    std::size_t                                count;
+    std::atomic<std::size_t>                   next;
+    std::size_t                                generation, busy;
+    bool                                       stopping;
+};
+
+/** \brief  The pool used when none is given
+
+    \returns  A pool, made at the first call, with one thread per hardware
+              thread.
+ */
+inline
+auto  default_cayley_thread_pool() -> cayley_thread_pool &
+{
+    static cayley_thread_pool  pool;
+
+    return pool;
+}
+
+
+//  Implementation details  --------------------------------------------------//
+
+//! \cond
+namespace detail
+{
+    // The rank of each tile: 16 components per factor, so a tile product is
+    // 256 multiplies on a few cache lines, and the 8 kernel variants (for the
+    // subtract and conjugate flags) stay small.
+    constexpr  std::size_t  cayley_tile_rank = 4u;
+
+    // The compile-time kernel for one tile product, picked by run-time flags
+    template < typename T >
+    inline
+    void  tile_cayley_product( bool subtract, bool conjugate_md, bool
+     conjugate_mr, T *augend_sum, T const *multiplicand, T const *multiplier )
+    {
+        constexpr std::size_t  L = cayley_tile_rank;
+
+        typedef void (*kernel_type)( T *, T const *, T const * );
+
+        static kernel_type const  kernels[] = {
+            &add_cayley_product<false, L, false, L, false, T, T, T>,
+            &add_cayley_product<false, L, false, L, true, T, T, T>,
+            &add_cayley_product<false, L, true, L, false, T, T, T>,
+            &add_cayley_product<false, L, true, L, true, T, T, T>,
+            &add_cayley_product<true, L, false, L, false, T, T, T>,
+            &add_cayley_product<true, L, false, L, true, T, T, T>,
+            &add_cayley_product<true, L, true, L, false, T, T, T>,
+            &add_cayley_product<true, L, true, L, true, T, T, T>
+        };
+
+        kernels[ 4 * subtract + 2 * conjugate_md + conjugate_mr ]( augend_sum,
+         multiplicand, multiplier );
+    }
+
+    /*  The barrage-wise split of cayley_product_kernel (same-rank case), with
+        the flags at run-time, down to tiles.  Only branches that write within
+        [first, last) are followed, so a caller owning some output tiles does
+        just the tile products that land there, and no other caller writes
+        them.  */
+    template < typename T >
+    void  blocked_cayley_product( std::size_t rank, bool subtract, bool
+     conjugate_md, bool conjugate_mr, T *augend_sum, T const *multiplicand, T
+     const *multiplier, T const *first, T const *last )
+    {
+        std::size_t const  half = std::size_t( 1u ) << ( rank - 1u );
+
+        if ( augend_sum + 2u * half <= first || last <= augend_sum )
+            return;
+        if ( rank == cayley_tile_rank )
+            return tile_cayley_product( subtract, conjugate_md, conjugate_mr,
+             augend_sum, multiplicand, multiplier );
+
+        blocked_cayley_product( rank - 1u, subtract, conjugate_md, conjugate_mr,
+         augend_sum, multiplicand, multiplier, first, last );
+        blocked_cayley_product( rank - 1u, !subtract != (conjugate_mr !=
+         conjugate_md), true, false, augend_sum, multiplier + half, multiplicand
+         + half, first, last );
+        blocked_cayley_product( rank - 1u, subtract != conjugate_mr, false,
+         conjugate_md, augend_sum + half, multiplier + half, multiplicand,
+         first, last );
+        blocked_cayley_product( rank - 1u, subtract != conjugate_md, false,
+         !conjugate_mr, augend_sum + half, multiplicand + half, multiplier,
+         first, last );
+    }
+
+    // Spread the output tiles of a same-rank product over the pool.  Each
+    // task owns a contiguous run of tiles, keeps it in cache, and streams the
+    // input tiles that contribute to it.
+    template < typename T >
+    void  parallel_cayley_product( std::size_t rank, T *product, T const
+     *multiplicand, T const *multiplier, cayley_thread_pool &pool )
+    {
+        std::size_t const  tiles = std::size_t( 1u ) << ( rank -
+         cayley_tile_rank );
+        std::size_t const  tasks = std::min( tiles, 4u * pool.size() );
+        std::size_t const  tile_size = std::size_t( 1u ) << cayley_tile_rank;
+
+        pool.parallel_for( tasks, [=]( std::size_t t ){
+            blocked_cayley_product( rank, false, false, false, product,
+             multiplicand, multiplier, product + tiles * t / tasks * tile_size,
+             product + tiles * (t + 1u) / tasks * tile_size );
+        } );
+    }
+
+    // Small ranks don't split into tiles; use the regular kernel
+    template < typename T, std::size_t R >
+    inline
+    auto  blocked_product( complex_it<T, R> const &multiplicand,
+     complex_it<T, R> const &multiplier, cayley_thread_pool &, std::false_type )
+     -> complex_it<T, R>
+    { return multiplicand * multiplier; }
+
+    // Large ranks get the tiled, parallel product
+    template < typename T, std::size_t R >
+    auto  blocked_product( complex_it<T, R> const &multiplicand,
+     complex_it<T, R> const &multiplier, cayley_thread_pool &pool,
+     std::true_type ) -> complex_it<T, R>
+    {
+        complex_it<T, R>  product{};
+
+        parallel_cayley_product( R, &product[0], &multiplicand[0],
+         &multiplier[0], pool );
+        return product;
+    }
+
+}  // namespace detail
+//! \endcond
+
+
+//  Blocked multiplication functions  ----------------------------------------//
+
+/** \brief  Multiplication, Cayley, cache-blocked and multithreaded
+
+Gives the same result as `multiplicand * multiplier`, but for ranks past 4,
+the barrage-wise split stops at rank-4 tiles (each a fixed, inlined kernel),
+and the output tiles are shared out among the threads of `pool`.  Each thread
+owns its output tiles, so they need no locking and stay in cache while the
+input tiles stream past.  All `4 ^ R` component products are still done, so
+this pays off when that work dwarfs the thread hand-off, from about rank 10.
+
+    \relatesalso  #boost::math::complex_it
+
+    \param[in] multiplicand  The first factor.
+    \param[in] multiplier    The second factor.
+    \param[in] pool          The threads to use.
+
+    \returns  The product of `multiplicand` and `multiplier`.
+ */
+template < typename T, std::size_t R >
+auto  blocked_product( complex_it<T, R> const &multiplicand, complex_it<T, R>
+ const &multiplier, cayley_thread_pool &pool = default_cayley_thread_pool() )
+ -> complex_it<T, R>
+{
+    return detail::blocked_product( multiplicand, multiplier, pool,
+     std::integral_constant<bool, (R > detail::cayley_tile_rank)>{} );
+}
+
+/** \brief  Multiplication, Cayley, cache-blocked and multithreaded
+
+The runtime-rank version of the `complex_it` overload.  A lower-ranked factor
+is padded with zeros first, as the `complex_dyn` operators do.
+
+    \relatesalso  #boost::math::complex_dyn
+
+    \param[in] multiplicand  The first factor.
+    \param[in] multiplier    The second factor.
+    \param[in] pool          The threads to use.
+
+    \returns  The product of `multiplicand` and `multiplier`, with the
+              allocator of `multiplicand`.
+ */
+template < typename T, class A >
+auto  blocked_product( complex_dyn<T, A> const &multiplicand, complex_dyn<T, A>
+ const &multiplier, cayley_thread_pool &pool = default_cayley_thread_pool() )
+ -> complex_dyn<T, A>
+{
+    std::size_t const  rank = std::max( multiplicand.rank(), multiplier.rank()
+     );
+
+    if ( rank <= detail::cayley_tile_rank )
+        return multiplicand * multiplier;
+
+    complex_dyn<T, A>  product( rank, multiplicand.get_allocator() );
+
+    if ( multiplicand.rank() != multiplier.rank() )
+    {
+        complex_dyn<T, A>  padded( rank, multiplicand.get_allocator() );
+        auto const &       low = ( multiplicand.rank() < rank ) ? multiplicand
+         : multiplier;
+
+        std::copy( low.begin(), low.end(), padded.begin() );
+        detail::parallel_cayley_product( rank, product.begin(), (&low ==
+         &multiplicand ? padded : multiplicand).begin(), (&low == &multiplier ?
+         padded : multiplier).begin(), pool );
+    }
+    else
+        detail::parallel_cayley_product( rank, product.begin(),
+         multiplicand.begin(), multiplier.begin(), pool );
+    return product;
+}
+
+
+}  // namespace math
+}  // namespace boost
+
+
+#endif // BOOST_MATH_COMPLEX_PARALLEL_HPP
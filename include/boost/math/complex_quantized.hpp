@@ -0,0 +1,283 @@
+//  Boost Complex Numbers, quantized rotations header file  ------------------//
+
+//  Copyright 2013 Daryle Walker.
+//  Distributed under the Boost Software License, Version 1.0.  (See the
+//  accompanying file LICENSE_1_0.txt or a copy at
+//  <http://www.boost.org/LICENSE_1_0.txt>.)
+
+//  See <http://www.boost.org/libs/math/> for the library's home page.
+
+/** \file   boost/math/complex_quantized.hpp
+    \brief  Compact encodings of unit quaternions.
+
+    \author  Daryle Walker
+
+    \version  0.1
+
+    \copyright  Boost Software License, version 1.0
+
+    Contains the declaration (and definition) of class template
+    `compact_quaternion`, which stores a unit `complex_it<float, 2>` (i.e. a
+    rotation) in 32, 48, or 64 bits with the "smallest three" scheme, plus batch
+    functions to encode and decode arrays of them.
+
+    \warning  This library requires C++2011 features.
+ */
+
+#ifndef BOOST_MATH_COMPLEX_QUANTIZED_HPP
+#define BOOST_MATH_COMPLEX_QUANTIZED_HPP
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#include "boost/math/complex.hpp"
+#include "boost/math/complex_it.hpp"
+
+
+namespace boost
+{
+namespace math
+{
+
+
+//  Compact quaternion class template definition  ----------------------------//
+
+/** \brief  A unit quaternion quantized to a fixed bit budget
+
+Since `q` and `-q` give the same rotation, and the components of a unit
+quaternion determine each other through `norm(q) == 1`, a rotation needs only
+three components plus the position of the fourth.  The encoding:
+
+1. Finds the component with the largest magnitude, negating the whole value if
+   that component is negative, so it can be recovered as a positive square
+   root.
+2. Stores its index in 2 bits.
+3. Stores the other three components, each within `[-1/sqrt(2), +1/sqrt(2)]`,
+   as unsigned fixed-point numbers of #component_bits bits.  The range is cut
+   into an even number of steps, so zero is exact.
+
+Decoding reverses that, recomputing the dropped component as `sqrt(1 - (a^2 +
+b^2 + c^2))`.  The bits, index highest, are kept in 16-bit words,
+least-significant word first, so the stored form does not depend on the host's
+byte order.
+
+| `Bits` | Bytes | #component_bits | #max_angle_error (radians) |
+| -----: | ----: | --------------: | -------------------------: |
+|     32 |     4 |              10 |                 4.8 x 10^-3 |
+|     48 |     6 |              15 |                 1.5 x 10^-4 |
+|     64 |     8 |              20 |                 4.7 x 10^-6 |
+
+    \pre  Encoded values are unit quaternions, up to `float` rounding.
+
+    \tparam Bits  The size of the encoding: 32, 48, or 64.
+ */
+template < std::size_t Bits = 32u >
+struct compact_quaternion
+{
+    static_assert( Bits == 32u || Bits == 48u || Bits == 64u, "Unsupported bit "
+     "budget" );
+
+    // Core types
+    //! The type of the values encoded.
+    typedef complex_it<float, 2u>  quaternion_type;
+    //! The type of each storage word.
+    typedef std::uint16_t          word_type;
+
+    // Sizing parameters
+    //! The size of the encoding, in bits.
+    static constexpr  std::size_t  bits = Bits;
+    //! The number of 16-bit storage words.
+    static constexpr  std::size_t  word_count = Bits / 16u;
+    //! The bits for each stored component.
+    static constexpr  std::size_t  component_bits = ( Bits - 2u ) / 3u;
+    /** \brief  The largest rotation angle between a value and its decoding
+
+    Each stored component is off by at most half a quantization step, `d =
+    sqrt(2) / (2^component_bits - 2)`, so those three are off by at most
+    `sqrt(3) d / 2` together.  The dropped component is at least 1/2, which
+    limits its recomputed error to `sqrt(3)` times that, and the two unit
+    quaternions are at most `sqrt(3) d` apart.  Twice the angle between them,
+    to first order `2 sqrt(6) / (2^component_bits - 2)`, is the rotation error.
+     */
+    static constexpr  double  max_angle_error = 4.898979485566356 / double(
+     (1ULL << component_bits) - 2u );
+
+    // Constructors
+    //! Create an uninitialized encoding.
+    compact_quaternion() = default;
+    /** \brief  Encode a rotation
+        \param[in] q  The unit quaternion to encode.
+        \post  `quaternion_type(*this)` is `q` or `-q` to within
+               #max_angle_error.
+     */
+    explicit  compact_quaternion( quaternion_type const &q ) noexcept
+    {
+        float const          range = 0.70710678118654752f;  // 1 / sqrt(2)
+        float const          scale = float( (1ULL << component_bits) - 2u ) /
+         ( 2.0f * range );
+        std::uint64_t const  top = ( 1ULL << component_bits ) - 2u;
+        std::size_t          largest = 0u;
+
+        for ( std::size_t k = 1u ; k < 4u ; ++k )
+            if ( std::fabs(q[ k ]) > std::fabs(q[ largest ]) )
+                largest = k;
+
+        float const    sign = ( q[largest] < 0.0f ) ? -1.0f : +1.0f;
+        std::uint64_t  code = largest;
+
+        for ( std::size_t k = 0u ; k < 4u ; ++k )
+            if ( k != largest )
+            {
+                float const    x = ( sign * q[k] + range ) * scale + 0.5f;
+                std::uint64_t  v = ( x > 0.0f ) ? std::uint64_t( x ) : 0u;
+
+                code = ( code << component_bits ) | ( v < top ? v : top );
+            }
+        for ( std::size_t i = 0u ; i < word_count ; ++i, code >>= 16 )
+            words[ i ] = word_type( code & 0xFFFFu );
+    }
+
+    // Conversion
+    /** \brief  Decode the rotation
+        \returns  The unit quaternion, with a non-negative largest component.
+     */
+    explicit  operator quaternion_type() const noexcept
+    {
+        float const    range = 0.70710678118654752f;
+        float const    step = 2.0f * range / float( (1ULL << component_bits) -
+         2u );
+        std::uint64_t  code = 0u;
+
+        for ( std::size_t i = word_count ; i-- ; )
+            code = ( code << 16 ) | words[ i ];
+
+        std::size_t const  largest = code >> ( 3u * component_bits ) & 3u;
+        float              t[ 3 ];
+        float              sum = 0.0f;
+
+        for ( std::size_t j = 3u ; j-- ; code >>= component_bits )
+        {
+            t[ j ] = float( code & ((1ULL << component_bits) - 1u) ) * step -
+             range;
+            sum += t[ j ] * t[ j ];
+        }
+
+        quaternion_type  result;
+        float const      w = std::sqrt( (sum < 1.0f) ? 1.0f - sum : 0.0f );
+
+        for ( std::size_t k = 0u ; k < 4u ; ++k )
+            result[ k ] = ( k == largest ) ? w : t[ k - (k > largest) ];
+        return result;
+    }
+
+    // Member data
+    //! The encoded bits, least-significant word first.
+    word_type  words[ word_count ];
+};
+
+/** Gives access to a template parameter.
+ */
+template < std::size_t Bits >
+constexpr
+std::size_t  compact_quaternion<Bits>::bits;
+
+/** One word per 16 bits.
+ */
+template < std::size_t Bits >
+constexpr
+std::size_t  compact_quaternion<Bits>::word_count;
+
+/** Whatever is left after the 2-bit index, split three ways.
+ */
+template < std::size_t Bits >
+constexpr
+std::size_t  compact_quaternion<Bits>::component_bits;
+
+//! \copydoc  #boost::math::compact_quaternion::max_angle_error
+template < std::size_t Bits >
+constexpr
+double  compact_quaternion<Bits>::max_angle_error;
+
+
+//  Batch encoding functions  ------------------------------------------------//
+
+//! \cond
+namespace detail
+{
+    // Loop bodies for the vector-extension dispatcher
+    template < std::size_t Bits >
+    struct compact_encode_body
+    {
+        complex_it<float, 2u> const *  in;
+        compact_quaternion<Bits> *     out;
+
+        void  operator ()( std::size_t i ) const
+        { out[ i ] = compact_quaternion<Bits>( in[i] ); }
+    };
+
+    template < std::size_t Bits >
+    struct compact_decode_body
+    {
+        compact_quaternion<Bits> const *  in;
+        complex_it<float, 2u> *           out;
+
+        void  operator ()( std::size_t i ) const
+        { out[ i ] = static_cast<complex_it<float, 2u>>( in[i] ); }
+    };
+
+}  // namespace detail
+//! \endcond
+
+/** \brief  Encode an array segment of rotations
+
+    \pre  [`first`, `last`) is a valid range of unit quaternions, and the
+          segment starting at `result` has room for as many encodings.
+
+    \tparam Bits  The size of each encoding: 32, 48, or 64.
+
+    \param[in]  first   The start of the rotations.
+    \param[in]  last    The end of the rotations.
+    \param[out] result  The start of the encodings.
+
+    \returns  The end of the output range.
+ */
+template < std::size_t Bits >
+inline
+auto  encode_rotations( complex_it<float, 2u> const *first, complex_it<float,
+ 2u> const *last, compact_quaternion<Bits> *result )
+ -> compact_quaternion<Bits> *
+{
+    detail::batch_dispatch( detail::compact_encode_body<Bits>{first, result},
+     last - first );
+    return result + ( last - first );
+}
+
+/** \brief  Decode an array segment of rotations
+
+    \pre  [`first`, `last`) is a valid range, and the segment starting at
+          `result` has room for as many quaternions.
+
+    \param[in]  first   The start of the encodings.
+    \param[in]  last    The end of the encodings.
+    \param[out] result  The start of the rotations.
+
+    \returns  The end of the output range.
+ */
+template < std::size_t Bits >
+inline
+auto  decode_rotations( compact_quaternion<Bits> const *first,
+ compact_quaternion<Bits> const *last, complex_it<float, 2u> *result )
+ -> complex_it<float, 2u> *
+{
+    detail::batch_dispatch( detail::compact_decode_body<Bits>{first, result},
+     last - first );
+    return result + ( last - first );
+}
+
+
+}  // namespace math
+}  // namespace boost
+
+
+#endif // BOOST_MATH_COMPLEX_QUANTIZED_HPP
@@ -32,7 +32,9 @@
 #include <cmath>
 #include <cstddef>
 #include <cstdlib>
+#include <iterator>
 #include <limits>
+#include <memory>
 #include <ostream>
 #include <sstream>
 #include <tuple>
@@ -119,6 +121,22 @@ struct complex_rt< Number, 0u >
     //! \overload
     auto  upper_barrage() noexcept -> barrage_type &  { return *this; }
 
+    /** \brief  The lower decomposed half of this object, by reference
+
+    Matches #boost::math::complex_it::lower_view, so divide-and-conquer code
+    can descend either kind of hypercomplex number without copying.  The
+    barrages here are already sub-objects, so this is #lower_barrage.
+     */
+    constexpr
+    auto  lower_view() const noexcept -> barrage_type const &  { return *this; }
+    //! \overload
+    auto  lower_view() noexcept -> barrage_type &  { return *this; }
+    //! The upper decomposed half of this object, by reference.
+    constexpr
+    auto  upper_view() const noexcept -> barrage_type const &  { return *this; }
+    //! \overload
+    auto  upper_view() noexcept -> barrage_type &  { return *this; }
+
     //! \copydoc  #boost::math::complex_it::unreal()const
     constexpr  auto  unreal() const -> complex_rt  { return {}; }
     //! \copydoc  #boost::math::complex_it::unreal(complex_it const&)
@@ -331,6 +349,22 @@ struct complex_rt
     //! \overload
     auto  upper_barrage() noexcept -> barrage_type &  { return b[1]; }
 
+    /** \brief  The lower decomposed half of this object, by reference
+
+    Matches #boost::math::complex_it::lower_view, so divide-and-conquer code
+    can descend either kind of hypercomplex number without copying.  The
+    barrages here are already sub-objects, so this is #lower_barrage.
+     */
+    constexpr
+    auto  lower_view() const noexcept -> barrage_type const &  { return b[0]; }
+    //! \overload
+    auto  lower_view() noexcept -> barrage_type &  { return b[0]; }
+    //! The upper decomposed half of this object, by reference.
+    constexpr
+    auto  upper_view() const noexcept -> barrage_type const &  { return b[1]; }
+    //! \overload
+    auto  upper_view() noexcept -> barrage_type &  { return b[1]; }
+
     //! \copydoc  #boost::math::complex_it::unreal()const
     constexpr
     auto  unreal() const -> complex_rt
@@ -694,6 +728,246 @@ void  swap( complex_rt<T, R> &a, complex_rt<T, R> &b )
 }
 
 
+//  Component iteration functions  -------------------------------------------//
+
+//! \cond
+namespace detail
+{
+    // Whether the components of a complex_rt lie back to back in index order,
+    // so a plain pointer can walk them.  (The lower barrage always comes first,
+    // so only padding or a non-standard layout can get in the way.)
+    template < typename T, std::size_t R >
+    struct is_flat_rt
+        : std::integral_constant< bool, std::is_standard_layout<complex_rt<T,
+           R>>::value && !complex_rt<T, R>::has_padding >
+    { };
+
+    // Byte offset of each component from the start of its object, found once
+    // per type by walking the barrages of the first object iterated.
+    template < typename T, std::size_t R >
+    auto  rt_component_offsets( complex_rt<T, R> const &x ) noexcept
+     -> std::ptrdiff_t const *
+    {
+        struct table
+        {
+            explicit  table( complex_rt<T, R> const &xx ) noexcept
+            {
+                auto const  base = reinterpret_cast<char const *>(
+                 std::addressof(xx) );
+
+                for ( std::size_t k = 0u ; k < complex_rt<T, R>::static_size ;
+                 ++k )
+                    o[ k ] = reinterpret_cast<char const *>( std::addressof(xx[
+                     k ]) ) - base;
+            }
+
+            std::ptrdiff_t  o[ complex_rt<T, R>::static_size ];
+        };
+
+        static table const  offsets{ x };
+
+        return offsets.o;
+    }
+
+    // Component iterator for padded types, using the offset table instead of
+    // descending the barrages
+    template < typename T, std::size_t R, bool IsConst >
+    class rt_component_iterator
+    {
+        typedef typename std::conditional<IsConst, char const, char>::type
+          byte_type;
+
+    public:
+        typedef std::random_access_iterator_tag   iterator_category;
+        typedef T                                 value_type;
+        typedef std::ptrdiff_t                    difference_type;
+        typedef typename std::conditional<IsConst, T const, T>::type *  pointer;
+        typedef typename std::conditional<IsConst, T const, T>::type &
+          reference;
+
+        rt_component_iterator() noexcept = default;
+        rt_component_iterator( byte_type *base, std::ptrdiff_t const *offsets,
+         std::size_t index ) noexcept
+            : o{ base }, t{ offsets }, i{ index }
+        {}
+        template < bool C, typename = typename std::enable_if<IsConst &&
+         !C>::type >
+        rt_component_iterator( rt_component_iterator<T, R, C> const &x )
+         noexcept
+            : o{ x.base() }, t{ x.offsets() }, i{ x.index() }
+        {}
+
+        auto  base() const noexcept -> byte_type *  { return o; }
+        auto  offsets() const noexcept -> std::ptrdiff_t const *  { return t; }
+        auto  index() const noexcept -> std::size_t  { return i; }
+
+        auto  operator *() const noexcept -> reference
+        { return *operator ->(); }
+        auto  operator ->() const noexcept -> pointer
+        { return reinterpret_cast<pointer>( o + t[i] ); }
+        auto  operator []( difference_type n ) const noexcept -> reference
+        { return *( *this + n ); }
+
+        auto  operator ++() noexcept -> rt_component_iterator &
+        { ++i; return *this; }
+        auto  operator --() noexcept -> rt_component_iterator &
+        { --i; return *this; }
+        auto  operator ++( int ) noexcept -> rt_component_iterator
+        { auto const  old = *this; ++i; return old; }
+        auto  operator --( int ) noexcept -> rt_component_iterator
+        { auto const  old = *this; --i; return old; }
+        auto  operator +=( difference_type n ) noexcept
+         -> rt_component_iterator &
+        { i += n; return *this; }
+        auto  operator -=( difference_type n ) noexcept
+         -> rt_component_iterator &
+        { i -= n; return *this; }
+
+        friend
+        auto  operator +( rt_component_iterator x, difference_type n ) noexcept
+         -> rt_component_iterator
+        { return x += n; }
+        friend
+        auto  operator +( difference_type n, rt_component_iterator x ) noexcept
+         -> rt_component_iterator
+        { return x += n; }
+        friend
+        auto  operator -( rt_component_iterator x, difference_type n ) noexcept
+         -> rt_component_iterator
+        { return x -= n; }
+        friend
+        auto  operator -( rt_component_iterator const &x, rt_component_iterator
+         const &y ) noexcept -> difference_type
+        { return difference_type( x.i ) - difference_type( y.i ); }
+
+        friend
+        auto  operator ==( rt_component_iterator const &x, rt_component_iterator
+         const &y ) noexcept -> bool
+        { return x.o == y.o && x.i == y.i; }
+        friend
+        auto  operator !=( rt_component_iterator const &x, rt_component_iterator
+         const &y ) noexcept -> bool
+        { return !( x == y ); }
+        friend
+        auto  operator <( rt_component_iterator const &x, rt_component_iterator
+         const &y ) noexcept -> bool
+        { return x.i < y.i; }
+        friend
+        auto  operator >( rt_component_iterator const &x, rt_component_iterator
+         const &y ) noexcept -> bool
+        { return y < x; }
+        friend
+        auto  operator <=( rt_component_iterator const &x, rt_component_iterator
+         const &y ) noexcept -> bool
+        { return !( y < x ); }
+        friend
+        auto  operator >=( rt_component_iterator const &x, rt_component_iterator
+         const &y ) noexcept -> bool
+        { return !( x < y ); }
+
+    private:
+        byte_type *             o = nullptr;
+        std::ptrdiff_t const *  t = nullptr;
+        std::size_t             i = 0u;
+    };
+
+    // Picks the iterator type, and makes the begin-iterator, for a complex_rt
+    template < typename T, std::size_t R, bool IsConst, bool Flat =
+     is_flat_rt<T, R>::value >
+    struct rt_iterator
+    {
+        typedef rt_component_iterator<T, R, IsConst>  type;
+        typedef typename std::conditional<IsConst, complex_rt<T, R> const,
+         complex_rt<T, R>>::type                      object_type;
+        typedef typename std::conditional<IsConst, char const, char>::type
+          byte_type;
+
+        static  auto  first( object_type &x ) noexcept -> type
+        {
+            return { reinterpret_cast<byte_type *>(std::addressof( x )),
+             rt_component_offsets(x), 0u };
+        }
+    };
+
+    template < typename T, std::size_t R, bool IsConst >
+    struct rt_iterator< T, R, IsConst, true >
+    {
+        typedef typename std::conditional<IsConst, T const, T>::type *  type;
+        typedef typename std::conditional<IsConst, complex_rt<T, R> const,
+         complex_rt<T, R>>::type                                   object_type;
+
+        static  auto  first( object_type &x ) noexcept -> type
+        { return std::addressof( x[0] ); }
+    };
+
+}  // namespace detail
+//! \endcond
+
+/** \brief  Forward iteration over components, start point
+
+Generates a starting point for iterating over the given object's component data
+in a forward direction.  Unlike the index operator, which descends one barrage
+level per step, each iterator step is constant time.  When the components are
+stored back to back (no padding and a standard layout), the iterator is a plain
+pointer; otherwise it applies a per-type table of component offsets.
+
+    \relatesalso  #boost::math::complex_rt
+
+    \see  #boost::math::end(boost::math::complex_rt<T,R>const&)
+
+    \param c  The object to have its begin-iterator accessed.
+
+    \throws  Nothing.
+
+    \returns  A random-access iterator pointing to the first element (i.e. the
+              real component).
+ */
+template < typename T, std::size_t R >
+inline
+auto  begin( complex_rt<T, R> const &c ) noexcept
+ -> typename detail::rt_iterator<T, R, true>::type
+{ return detail::rt_iterator<T, R, true>::first( c ); }
+
+/** \overload
+    \relatesalso  #boost::math::complex_rt
+ */
+template < typename T, std::size_t R >
+inline
+auto  begin( complex_rt<T, R> &c ) noexcept
+ -> typename detail::rt_iterator<T, R, false>::type
+{ return detail::rt_iterator<T, R, false>::first( c ); }
+
+/** \brief  Forward iteration over components, end point
+
+Generates an end point for iterating over the given object's component data in
+a forward direction.
+
+    \relatesalso  #boost::math::complex_rt
+
+    \see  #boost::math::begin(boost::math::complex_rt<T,R>const&)
+
+    \param c  The object to have its end-iterator accessed.
+
+    \throws  Nothing.
+
+    \returns  An iterator pointing to past the last element.
+ */
+template < typename T, std::size_t R >
+inline
+auto  end( complex_rt<T, R> const &c ) noexcept
+ -> typename detail::rt_iterator<T, R, true>::type
+{ return begin(c) + complex_rt<T, R>::static_size; }
+
+/** \overload
+    \relatesalso  #boost::math::complex_rt
+ */
+template < typename T, std::size_t R >
+inline
+auto  end( complex_rt<T, R> &c ) noexcept
+ -> typename detail::rt_iterator<T, R, false>::type
+{ return begin(c) + complex_rt<T, R>::static_size; }
+
+
 //  Tuple interface functions  -----------------------------------------------//
 
 /** \brief  Accesses a component of a `complex_rt`.
@@ -890,11 +1164,33 @@ std::basic_ostream<Ch, Tr> &
 operator <<( std::basic_ostream<Ch, Tr> &o, complex_rt<T, R> const &x )
 {
     std::basic_ostringstream<Ch, Tr>  s;
+    auto                              b = begin( x );
+    auto const                        e = end( x );
 
+    // Between components k - 1 and k, as many barrages close and open as k has
+    // trailing zero bits.
     s.flags( o.flags() );
     s.imbue( o.getloc() );
     s.precision( o.precision() );
-    return o << '(' << x.lower_barrage() << ',' << x.upper_barrage() << ')';
+    for ( std::size_t k = 0u ; k < R ; ++k )
+        s << '(';
+    s << *b++;
+    for ( std::size_t i = 1u ; e != b ; ++i )
+    {
+        std::size_t  depth = 0u;
+
+        while ( not (i >> depth & 1u) )
+            ++depth;
+        for ( std::size_t k = 0u ; k < depth ; ++k )
+            s << ')';
+        s << ',';
+        for ( std::size_t k = 0u ; k < depth ; ++k )
+            s << '(';
+        s << *b++;
+    }
+    for ( std::size_t k = 0u ; k < R ; ++k )
+        s << ')';
+    return o << s.str();
 }
 
 
@@ -1611,7 +1907,10 @@ template < typename T, typename U, std::size_t R >
 inline constexpr
 auto  operator *( complex_rt<T, R> const &multiplicand, complex_rt<U, R> const
  &multiplier )
- -> complex_rt<decltype( std::declval<T>() * std::declval<U>() ), R>
+ -> typename std::enable_if< (R > 2u) || not
+ use_reduced_multiplication<decltype( std::declval<T>() * std::declval<U>()
+ )>::value, complex_rt<decltype( std::declval<T>() * std::declval<U>() ), R>
+ >::type
 {
     return { multiplicand.lower_barrage() * multiplier.lower_barrage() -
      ~multiplier.upper_barrage() * multiplicand.upper_barrage(),
@@ -1619,6 +1918,38 @@ auto  operator *( complex_rt<T, R> const &multiplicand, complex_rt<U, R> const
      multiplicand.upper_barrage() * ~multiplier.lower_barrage() };
 }
 
+/** \overload
+    \relates  #boost::math::complex_rt
+    \see  #boost::math::use_reduced_multiplication
+ */
+template < typename T, typename U, std::size_t R >
+auto  operator *( complex_rt<T, R> const &multiplicand, complex_rt<U, R> const
+ &multiplier )
+ -> typename std::enable_if< (R >= 1u) && (R <= 2u) &&
+ use_reduced_multiplication<decltype( std::declval<T>() * std::declval<U>()
+ )>::value, complex_rt<decltype( std::declval<T>() * std::declval<U>() ), R>
+ >::type
+{
+    typedef complex_rt<decltype( std::declval<T>() * std::declval<U>() ), R>
+      product_type;
+
+    T                                  md[ product_type::static_size ];
+    U                                  mr[ product_type::static_size ];
+    typename product_type::value_type  p[ product_type::static_size ]{};
+    product_type                       product;
+
+    for ( std::size_t i = 0u ; i < product_type::static_size ; ++i )
+    {
+        md[ i ] = multiplicand[ i ];
+        mr[ i ] = multiplier[ i ];
+    }
+    detail::reduced_cayley_product<R>::template add<false, false, false>( p, md,
+     mr );
+    for ( std::size_t i = 0u ; i < product_type::static_size ; ++i )
+        product[ i ] = p[ i ];
+    return product;
+}
+
 /** \overload
     \relates  #boost::math::complex_rt
  */
@@ -1737,8 +2068,326 @@ auto  operator *=( complex_rt<T, R> &multiplicand_product, complex_rt<U, S>
 }
 
 
+//  Fused multiply-add functions  --------------------------------------------//
+
+//! \cond
+namespace detail
+{
+    // Recursive counterpart of the flat-array Cayley product kernel; the flags
+    // mean the same here, and barrages are split by the same rules.
+    template < bool DoSubtract, bool ConjugateMd, bool ConjugateMr >
+    struct rt_cayley_product
+    {
+        // As +/-= Md * Mr, where only the lower part of As is touched
+        template < typename T, std::size_t Q, typename U, std::size_t R,
+         typename V, std::size_t S >
+        static  auto  add( complex_rt<T, Q> &augend_sum, complex_rt<U, R> const
+         &multiplicand, complex_rt<V, S> const &multiplier )
+         -> typename std::enable_if< (Q > R) && (Q > S) >::type
+        {
+            rt_cayley_product::add( augend_sum.lower_barrage(), multiplicand,
+             multiplier );
+        }
+
+        // As +/-= realMd * realMr
+        template < typename T, typename U, typename V >
+        static  void  add( complex_rt<T, 0u> &augend_sum, complex_rt<U, 0u>
+         const &multiplicand, complex_rt<V, 0u> const &multiplier )
+        {
+            component_product<DoSubtract>::add( augend_sum[0], multiplicand[0],
+             multiplier[0] );
+        }
+
+        // As +/-= { Md * lowerMr, upperMr * Md }
+        template < typename T, std::size_t R, typename U, typename V,
+         std::size_t S >
+        static  auto  add( complex_rt<T, S> &augend_sum, complex_rt<U, R> const
+         &multiplicand, complex_rt<V, S> const &multiplier )
+         -> typename std::enable_if< (R < S) >::type
+        {
+            rt_cayley_product::add( augend_sum.lower_barrage(), multiplicand,
+             multiplier.lower_barrage() );
+            rt_cayley_product<DoSubtract != ConjugateMr, false,
+             ConjugateMd>::add( augend_sum.upper_barrage(),
+             multiplier.upper_barrage(), multiplicand );
+        }
+
+        // As +/-= { lowerMd * Mr, upperMd * conj(Mr) }
+        template < typename T, std::size_t R, typename U, typename V,
+         std::size_t S >
+        static  auto  add( complex_rt<T, R> &augend_sum, complex_rt<U, R> const
+         &multiplicand, complex_rt<V, S> const &multiplier )
+         -> typename std::enable_if< (R > S) >::type
+        {
+            rt_cayley_product::add( augend_sum.lower_barrage(),
+             multiplicand.lower_barrage(), multiplier );
+            rt_cayley_product<DoSubtract != ConjugateMd, false,
+             !ConjugateMr>::add( augend_sum.upper_barrage(),
+             multiplicand.upper_barrage(), multiplier );
+        }
+
+        // As +/-= { lowerMd * lowerMr - conj(upperMr) * upperMd, upperMr *
+        //  lowerMd + upperMd * conj(lowerMr) }
+        template < typename T, std::size_t R, typename U, typename V >
+        static  auto  add( complex_rt<T, R> &augend_sum, complex_rt<U, R> const
+         &multiplicand, complex_rt<V, R> const &multiplier )
+         -> typename std::enable_if< (R > 0u) >::type
+        {
+            rt_cayley_product::add( augend_sum.lower_barrage(),
+             multiplicand.lower_barrage(), multiplier.lower_barrage() );
+            rt_cayley_product<!DoSubtract != (ConjugateMr != ConjugateMd), true,
+             false>::add( augend_sum.lower_barrage(),
+             multiplier.upper_barrage(), multiplicand.upper_barrage() );
+            rt_cayley_product<DoSubtract != ConjugateMr, false,
+             ConjugateMd>::add( augend_sum.upper_barrage(),
+             multiplier.upper_barrage(), multiplicand.lower_barrage() );
+            rt_cayley_product<DoSubtract != ConjugateMd, false,
+             !ConjugateMr>::add( augend_sum.upper_barrage(),
+             multiplicand.upper_barrage(), multiplier.lower_barrage() );
+        }
+    };
+
+
+    // Whether two objects share any storage, including when either is a barrage
+    // of the other
+    template < typename T, std::size_t Q, typename U, std::size_t R >
+    inline
+    auto  rt_sharing( complex_rt<T, Q> const &a, complex_rt<U, R> const &b )
+     -> bool
+    {
+        return overlapping( reinterpret_cast<unsigned char const *>(&a),
+         sizeof(a), reinterpret_cast<unsigned char const *>(&b), sizeof(b) );
+    }
+
+}  // namespace detail
+//! \endcond
+
+/** \brief  Multiply-and-accumulate, recursive
+
+Adds the product of the given factors to the accumulator, without forming the
+product as a temporary.  Either factor can be conjugated on the fly.
+
+    \relatesalso  #boost::math::complex_rt
+
+    \pre  `declval<T &>() += declval<U>() * declval<V>()` is well-formed.
+    \pre  The rank of the accumulator is at least as large as that of either
+          factor.
+
+    \tparam ConjugateMd  Whether `conj( multiplicand )` is used instead.
+    \tparam ConjugateMr  Whether `conj( multiplier )` is used instead.
+
+    \param[in,out] accumulator   The object to be added to.  It may share
+                                 storage with either factor.
+    \param[in]     multiplicand  The first factor to be multiplied.
+    \param[in]     multiplier    The second factor to be multiplied.
+
+    \returns  A reference to the updated `accumulator`.
+ */
+template < bool ConjugateMd = false, bool ConjugateMr = false, typename T,
+ std::size_t Q, typename U, std::size_t R, typename V, std::size_t S >
+auto  fma_assign( complex_rt<T, Q> &accumulator, complex_rt<U, R> const
+ &multiplicand, complex_rt<V, S> const &multiplier )
+ -> typename std::enable_if< (Q >= R) && (Q >= S), complex_rt<T, Q> >::type &
+{
+    typedef detail::rt_cayley_product<false, ConjugateMd, ConjugateMr>  kernel;
+
+    if ( detail::rt_sharing(accumulator, multiplicand) || detail::rt_sharing(
+     accumulator, multiplier) )
+        kernel::add( accumulator, complex_rt<U, R>(multiplicand),
+         complex_rt<V, S>(multiplier) );
+    else
+        kernel::add( accumulator, multiplicand, multiplier );
+    return accumulator;
+}
+
+/** \brief  Multiply-and-deduct, recursive
+
+Subtracts the product of the given factors from the accumulator, without
+forming the product as a temporary.
+
+    \relatesalso  #boost::math::complex_rt
+
+    \see  #boost::math::fma_assign
+
+    \tparam ConjugateMd  Whether `conj( multiplicand )` is used instead.
+    \tparam ConjugateMr  Whether `conj( multiplier )` is used instead.
+
+    \param[in,out] accumulator   The object to be subtracted from.  It may
+                                 share storage with either factor.
+    \param[in]     multiplicand  The first factor to be multiplied.
+    \param[in]     multiplier    The second factor to be multiplied.
+
+    \returns  A reference to the updated `accumulator`.
+ */
+template < bool ConjugateMd = false, bool ConjugateMr = false, typename T,
+ std::size_t Q, typename U, std::size_t R, typename V, std::size_t S >
+auto  fms_assign( complex_rt<T, Q> &accumulator, complex_rt<U, R> const
+ &multiplicand, complex_rt<V, S> const &multiplier )
+ -> typename std::enable_if< (Q >= R) && (Q >= S), complex_rt<T, Q> >::type &
+{
+    typedef detail::rt_cayley_product<true, ConjugateMd, ConjugateMr>  kernel;
+
+    if ( detail::rt_sharing(accumulator, multiplicand) || detail::rt_sharing(
+     accumulator, multiplier) )
+        kernel::add( accumulator, complex_rt<U, R>(multiplicand),
+         complex_rt<V, S>(multiplier) );
+    else
+        kernel::add( accumulator, multiplicand, multiplier );
+    return accumulator;
+}
+
+/** \brief  Fused multiply-add, recursive
+
+Calculates the product of the first two values plus the third, with the
+product accumulated straight into the result.
+
+    \relatesalso  #boost::math::complex_rt
+
+    \param[in] multiplicand  The first factor to be multiplied.
+    \param[in] multiplier    The second factor to be multiplied.
+    \param[in] addend        The value to be added.
+
+    \returns  `multiplicand * multiplier + addend`.
+ */
+template < typename T, std::size_t R, typename U, std::size_t S, typename V,
+ std::size_t Q >
+auto  fma( complex_rt<T, R> const &multiplicand, complex_rt<U, S> const
+ &multiplier, complex_rt<V, Q> const &addend )
+ -> decltype( multiplicand * multiplier + addend )
+{
+    decltype( multiplicand * multiplier + addend )  result( addend );
+
+    return fma_assign( result, multiplicand, multiplier );
+}
+
+/** \brief  Fused multiply-subtract, recursive
+
+Calculates the product of the first two values minus the third, with the
+product accumulated straight into the result.
+
+    \relatesalso  #boost::math::complex_rt
+
+    \param[in] multiplicand  The first factor to be multiplied.
+    \param[in] multiplier    The second factor to be multiplied.
+    \param[in] subtrahend    The value to be subtracted.
+
+    \returns  `multiplicand * multiplier - subtrahend`.
+ */
+template < typename T, std::size_t R, typename U, std::size_t S, typename V,
+ std::size_t Q >
+auto  fms( complex_rt<T, R> const &multiplicand, complex_rt<U, S> const
+ &multiplier, complex_rt<V, Q> const &subtrahend )
+ -> decltype( multiplicand * multiplier - subtrahend )
+{
+    decltype( multiplicand * multiplier - subtrahend )  result{};
+
+    fma_assign( result, multiplicand, multiplier );
+    return result -= subtrahend;
+}
+
+
 //  Division operators  ------------------------------------------------------//
 
+//! \cond
+namespace detail
+{
+    // Divide a Cayley product by a norm: truncating division for integer types
+    template < typename P, std::size_t R, typename N >
+    auto  rt_scale_quotient( complex_rt<P, R> const &product, N const &norm,
+     std::true_type ) -> decltype( product / std::declval<P>() )
+    { return product / static_cast<P>( norm ); }
+
+    // Divide a Cayley product by a norm: reciprocal multiplication otherwise
+    template < typename P, std::size_t R, typename N >
+    auto  rt_scale_quotient( complex_rt<P, R> const &product, N const &norm,
+     std::false_type ) -> decltype( product * std::declval<P>() )
+    {
+        P  scale{};
+
+        ++scale;
+        scale /= norm;
+        return product * scale;
+    }
+
+    // Whether rt_scale_quotient can be trusted: always for integer types
+    template < typename P, std::size_t R, typename N >
+    constexpr
+    bool  rt_scale_in_range( complex_rt<P, R> const &, N const &,
+     std::true_type )
+    { return true; }
+
+    // Whether rt_scale_quotient can be trusted: not if the norm's reciprocal
+    // overflowed or underflowed (to zero or a subnormal), or a product
+    // component did
+    template < typename P, std::size_t R, typename N >
+    bool  rt_scale_in_range( complex_rt<P, R> const &product, N const &norm,
+     std::false_type )
+    {
+        typedef std::integral_constant<bool,
+         std::numeric_limits<P>::is_bounded>  bounded;
+
+        P  scale{};
+
+        ++scale;
+        scale /= norm;
+        if ( scale == P{} || !in_normal_range(scale, bounded{}) )
+            return false;
+        for ( auto const &p : product )
+            if ( !in_normal_range(p, bounded{}) )
+                return false;
+        return true;
+    }
+
+    // Dividend * Inv(Divisor), or Inv(Divisor) * Dividend when DivisorFirst,
+    // with the divisor scaled down by its largest component first (see
+    // detail::prescaled_quotient)
+    template < bool DivisorFirst, typename T, std::size_t R, typename U,
+     std::size_t S >
+    auto  rt_prescaled_quotient( complex_rt<T, R> const &dividend,
+     complex_rt<U, S> const &divisor )
+     -> complex_rt<decltype( std::declval<T>() / std::declval<U>() ), ( R < S )
+     ? S : R>
+    {
+        U const     largest = largest_magnitude( divisor );
+        auto const  unit = divisor / largest;
+        auto const  reciprocal = conj( unit ) / norm( unit );
+        auto const  product = DivisorFirst ? reciprocal * dividend : dividend *
+         reciprocal;
+
+        return product / static_cast<typename std::remove_cv<decltype( product
+         )>::type::value_type>( largest );
+    }
+
+    // Dividend * Conj(Divisor) / Norm(Divisor), or Conj(Divisor) * Dividend /
+    // Norm(Divisor) when DivisorFirst, with the conjugation as a kernel flag
+    template < bool DivisorFirst, typename T, std::size_t R, typename U,
+     std::size_t S >
+    auto  rt_cayley_quotient( complex_rt<T, R> const &dividend, complex_rt<U, S>
+     const &divisor )
+     -> complex_rt<decltype( std::declval<T>() / std::declval<U>() ), ( R < S )
+     ? S : R>
+    {
+        complex_rt<decltype( std::declval<T>() * std::declval<U>() ), ( R < S )
+         ? S : R>  product{};
+
+        if ( DivisorFirst )
+            rt_cayley_product<false, true, false>::add( product, divisor,
+             dividend );
+        else
+            rt_cayley_product<false, false, true>::add( product, dividend,
+             divisor );
+        auto const  cayley_norm = norm( divisor );
+        std::integral_constant<bool, std::numeric_limits<U>::is_integer> const
+          is_integer{};
+
+        if ( !rt_scale_in_range(product, cayley_norm, is_integer) )
+            return rt_prescaled_quotient<DivisorFirst>( dividend, divisor );
+        return rt_scale_quotient( product, cayley_norm, is_integer );
+    }
+
+}  // namespace detail
+//! \endcond
+
 /** \brief  Division, scalar
 
 Calculates the quotient of the given values.  The divisor is a real scalar;
@@ -1789,20 +2438,26 @@ Calculates the quotient of the given values, where both operands are
 hypercomplex.  Division works via multiplication of a reciprocal (which makes it
 an exact-quotient type of division).  The dividend is the left-factor (a.k.a.
 the multiplicand) in this altered multiplication, and the reciprocal of the
-divisor is the right factor (a.k.a. the multiplier).
+divisor is the right factor (a.k.a. the multiplier).  So this is right division;
+#boost::math::left_divide is the counterpart.
 
 The problem with just computing the divisor's reciprocal is integer types.  The
 reciprocal of a hypercomplex number is its conjugate divided by its (scalar)
 Cayley norm.  The norm is always larger than any of the components, so the
 reciprocal always reduces to zero in integer arithmetic.  To prevent this, the
-dividend should be multiplied by the divisor's conjugate before the scalar
-division by the divisor's norm, to ensure that the first product is large enough
-to give a useful answer after the division.  This method of applying the
-operations can work in general, but it risks overflow, so it's safer to not use
-it for types that don't need it.
+dividend is multiplied by the divisor's conjugate before the scalar division by
+the divisor's norm, to ensure that the first product is large enough to give a
+useful answer after the division.  This method of applying the operations can
+work in general, but it risks overflow.
 
-This function uses traits from `std::numeric_limits` to determine if a
-component type is integral before determining the order of operations.
+The conjugation is folded into the recursive Cayley product, then the product is
+divided by the norm (for integer types, truncating as before) or multiplied by
+the norm's reciprocal, computed once (for other types).  For bounded non-integer
+types, if that reciprocal or a product component overflows or becomes
+subnormal, the quotient is redone the safer way: the divisor is scaled down by
+its largest component, and the dividend is multiplied by the scaled reciprocal
+before the scale is divided back out.  This function uses traits from
+`std::numeric_limits` to determine if a component type is integral or bounded.
 
     \relates  #boost::math::complex_rt
 
@@ -1820,25 +2475,34 @@ template < typename T, std::size_t R, typename U, std::size_t S >
 inline
 auto  operator /( complex_rt<T, R> const &dividend, complex_rt<U, S> const
  &divisor )
- -> typename std::enable_if< std::numeric_limits<U>::is_integer,
- complex_rt<decltype( std::declval<T>() / std::declval<U>() ), ( R < S ) ? S :
- R> >::type  // for integers
-{
-    return (dividend * conj( divisor )) / static_cast<decltype(
-     std::declval<T>() * std::declval<U>() )>(norm( divisor ));
-}
+ -> complex_rt<decltype( std::declval<T>() / std::declval<U>() ), ( R < S ) ? S
+ : R>
+{ return detail::rt_cayley_quotient<false>( dividend, divisor ); }
 
-/** \overload
-    \relates  #boost::math::complex_rt
+/** \brief  Left division, Cayley
+
+Calculates the quotient of the given values with the reciprocal of the divisor
+as the *left* factor, i.e. `Inv(divisor) * dividend`.
+
+    \relatesalso  #boost::math::complex_rt
+
+    \see  #boost::math::operator/(complex_rt<T,R>const&,complex_rt<U,S>const&)
+
+    \pre  `declval<T>() / declval<U>()` is well-formed.
+    \pre  `divisor` is *not* zero.
+
+    \param[in] divisor   The value to divide by.
+    \param[in] dividend  The value to be divided.
+
+    \returns  `Conj(divisor) * dividend / Norm(divisor)`.
  */
 template < typename T, std::size_t R, typename U, std::size_t S >
 inline
-auto  operator /( complex_rt<T, R> const &dividend, complex_rt<U, S> const
- &divisor )
- -> typename std::enable_if< not std::numeric_limits<U>::is_integer,
- complex_rt<decltype( std::declval<T>() / std::declval<U>() ), ( R < S ) ? S :
- R> >::type
-{ return dividend * (conj( divisor ) / norm( divisor )); }  // for non-integers
+auto  left_divide( complex_rt<U, S> const &divisor, complex_rt<T, R> const
+ &dividend )
+ -> complex_rt<decltype( std::declval<T>() / std::declval<U>() ), ( R < S ) ? S
+ : R>
+{ return detail::rt_cayley_quotient<true>( dividend, divisor ); }
 
 /** \brief  Modulo, scalar
 
@@ -1970,26 +2634,10 @@ template < typename T, std::size_t R, typename U, std::size_t S >
 inline
 auto  operator /=( complex_rt<T, R> &dividend_quotient, complex_rt<U, S> const
  &divisor )
- -> typename std::enable_if< (R >= S) && std::numeric_limits<U>::is_integer,
- complex_rt<T, R> >::type &
-{
-    dividend_quotient *= conj( divisor );
-    dividend_quotient /= norm( divisor );
-    return dividend_quotient;
-}
-
-/** \overload
-    \relates  #boost::math::complex_rt
- */
-template < typename T, std::size_t R, typename U, std::size_t S >
-inline
-auto  operator /=( complex_rt<T, R> &dividend_quotient, complex_rt<U, S> const
- &divisor )
- -> typename std::enable_if< (R >= S) && not std::numeric_limits<U>::is_integer,
- complex_rt<T, R> >::type &
+ -> typename std::enable_if< (R >= S), complex_rt<T, R> >::type &
 {
-    dividend_quotient *= conj( divisor ) / norm( divisor );
-    return dividend_quotient;
+    return dividend_quotient = detail::rt_cayley_quotient<false>(
+     dividend_quotient, divisor );
 }
 
 /** \brief  Modulo-and-assign
@@ -2192,7 +2840,17 @@ T  sup( complex_rt<T, 0u> const &x )
 template < typename T, std::size_t R >
 inline
 T  sup( complex_rt<T, R> const &x )
-{ return std::max(sup( x.lower_barrage() ), sup( x.upper_barrage() )); }
+{
+    using std::abs;
+
+    auto        xb = begin( x );
+    T           result = abs( *xb++ );
+    auto const  xe = end( x );
+
+    while ( xe != xb )
+        result = std::max( result, abs(*xb++) );
+    return result;
+}
 
 /** \brief  Sign / Unit-vector
 
@@ -2214,6 +2872,129 @@ auto  sgn( complex_rt<T, R> const &x ) -> complex_rt<T, R>
 { return x ? x / abs(x) : x; }
 
 
+//  Power functions  ---------------------------------------------------------//
+
+/** \brief  Multiplicative inverse
+
+Returns the reciprocal of the given value, its conjugate divided by its Cayley
+norm.  The norm is computed once.  For non-integer component types, the norm's
+reciprocal is computed once and multiplied into each component.  (For integer
+component types, each component is divided by the norm, so only units have
+non-zero inverses.)
+If that reciprocal overflows or becomes subnormal, the value is scaled down by
+its largest component first, as Cayley division does.
+
+    \relatesalso  #boost::math::complex_rt
+
+    \pre  `x` is *not* zero.
+
+    \param[in] x  The input value.
+
+    \returns  `Inv(x) := Conj(x) / Norm(x)`, so `x * Inv(x) == Inv(x) * x == 1`.
+ */
+template < typename T, std::size_t R >
+inline
+auto  inverse( complex_rt<T, R> const &x )
+ -> complex_rt<decltype( std::declval<T>() / std::declval<T>() ), R>
+{
+    auto const  conjugate = conj( x );
+    auto const  cayley_norm = norm( x );
+    std::integral_constant<bool, std::numeric_limits<T>::is_integer> const
+      is_integer{};
+    T           one{};
+
+    ++one;
+    if ( !detail::rt_scale_in_range(conjugate, cayley_norm, is_integer) )
+        return detail::rt_prescaled_quotient<false>( complex_rt<T, 0u>{one}, x
+         );
+    return detail::rt_scale_quotient( conjugate, cayley_norm, is_integer );
+}
+
+/** \brief  Square
+
+Returns the given value multiplied by itself.  Every Cayley-Dickson number `x`
+satisfies `x^2 == 2 * Re(x) * x - Norm(x)`, so the square takes one scaling and
+one norm, i.e. work proportional to the number of components, instead of a full
+Cayley product.
+
+    \relatesalso  #boost::math::complex_rt
+
+    \param[in] x  The input value.
+
+    \returns  `x * x`.
+ */
+template < typename T, std::size_t R >
+auto  square( complex_rt<T, R> const &x ) -> complex_rt<T, R>
+{
+    auto  result = ( x[0] + x[0] ) * x;
+
+    result -= norm( x );
+    return result;
+}
+
+/** \brief  Integer power
+
+Returns the given value multiplied by itself the given number of times.  Every
+power of `x` lies in the span of `1` and `x`, and multiplying two such values
+only needs the scalars `2 * Re(x)` and `Norm(x)` (see
+#boost::math::square(complex_rt<T,R>const&)).  So this function does binary
+exponentiation on the two scalar coefficients and applies them to `x` at the
+end, for work proportional to the number of components plus `log2(n)` scalar
+steps.
+
+    \relatesalso  #boost::math::complex_rt
+
+    \pre  When `n` is negative, `x` is *not* zero and `decltype(x)` should
+          support the exact-quotient style of division.
+
+    \param[in] x  The base.
+    \param[in] n  The exponent.
+
+    \returns  `x^n`, where `x^0 == 1` and `x^(-n) == 1 / x^n`.
+ */
+template < typename T, std::size_t R, typename Integer >
+auto  pow( complex_rt<T, R> const &x, Integer n )
+ -> typename std::enable_if< std::is_integral<Integer>::value, complex_rt<T,
+ R> >::type
+{
+    // The magnitude is taken unsigned, since -n overflows for the minimum.
+    typedef typename std::make_unsigned<Integer>::type  magnitude_type;
+
+    T  one{};
+
+    ++one;
+    if ( n < Integer{} )
+        return inverse( pow(x, magnitude_type( -magnitude_type(n) )) );
+
+    // x^n == a + b * x, (c + d * x) holds the repeated squares of x.
+    T const  trace = x[ 0 ] + x[ 0 ], cayley_norm = norm( x );
+    T        a = one, b{}, c{}, d = one;
+
+    while ( n )
+    {
+        if ( n & 1 )
+        {
+            T const  bd = b * d, ac = a * c;
+
+            b = a * d + b * c + bd * trace;
+            a = ac - bd * cayley_norm;
+        }
+        if ( n >>= 1 )
+        {
+            T const  dd = d * d, cd = c * d;
+
+            c = c * c - dd * cayley_norm;
+            d = cd + cd + dd * trace;
+        }
+    }
+
+    auto  result = b * x;
+
+    result += a;
+    return result;
+}
+
+
 }  // namespace math
 }  // namespace boost
 
@@ -0,0 +1,800 @@
+//  Boost Complex Numbers, structure-of-arrays header file  ------------------//
+
+//  Copyright 2013 Daryle Walker.
+//  Distributed under the Boost Software License, Version 1.0.  (See the
+//  accompanying file LICENSE_1_0.txt or a copy at
+//  <http://www.boost.org/LICENSE_1_0.txt>.)
+
+//  See <http://www.boost.org/libs/math/> for the library's home page.
+
+/** \file   boost/math/complex_soa.hpp
+    \brief  Hypercomplex number sequences stored one component lane at a time.
+
+    \author  Daryle Walker
+
+    \version  0.1
+
+    \copyright  Boost Software License, version 1.0
+
+    Contains the declaration (and definition) of class template
+    `complex_soa_vector`, a sequence of hypercomplex numbers that keeps each
+    component in its own contiguous array (structure-of-arrays layout), plus
+    whole-sequence operators that run lane-wise, so each step is a vertical
+    operation over many numbers at once.  The transposition functions
+    `split_lanes` and `merge_lanes` convert between that layout and arrays of
+    `complex_it`.
+
+    \warning  This library requires C++2011 features.
+ */
+
+#ifndef BOOST_MATH_COMPLEX_SOA_HPP
+#define BOOST_MATH_COMPLEX_SOA_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "boost/math/complex.hpp"
+#include "boost/math/complex_it.hpp"
+#include "boost/math/complex_rt.hpp"
+
+
+namespace boost
+{
+namespace math
+{
+
+
+//  Lane transposition functions  --------------------------------------------//
+
+//! \cond
+namespace detail
+{
+    // Elements per transposition tile; a tile of every lane fits in a few
+    // vector registers, so the compiler turns the strided copies into shuffles.
+    constexpr std::size_t  transpose_tile_size = 8u;
+
+    // The interleaved side of a transposition, as element-component access:
+    // through the elements in general, ...
+    template < class X, bool Packed = is_packed<X>::value >
+    struct interleaved_access
+    {
+        X *  p;
+
+        auto  operator ()( std::size_t n, std::size_t k ) const
+         -> decltype( p[n][k] )
+        { return p[ n ][ k ]; }
+    };
+
+    // ... and as one flat scalar array with a constant stride when packed.
+    template < class X >
+    struct interleaved_access< X, true >
+    {
+        decltype( as_scalars(std::declval<X *>(), std::declval<X *>()).first )
+          p;
+
+        interleaved_access( X *x )  : p{ as_scalars(x, x).first }  {}
+
+        auto  operator ()( std::size_t n, std::size_t k ) const
+         -> decltype( p[n] )
+        { return p[ (n << X::rank) + k ]; }
+    };
+
+    // Loop body for interleaved-to-lanes transposition of whole tiles
+    template < typename T, std::size_t R >
+    struct split_lanes_body
+    {
+        interleaved_access<complex_it<T, R> const>  in;
+        T * const *                                 lanes;
+
+        void  operator ()( std::size_t b ) const
+        {
+            constexpr std::size_t  size = complex_it<T, R>::static_size;
+            std::size_t const      base = b * transpose_tile_size;
+
+            for ( std::size_t k = 0u ; k < size ; ++k )
+            {
+                T *  l = lanes[ k ] + base;
+
+                for ( std::size_t t = 0u ; t < transpose_tile_size ; ++t )
+                    l[ t ] = in( base + t, k );
+            }
+        }
+    };
+
+    // Loop body for lanes-to-interleaved transposition of whole tiles
+    template < typename T, std::size_t R >
+    struct merge_lanes_body
+    {
+        T const * const *                     lanes;
+        interleaved_access<complex_it<T, R>>  out;
+
+        void  operator ()( std::size_t b ) const
+        {
+            constexpr std::size_t  size = complex_it<T, R>::static_size;
+            std::size_t const      base = b * transpose_tile_size;
+
+            for ( std::size_t t = 0u ; t < transpose_tile_size ; ++t )
+                for ( std::size_t k = 0u ; k < size ; ++k )
+                    out( base + t, k ) = lanes[ k ][ base + t ];
+        }
+    };
+
+}  // namespace detail
+//! \endcond
+
+/** \brief  Transposition, interleaved to lanes
+
+Copies each component of an array segment of hypercomplex numbers into its own
+array, i.e. converts array-of-structures data to structure-of-arrays.  The work
+goes in fixed-size tiles, run with the best vector extension the processor
+supports (see #BOOST_MATH_COMPLEX_SIMD_DISPATCH), so that the copy is limited by
+memory bandwidth.
+
+    \pre  [`first`, `last`) is a valid range.
+    \pre  For each *k* \< `2^R`, `lanes[k]` points to an array at least as long
+          as the input, not overlapping it.
+
+    \param[in]  first  The start of the input numbers.
+    \param[in]  last   The end of the input numbers.
+    \param[out] lanes  The starts of the component arrays, one per component.
+
+    \returns  The number of elements copied.
+ */
+template < typename T, std::size_t R >
+auto  split_lanes( complex_it<T, R> const *first, complex_it<T, R> const *last,
+ T * const *lanes ) -> std::size_t
+{
+    constexpr std::size_t  size = complex_it<T, R>::static_size;
+    std::size_t const      n = last - first;
+    std::size_t const      tiles = n / detail::transpose_tile_size;
+
+    detail::batch_dispatch( detail::split_lanes_body<T, R>{{first}, lanes},
+     tiles );
+    for ( std::size_t i = tiles * detail::transpose_tile_size ; i < n ; ++i )
+        for ( std::size_t k = 0u ; k < size ; ++k )
+            lanes[ k ][ i ] = first[ i ][ k ];
+    return n;
+}
+
+/** \brief  Transposition, lanes to interleaved
+
+Assembles hypercomplex numbers from separate component arrays, i.e. converts
+structure-of-arrays data to array-of-structures.  This is the inverse of
+#boost::math::split_lanes, and runs the same way.
+
+    \pre  For each *k* \< `2^R`, `lanes[k]` points to an array of at least `n`
+          elements, not overlapping the output.
+
+    \param[in]  lanes   The starts of the component arrays, one per component.
+    \param[in]  n       The number of elements.
+    \param[out] result  The start of the output numbers.
+
+    \returns  The end of the output range.
+ */
+template < typename T, std::size_t R >
+auto  merge_lanes( T const * const *lanes, std::size_t n, complex_it<T, R>
+ *result ) -> complex_it<T, R> *
+{
+    constexpr std::size_t  size = complex_it<T, R>::static_size;
+    std::size_t const      tiles = n / detail::transpose_tile_size;
+
+    detail::batch_dispatch( detail::merge_lanes_body<T, R>{lanes, {result}},
+     tiles );
+    for ( std::size_t i = tiles * detail::transpose_tile_size ; i < n ; ++i )
+        for ( std::size_t k = 0u ; k < size ; ++k )
+            result[ i ][ k ] = lanes[ k ][ i ];
+    return result + n;
+}
+
+
+//  Structure-of-arrays class template definition  ---------------------------//
+
+/** \brief  A sequence of hypercomplex numbers, stored by component lanes
+
+Where a `std::vector<complex_it<Number, Rank>>` interleaves the components of
+each number, this container keeps `2^Rank` separate arrays, the *k*th holding
+component *k* of every element.  The whole-container operators (`+ - * /`,
+`conj`, `norm`, `abs`, and `sgn`) walk those lanes in step, so every inner loop
+is the same scalar operation on contiguous data, which compilers turn into
+vertical vector instructions.
+
+Elements are accessed through proxies that convert to and from `complex_it` and
+`complex_rt` objects.
+
+    \pre  `Number` meets the requirements of #boost::math::complex_it.
+
+    \tparam Number  The component type
+    \tparam Rank    The Cayley-Dickson construction level.  If not given, it
+                    defaults to 1, in order to model regular complex numbers.
+ */
+template < typename Number, std::size_t Rank = 1u >
+class complex_soa_vector
+{
+public:
+    // Core types
+    //! \copydoc  #boost::math::complex_it::size_type
+    typedef std::size_t                 size_type;
+    //! \copydoc  #boost::math::complex_it::value_type
+    typedef Number                      value_type;
+    //! The type of an element, when separated from the container.
+    typedef complex_it<Number, Rank>  element_type;
+
+    // Sizing parameters
+    //! \copydoc  #boost::math::complex_it::rank
+    static constexpr  size_type  rank = Rank;
+    //! The number of components per element, and so the number of lanes.
+    static constexpr  size_type  static_size = element_type::static_size;
+
+    /** \brief  Mutable access to one element
+
+    Refers to the components of one element across the lanes.  It converts to
+    an element (or `complex_rt`) value, and assigning to it writes back into
+    the lanes.
+     */
+    class reference
+    {
+    public:
+        //! Read the element.
+        operator element_type() const
+        {
+            element_type  result;
+
+            for ( size_type k = 0u ; k < static_size ; ++k )
+                result[ k ] = ( *this )[ k ];
+            return result;
+        }
+        //! Read the element, in recursive form.
+        operator complex_rt<Number, Rank>() const
+        {
+            complex_rt<Number, Rank>  result;
+
+            for ( size_type k = 0u ; k < static_size ; ++k )
+                result[ k ] = ( *this )[ k ];
+            return result;
+        }
+
+        //! Write the element.
+        auto  operator =( element_type const &x ) -> reference &
+        {
+            for ( size_type k = 0u ; k < static_size ; ++k )
+                ( *this )[ k ] = x[ k ];
+            return *this;
+        }
+        //! \overload
+        auto  operator =( complex_rt<Number, Rank> const &x ) -> reference &
+        {
+            for ( size_type k = 0u ; k < static_size ; ++k )
+                ( *this )[ k ] = x[ k ];
+            return *this;
+        }
+        //! Copy another element's value, not the reference.
+        auto  operator =( reference const &x ) -> reference &
+        { return *this = static_cast<element_type>( x ); }
+
+        /** \brief  Component access
+            \pre  *k* \< #static_size
+            \param[in] k  The index of the selected component.
+            \returns  The component's location in lane `k`.
+         */
+        auto  operator []( size_type k ) const -> value_type &
+        { return c->lanes[ k ][ i ]; }
+
+    private:
+        friend class complex_soa_vector;
+
+        reference( complex_soa_vector *container, size_type index ) noexcept
+            : c{ container }, i{ index }
+        {}
+
+        complex_soa_vector *  c;
+        size_type             i;
+    };
+
+    // Lifetime management
+    //! Create an empty sequence.
+    complex_soa_vector() = default;
+    /** \brief  Create a sequence of zeros.
+        \param[in] n  The number of elements.
+        \post  `this->size() == n`, and each element is zero.
+     */
+    explicit  complex_soa_vector( size_type n )
+    {
+        for ( auto &l : lanes )
+            l.resize( n );
+    }
+    /** \brief  Create a sequence from a range of elements.
+
+    Each element is split into the lanes; both `complex_it<Number, Rank>` and
+    `complex_rt<Number, Rank>` elements are accepted.  An array segment of
+    `complex_it<Number, Rank>` is transposed with #boost::math::split_lanes.
+
+        \param[in] first  The start of the elements.
+        \param[in] last   The end of the elements.
+        \post  `this->size() == std::distance(first, last)`.
+     */
+    template < typename InputIt >
+    complex_soa_vector( InputIt first, InputIt last )
+    {
+        assign_range( first, last, std::integral_constant<bool,
+         std::is_convertible<InputIt, element_type const *>::value>{} );
+    }
+    //! Create a sequence from a list of elements.
+    complex_soa_vector( std::initializer_list<element_type> list )
+        : complex_soa_vector( list.begin(), list.end() )
+    {}
+
+    // Size inspection and control
+    //! \returns  The number of elements.
+    auto  size() const noexcept -> size_type  { return lanes[0].size(); }
+    //! \returns  `this->size() == 0`.
+    auto  empty() const noexcept -> bool  { return lanes[0].empty(); }
+    //! Reserve room for `n` elements in each lane.
+    void  reserve( size_type n )
+    {
+        for ( auto &l : lanes )
+            l.reserve( n );
+    }
+    //! Change the number of elements, with new ones being zero.
+    void  resize( size_type n )
+    {
+        for ( auto &l : lanes )
+            l.resize( n );
+    }
+    //! Remove all elements.
+    void  clear() noexcept
+    {
+        for ( auto &l : lanes )
+            l.clear();
+    }
+    /** \brief  Append an element.
+        \param[in] x  The element to add, as a `complex_it` or `complex_rt`.
+        \post  `(*this)[this->size() - 1] == x`.
+     */
+    template < class Element >
+    void  push_back( Element const &x )
+    {
+        for ( size_type k = 0u ; k < static_size ; ++k )
+            lanes[ k ].push_back( x[k] );
+    }
+
+    // Element and lane access
+    /** \brief  Element access
+        \pre  *i* \< `this->size()`.
+        \param[in] i  The index of the selected element.
+        \returns  A proxy for the element (or a copy of it, for `const`
+                  containers).
+     */
+    auto  operator []( size_type i ) noexcept -> reference
+    { return {this, i}; }
+    //! \overload
+    auto  operator []( size_type i ) const -> element_type
+    {
+        element_type  result;
+
+        for ( size_type k = 0u ; k < static_size ; ++k )
+            result[ k ] = lanes[ k ][ i ];
+        return result;
+    }
+
+    /** \brief  Lane access
+        \pre  *k* \< #static_size
+        \param[in] k  The index of the component.
+        \returns  The start of the contiguous array of component `k` of every
+                  element.
+     */
+    auto  lane( size_type k ) noexcept -> value_type *
+    { return lanes[k].data(); }
+    //! \overload
+    auto  lane( size_type k ) const noexcept -> value_type const *
+    { return lanes[k].data(); }
+
+    /** \brief  Copy out the elements.
+
+    Assembles the elements with #boost::math::merge_lanes.
+
+        \pre  The array segment starting at `result` has room for
+              `this->size()` elements.
+        \param[out] result  The start of the output numbers.
+        \returns  The end of the output range.
+     */
+    auto  copy_to( element_type *result ) const -> element_type *
+    {
+        value_type const *  l[ static_size ];
+
+        for ( size_type k = 0u ; k < static_size ; ++k )
+            l[ k ] = lanes[ k ].data();
+        return merge_lanes( l, size(), result );
+    }
+
+    //! Exchange state with another sequence.
+    void  swap( complex_soa_vector &other ) noexcept
+    {
+        for ( size_type k = 0u ; k < static_size ; ++k )
+            lanes[ k ].swap( other.lanes[k] );
+    }
+
+private:
+    template < typename InputIt >
+    void  assign_range( InputIt first, InputIt last, std::false_type )
+    {
+        for ( ; first != last ; ++first )
+            push_back( *first );
+    }
+    void  assign_range( element_type const *first, element_type const *last,
+     std::true_type )
+    {
+        value_type *  l[ static_size ];
+
+        resize( last - first );
+        for ( size_type k = 0u ; k < static_size ; ++k )
+            l[ k ] = lanes[ k ].data();
+        split_lanes( first, last, l );
+    }
+
+    std::vector<value_type>  lanes[ static_size ];
+};
+
+/** Gives access to a template parameter.
+ */
+template < typename Number, std::size_t Rank >
+constexpr
+typename complex_soa_vector<Number, Rank>::size_type
+  complex_soa_vector<Number, Rank>::rank;
+
+/** One lane per component of `complex_it<Number, Rank>`.
+ */
+template < typename Number, std::size_t Rank >
+constexpr
+typename complex_soa_vector<Number, Rank>::size_type
+  complex_soa_vector<Number, Rank>::static_size;
+
+
+//  Object support functions  ------------------------------------------------//
+
+/** \brief  Swap
+
+Exchanges the state of two sequences.
+
+    \relates  #boost::math::complex_soa_vector
+
+    \param[in,out] a  The first object to be swapped.
+    \param[in,out] b  The second object to be swapped.
+ */
+template < typename T, std::size_t R >
+inline
+void  swap( complex_soa_vector<T, R> &a, complex_soa_vector<T, R> &b ) noexcept
+{ a.swap(b); }
+
+
+//! \cond
+namespace detail
+{
+    // Elements per step of the lane-wise loops that revisit data, to keep the
+    // touched part of every lane in the L1 cache.
+    constexpr std::size_t  soa_block_size = 512u;
+
+    // Out[k] +/-= A[i] * B[j] for each basis product e_i * e_j = +/-e_k, over
+    // elements [base, base + n), where B may be conjugated.
+    template < bool ConjugateB, std::size_t R, typename T >
+    void  soa_add_product( complex_soa_vector<T, R> &out,
+     complex_soa_vector<T, R> const &a, complex_soa_vector<T, R> const &b,
+     std::size_t base, std::size_t n )
+    {
+        constexpr std::size_t  size = complex_soa_vector<T, R>::static_size;
+
+        for ( std::size_t i = 0u ; i < size ; ++i )
+            for ( std::size_t j = 0u ; j < size ; ++j )
+            {
+                T *        o = out.lane( i ^ j ) + base;
+                T const *  x = a.lane( i ) + base;
+                T const *  y = b.lane( j ) + base;
+
+                if ( (cayley_basis<R>::sign( i, j ) < 0) != (ConjugateB && j) )
+                    for ( std::size_t t = 0u ; t < n ; ++t )
+                        o[ t ] -= x[ t ] * y[ t ];
+                else
+                    for ( std::size_t t = 0u ; t < n ; ++t )
+                        o[ t ] += x[ t ] * y[ t ];
+            }
+    }
+
+    // Norms of the elements [base, base + n) into the start of the buffer
+    template < std::size_t R, typename T >
+    void  soa_norms( T *result, complex_soa_vector<T, R> const &x, std::size_t
+     base, std::size_t n )
+    {
+        std::fill( result, result + n, T{} );
+        for ( std::size_t k = 0u ; k < x.static_size ; ++k )
+        {
+            T const *  l = x.lane( k ) + base;
+
+            for ( std::size_t t = 0u ; t < n ; ++t )
+                result[ t ] += l[ t ] * l[ t ];
+        }
+    }
+
+    // Divide the lanes of elements [base, base + n) by the given scalars:
+    // truncating division for integer types, which can't go out of range
+    template < std::size_t R, typename T >
+    void  soa_divide( complex_soa_vector<T, R> &x, T const *divisors,
+     std::size_t base, std::size_t n, complex_soa_vector<T, R> const &,
+     complex_soa_vector<T, R> const &, std::true_type )
+    {
+        for ( std::size_t k = 0u ; k < x.static_size ; ++k )
+        {
+            T *  l = x.lane( k ) + base;
+
+            for ( std::size_t t = 0u ; t < n ; ++t )
+                l[ t ] /= divisors[ t ];
+        }
+    }
+
+    // Divide the lanes of elements [base, base + n) by the given scalars:
+    // reciprocal multiplication otherwise, as detail::scale_quotient does it
+    // (the divisors are overwritten).  Elements where that can't be trusted
+    // are flagged in the same pass and redone with the division of complex_it,
+    // which falls back to a pre-scaled divisor.  n is at most soa_block_size.
+    template < std::size_t R, typename T >
+    void  soa_divide( complex_soa_vector<T, R> &x, T *divisors, std::size_t
+     base, std::size_t n, complex_soa_vector<T, R> const &dividend,
+     complex_soa_vector<T, R> const &divisor, std::false_type )
+    {
+        typedef typename complex_soa_vector<T, R>::element_type  element_type;
+        typedef std::integral_constant<bool,
+         std::numeric_limits<T>::is_bounded>  bounded;
+
+        T     one{};
+        bool  redo[ soa_block_size ];
+
+        ++one;
+        for ( std::size_t t = 0u ; t < n ; ++t )
+        {
+            T const  scale = one / divisors[ t ];
+
+            redo[ t ] = scale == T{} || !in_normal_range( scale, bounded{} );
+            divisors[ t ] = scale;
+        }
+        for ( std::size_t k = 0u ; k < x.static_size ; ++k )
+        {
+            T *  l = x.lane( k ) + base;
+
+            for ( std::size_t t = 0u ; t < n ; ++t )
+            {
+                T const  p = l[ t ];
+
+                redo[ t ] |= !in_normal_range( p, bounded{} );
+                l[ t ] = p * divisors[ t ];
+            }
+        }
+        for ( std::size_t t = 0u ; t < n ; ++t )
+            if ( redo[t] )
+                x[ base + t ] = element_type( dividend[base + t] ) /
+                 element_type( divisor[base + t] );
+    }
+
+    // Apply an element-wise operation to corresponding lanes.
+    template < std::size_t R, typename T, class Op >
+    auto  soa_lanewise( complex_soa_vector<T, R> const &a,
+     complex_soa_vector<T, R> const &b, Op op ) -> complex_soa_vector<T, R>
+    {
+        complex_soa_vector<T, R>  result( a.size() );
+
+        for ( std::size_t k = 0u ; k < result.static_size ; ++k )
+            std::transform( a.lane(k), a.lane(k) + a.size(), b.lane(k),
+             result.lane(k), op );
+        return result;
+    }
+
+}  // namespace detail
+//! \endcond
+
+
+//  Whole-sequence operators  ------------------------------------------------//
+
+/** \brief  Addition, lane-wise
+
+Adds corresponding elements of the given sequences.
+
+    \relates  #boost::math::complex_soa_vector
+
+    \pre  `augend.size() == addend.size()`.
+
+    \param[in] augend  The first sequence of terms.
+    \param[in] addend  The second sequence of terms.
+
+    \returns  The sequence of sums.
+ */
+template < typename T, std::size_t R >
+inline
+auto  operator +( complex_soa_vector<T, R> const &augend,
+ complex_soa_vector<T, R> const &addend ) -> complex_soa_vector<T, R>
+{ return detail::soa_lanewise( augend, addend, std::plus<T>{} ); }
+
+/** \brief  Subtraction, lane-wise
+
+Subtracts corresponding elements of the given sequences.
+
+    \relates  #boost::math::complex_soa_vector
+
+    \pre  `minuend.size() == subtrahend.size()`.
+
+    \param[in] minuend     The sequence of values to be subtracted from.
+    \param[in] subtrahend  The sequence of values to subtract.
+
+    \returns  The sequence of differences.
+ */
+template < typename T, std::size_t R >
+inline
+auto  operator -( complex_soa_vector<T, R> const &minuend,
+ complex_soa_vector<T, R> const &subtrahend ) -> complex_soa_vector<T, R>
+{ return detail::soa_lanewise( minuend, subtrahend, std::minus<T>{} ); }
+
+/** \brief  Multiplication, Cayley, lane-wise
+
+Multiplies corresponding elements of the given sequences.  Each of the `4^Rank`
+component products is a multiply-add between whole lanes, with its sign
+resolved before the loop, done in cache-sized blocks of elements.
+
+    \relates  #boost::math::complex_soa_vector
+
+    \pre  `multiplicand.size() == multiplier.size()`.
+
+    \param[in] multiplicand  The sequence of first factors.
+    \param[in] multiplier    The sequence of second factors.
+
+    \returns  The sequence of products.
+ */
+template < typename T, std::size_t R >
+auto  operator *( complex_soa_vector<T, R> const &multiplicand,
+ complex_soa_vector<T, R> const &multiplier ) -> complex_soa_vector<T, R>
+{
+    std::size_t const         n = multiplicand.size();
+    complex_soa_vector<T, R>  product( n );
+
+    for ( std::size_t base = 0u ; base < n ; base += detail::soa_block_size )
+        detail::soa_add_product<false>( product, multiplicand, multiplier, base,
+         std::min(detail::soa_block_size, n - base) );
+    return product;
+}
+
+/** \brief  Division, Cayley, lane-wise
+
+Divides corresponding elements of the given sequences, with the same semantics
+as the division operator of `complex_it`: the dividend times the divisor's
+conjugate, divided by the divisor's norm (truncating for integer types).  Any
+element whose norm or product leaves the normal range is redone by that
+operator, so it gets the same pre-scaled fallback.
+
+    \relates  #boost::math::complex_soa_vector
+
+    \pre  `dividend.size() == divisor.size()`.
+    \pre  No element of `divisor` is zero.
+
+    \param[in] dividend  The sequence of values to be divided.
+    \param[in] divisor   The sequence of values to divide by.
+
+    \returns  The sequence of quotients.
+ */
+template < typename T, std::size_t R >
+auto  operator /( complex_soa_vector<T, R> const &dividend,
+ complex_soa_vector<T, R> const &divisor ) -> complex_soa_vector<T, R>
+{
+    std::size_t const         n = dividend.size();
+    complex_soa_vector<T, R>  quotient( n );
+    std::vector<T>            norms( std::min(detail::soa_block_size, n) );
+
+    for ( std::size_t base = 0u ; base < n ; base += detail::soa_block_size )
+    {
+        std::size_t const  m = std::min( detail::soa_block_size, n - base );
+
+        detail::soa_add_product<true>( quotient, dividend, divisor, base, m );
+        detail::soa_norms( norms.data(), divisor, base, m );
+        detail::soa_divide( quotient, norms.data(), base, m, dividend, divisor,
+         std::integral_constant<bool, std::numeric_limits<T>::is_integer>{} );
+    }
+    return quotient;
+}
+
+
+//  Whole-sequence functions  ------------------------------------------------//
+
+/** \brief  Complex conjugate, lane-wise
+
+    \relatesalso  #boost::math::complex_soa_vector
+
+    \param[in] x  The input sequence.
+
+    \returns  The sequence of conjugates of the elements of `x`.
+ */
+template < typename T, std::size_t R >
+auto  conj( complex_soa_vector<T, R> const &x ) -> complex_soa_vector<T, R>
+{
+    complex_soa_vector<T, R>  result( x.size() );
+
+    std::copy( x.lane(0), x.lane(0) + x.size(), result.lane(0) );
+    for ( std::size_t k = 1u ; k < x.static_size ; ++k )
+        std::transform( x.lane(k), x.lane(k) + x.size(), result.lane(k),
+         std::negate<T>{} );
+    return result;
+}
+
+/** \brief  Cayley norm, lane-wise
+
+    \relatesalso  #boost::math::complex_soa_vector
+
+    \param[in] x  The input sequence.
+
+    \returns  The sequence of Cayley norms of the elements of `x`.
+ */
+template < typename T, std::size_t R >
+auto  norm( complex_soa_vector<T, R> const &x ) -> std::vector<T>
+{
+    std::vector<T>  result( x.size() );
+
+    detail::soa_norms( result.data(), x, 0u, x.size() );
+    return result;
+}
+
+/** \brief  Euclidean norm, lane-wise
+
+    \relatesalso  #boost::math::complex_soa_vector
+
+    \pre  `sqrt` is callable on `T`, found through `std` or ADL.
+
+    \param[in] x  The input sequence.
+
+    \returns  The sequence of absolute values of the elements of `x`.
+ */
+template < typename T, std::size_t R >
+auto  abs( complex_soa_vector<T, R> const &x ) -> std::vector<T>
+{
+    using std::sqrt;
+
+    std::vector<T>  result = norm( x );
+
+    for ( auto &r : result )
+        r = sqrt( r );
+    return result;
+}
+
+/** \brief  Sign / Unit-vector, lane-wise
+
+    \relatesalso  #boost::math::complex_soa_vector
+
+    \pre  `sqrt` is callable on `T`, found through `std` or ADL.
+
+    \param[in] x  The input sequence.
+
+    \returns  The sequence of unit vectors in the direction of the elements of
+              `x`, with zero elements kept as zero.
+ */
+template < typename T, std::size_t R >
+auto  sgn( complex_soa_vector<T, R> const &x ) -> complex_soa_vector<T, R>
+{
+    std::vector<T> const      a = abs( x );
+    complex_soa_vector<T, R>  result( x.size() );
+
+    for ( std::size_t k = 0u ; k < x.static_size ; ++k )
+    {
+        T const *  l = x.lane( k );
+        T *        r = result.lane( k );
+
+        for ( std::size_t t = 0u ; t < x.size() ; ++t )
+            r[ t ] = a[ t ] ? l[ t ] / a[ t ] : l[ t ];
+    }
+    return result;
+}
+
+
+}  // namespace math
+}  // namespace boost
+
+
+#endif // BOOST_MATH_COMPLEX_SOA_HPP
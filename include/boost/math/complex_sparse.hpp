@@ -0,0 +1,627 @@
+//  Boost Complex Numbers, sparse storage header file  -----------------------//
+
+//  Copyright 2013 Daryle Walker.
+//  Distributed under the Boost Software License, Version 1.0.  (See the
+//  accompanying file LICENSE_1_0.txt or a copy at
+//  <http://www.boost.org/LICENSE_1_0.txt>.)
+
+//  See <http://www.boost.org/libs/math/> for the library's home page.
+
+/** \file   boost/math/complex_sparse.hpp
+    \brief  A hypercomplex number class template storing only non-zeros.
+
+    \author  Daryle Walker
+
+    \version  0.1
+
+    \copyright  Boost Software License, version 1.0
+
+    Contains the declaration (and definition) of class template
+    `sparse_complex`, which models the same Cayley-Dickson hypercomplex numbers
+    as `complex_it` and `complex_rt`, but keeps only the non-zero components, so
+    high-rank values with few non-zeros are cheap to store and multiply.
+
+    \warning  This library requires C++2011 features.
+ */
+
+#ifndef BOOST_MATH_COMPLEX_SPARSE_HPP
+#define BOOST_MATH_COMPLEX_SPARSE_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <ostream>
+#include <utility>
+#include <vector>
+
+#include "boost/math/complex_it.hpp"
+#include "boost/math/complex_rt.hpp"
+
+
+namespace boost
+{
+namespace math
+{
+
+
+//  Sparse hypercomplex number class template definition  --------------------//
+
+/** \brief  A hypercomplex number storing only its non-zero components
+
+Holds `(index, value)` entries sorted by index, with no zero values, so the
+memory and the work of each operation scale with the number of non-zero
+components instead of `2^Rank`.  The Cayley product visits only pairs of
+non-zero components, placing each component product with the basis sign
+(#boost::math::detail::basis_product_sign, which the
+#boost::math::cayley_basis table also uses) and the index XOR.  For
+high-rank values, that is far less than the `4^Rank` component products of the
+dense types.
+
+Values convert explicitly to and from `complex_it` and `complex_rt` objects of
+the same rank.
+
+    \pre  Same as #boost::math::complex_it.  A default-constructed `Number` is
+          zero, and `static_cast<bool>` of a `Number` tests for non-zero.
+
+    \tparam Number  The component type
+    \tparam Rank    The Cayley-Dickson construction level.  If not given, it
+                    defaults to 1, in order to model regular complex numbers.
+ */
+template < typename Number, std::size_t Rank = 1u >
+class sparse_complex
+{
+public:
+    // Core types
+    //! \copydoc  #boost::math::complex_it::size_type
+    typedef std::size_t                        size_type;
+    //! \copydoc  #boost::math::complex_it::value_type
+    typedef Number                             value_type;
+    //! The type of a stored component: its index and its (non-zero) value.
+    typedef std::pair<size_type, value_type>   entry_type;
+    //! The type for iterating over the stored components, by index.
+    typedef typename std::vector<entry_type>::const_iterator  const_iterator;
+
+    // Sizing parameters
+    //! \copydoc  #boost::math::complex_it::rank
+    static constexpr  size_type  rank = Rank;
+    //! \copydoc  #boost::math::complex_it::static_size
+    static constexpr  size_type  static_size = 1ULL << rank;
+
+    // Lifetime management
+    //! Create a zero value.
+    sparse_complex() = default;
+    /** \brief  Single-real conversion
+        \param[in] r  The real component.
+        \post  `(*this)[0] == r`, and the other components are zero.
+     */
+    sparse_complex( value_type const &r )
+    { set( 0u, r ); }
+    /** \brief  Create from a list of components.
+
+    Entries may come in any order; zero values are dropped, and for repeated
+    indices, the last entry wins.
+
+        \pre  Each index is less than #static_size.
+        \param[in] list  The `(index, value)` entries.
+     */
+    sparse_complex( std::initializer_list<entry_type> list )
+    {
+        for ( auto const &e : list )
+            set( e.first, e.second );
+    }
+    /** \brief  Convert from `complex_it`.
+        \param[in] x  The dense value.
+        \post  For each valid `k`, `(*this)[k] == x[k]`.
+     */
+    explicit  sparse_complex( complex_it<Number, Rank> const &x )
+    { assign_dense( math::begin(x), math::end(x) ); }
+    /** \brief  Convert from `complex_rt`.
+        \param[in] x  The dense value.
+        \post  For each valid `k`, `(*this)[k] == x[k]`.
+     */
+    explicit  sparse_complex( complex_rt<Number, Rank> const &x )
+    { assign_dense( math::begin(x), math::end(x) ); }
+
+    // Conversions
+    //! Convert to `complex_it`, filling in the zeros.
+    explicit  operator complex_it<Number, Rank>() const
+    {
+        complex_it<Number, Rank>  result{};
+
+        for ( auto const &e : entries )
+            result[ e.first ] = e.second;
+        return result;
+    }
+    //! Convert to `complex_rt`, filling in the zeros.
+    explicit  operator complex_rt<Number, Rank>() const
+    {
+        complex_rt<Number, Rank>  result{};
+
+        for ( auto const &e : entries )
+            result[ e.first ] = e.second;
+        return result;
+    }
+    //! \copydoc  #boost::math::complex_it::operator bool()const
+    explicit  operator bool() const noexcept  { return !entries.empty(); }
+
+    // Component access
+    /** \brief  Read a component.
+        \pre  *i* \< #static_size.
+        \param[in] i  The index of the component.
+        \returns  The component's value, zero if it isn't stored.
+     */
+    auto  operator []( size_type i ) const -> value_type
+    {
+        auto const  p = find( i );
+
+        return ( p != entries.end() && p->first == i ) ? p->second :
+         value_type{};
+    }
+    /** \brief  Write a component.
+        \pre  *i* \< #static_size.
+        \param[in] i  The index of the component.
+        \param[in] v  The new value.  Storing zero removes the entry.
+        \post  `(*this)[i] == v`.
+     */
+    void  set( size_type i, value_type const &v )
+    {
+        auto  p = find( i );
+
+        if ( p != entries.end() && p->first == i )
+        {
+            if ( static_cast<bool>(v) )
+                p->second = v;
+            else
+                entries.erase( p );
+        }
+        else if ( static_cast<bool>(v) )
+            entries.insert( p, entry_type{i, v} );
+    }
+
+    //! \returns  The number of stored (non-zero) components.
+    auto  nonzero_count() const noexcept -> size_type
+    { return entries.size(); }
+    //! \returns  The start of the stored components, by increasing index.
+    auto  begin() const noexcept -> const_iterator  { return entries.begin(); }
+    //! \returns  The end of the stored components.
+    auto  end() const noexcept -> const_iterator  { return entries.end(); }
+
+    /** \brief  Take over a sorted list of entries.
+        \pre  The indices in `e` are strictly increasing and less than
+              #static_size, and no value is zero.
+        \param[in] e  The entries to store.
+     */
+    void  assign_entries( std::vector<entry_type> &&e ) noexcept
+    { entries = std::move( e ); }
+
+    //! Exchange state with another object.
+    void  swap( sparse_complex &other ) noexcept
+    { entries.swap( other.entries ); }
+
+private:
+    static  bool  index_less( entry_type const &e, size_type k ) noexcept
+    { return e.first < k; }
+
+    auto  find( size_type i ) -> typename std::vector<entry_type>::iterator
+    {
+        return std::lower_bound( entries.begin(), entries.end(), i,
+         index_less );
+    }
+    auto  find( size_type i ) const -> const_iterator
+    {
+        return std::lower_bound( entries.begin(), entries.end(), i,
+         index_less );
+    }
+
+    template < typename Iterator >
+    void  assign_dense( Iterator first, Iterator last )
+    {
+        for ( size_type k = 0u ; first != last ; ++first, ++k )
+            if ( static_cast<bool>(*first) )
+                entries.emplace_back( k, *first );
+    }
+
+    // Member data
+    std::vector<entry_type>  entries;
+};
+
+/** Gives access to a template parameter.
+ */
+template < typename Number, std::size_t Rank >
+constexpr
+typename sparse_complex<Number, Rank>::size_type
+  sparse_complex<Number, Rank>::rank;
+
+/** The component count doubles when going to the next rank.
+ */
+template < typename Number, std::size_t Rank >
+constexpr
+typename sparse_complex<Number, Rank>::size_type
+  sparse_complex<Number, Rank>::static_size;
+
+
+//  Object support functions  ------------------------------------------------//
+
+/** \brief  Swap
+
+Exchanges the state of two objects.
+
+    \relates  #boost::math::sparse_complex
+
+    \param[in,out] a  The first object to be swapped.
+    \param[in,out] b  The second object to be swapped.
+ */
+template < typename T, std::size_t R >
+inline
+void  swap( sparse_complex<T, R> &a, sparse_complex<T, R> &b ) noexcept
+{ a.swap( b ); }
+
+
+//  Equality operators  ------------------------------------------------------//
+
+/** \brief  Equality comparison
+
+    \relates  #boost::math::sparse_complex
+
+    \param[in] l  The left-side argument.
+    \param[in] r  The right-side argument.
+
+    \returns  Whether every component of `l` equals the corresponding one of
+              `r`.
+ */
+template < typename T, std::size_t R >
+inline
+bool  operator ==( sparse_complex<T, R> const &l, sparse_complex<T, R> const
+ &r )
+{
+    return l.nonzero_count() == r.nonzero_count() && std::equal( l.begin(),
+     l.end(), r.begin() );
+}
+
+/** \brief  Inequality comparison
+
+    \relates  #boost::math::sparse_complex
+
+    \param[in] l  The left-side argument.
+    \param[in] r  The right-side argument.
+
+    \returns  `!(l == r)`.
+ */
+template < typename T, std::size_t R >
+inline
+bool  operator !=( sparse_complex<T, R> const &l, sparse_complex<T, R> const
+ &r )
+{ return not operator ==(l, r); }
+
+
+//  Input/output operators  --------------------------------------------------//
+
+/** \brief  Output-streaming
+
+Writes the same text as the dense types would, e.g. `(1,0,0,2)`.
+
+    \relatesalso  #boost::math::sparse_complex
+
+    \param[in,out] o  The stream to send the output
+    \param[in]     x  The complex number to be written
+
+    \returns  `o`
+ */
+template < typename Ch, class Tr, typename T, std::size_t R >
+inline
+std::basic_ostream<Ch, Tr> &
+operator <<( std::basic_ostream<Ch, Tr> &o, sparse_complex<T, R> const &x )
+{ return o << static_cast<complex_it<T, R>>( x ); }
+
+
+//  Arithmetic operators  ----------------------------------------------------//
+
+//! \cond
+namespace detail
+{
+    // Merge two sorted entry lists, combining entries with equal indices and
+    // passing lone entries of the second list through `single`
+    template < typename T, std::size_t R, class Combine, class Single >
+    auto  sparse_merge( sparse_complex<T, R> const &a, sparse_complex<T, R>
+     const &b, Combine combine, Single single ) -> sparse_complex<T, R>
+    {
+        typedef typename sparse_complex<T, R>::entry_type  entry_type;
+
+        std::vector<entry_type>  result;
+        auto                     ai = a.begin(), bi = b.begin();
+
+        result.reserve( a.nonzero_count() + b.nonzero_count() );
+        while ( ai != a.end() || bi != b.end() )
+        {
+            if ( bi == b.end() || (ai != a.end() && ai->first < bi->first) )
+                result.push_back( *ai++ );
+            else if ( ai == a.end() || bi->first < ai->first )
+            {
+                result.emplace_back( bi->first, single(bi->second) );
+                ++bi;
+            }
+            else
+            {
+                T const  v = combine( ai->second, bi->second );
+
+                if ( static_cast<bool>(v) )
+                    result.emplace_back( ai->first, v );
+                ++ai, ++bi;
+            }
+        }
+
+        sparse_complex<T, R>  z;
+
+        z.assign_entries( std::move(result) );
+        return z;
+    }
+
+    // The sign of e_i * e_j, as basis_product_sign gives, for run-time
+    // indices.  Each level is the same case split as basis_product_sign_split,
+    // done with masks so the scattered indices of a sparse product don't cost
+    // a mispredicted branch per level.
+    inline
+    bool  sparse_sign_negative( std::size_t rank, std::size_t i, std::size_t
+     j ) noexcept
+    {
+        std::size_t  negate = 0u;
+
+        while ( rank-- )
+        {
+            std::size_t const  hi = i >> rank & 1u, hj = j >> rank & 1u;
+            std::size_t const  low = ( std::size_t(1) << rank ) - 1u;
+
+            i &= low;
+            j &= low;
+            negate ^= hi & ( hj ^ std::size_t(j != 0u) );
+
+            // Swap the reduced indices when the right factor was in the upper
+            // half
+            std::size_t const  swap = ( i ^ j ) & ( 0u - hj );
+
+            i ^= swap;
+            j ^= swap;
+        }
+        return negate;
+    }
+
+    // Element-wise operation objects
+    struct sparse_plus
+    {
+        template < typename T >
+        auto  operator ()( T const &a, T const &b ) const -> T
+        { return a + b; }
+    };
+
+    struct sparse_minus
+    {
+        template < typename T >
+        auto  operator ()( T const &a, T const &b ) const -> T
+        { return a - b; }
+    };
+
+    struct sparse_identity
+    {
+        template < typename T >
+        auto  operator ()( T const &a ) const -> T  { return a; }
+    };
+
+    struct sparse_negate
+    {
+        template < typename T >
+        auto  operator ()( T const &a ) const -> T  { return -a; }
+    };
+
+}  // namespace detail
+//! \endcond
+
+/** \brief  Negation
+
+    \relates  #boost::math::sparse_complex
+
+    \param[in] x  The input value.
+
+    \returns  The additive inverse of `x`.
+ */
+template < typename T, std::size_t R >
+auto  operator -( sparse_complex<T, R> const &x ) -> sparse_complex<T, R>
+{
+    std::vector<typename sparse_complex<T, R>::entry_type>  e( x.begin(),
+     x.end() );
+    sparse_complex<T, R>                                    result;
+
+    for ( auto &ee : e )
+        ee.second = -ee.second;
+    result.assign_entries( std::move(e) );
+    return result;
+}
+
+/** \brief  Conjugation
+
+    \relatesalso  #boost::math::sparse_complex
+
+    \param[in] x  The input value.
+
+    \returns  `x` with all but its real component negated.
+ */
+template < typename T, std::size_t R >
+auto  conj( sparse_complex<T, R> const &x ) -> sparse_complex<T, R>
+{
+    std::vector<typename sparse_complex<T, R>::entry_type>  e( x.begin(),
+     x.end() );
+    sparse_complex<T, R>                                    result;
+
+    for ( auto &ee : e )
+        if ( ee.first )
+            ee.second = -ee.second;
+    result.assign_entries( std::move(e) );
+    return result;
+}
+
+/** \brief  Addition
+
+    \relates  #boost::math::sparse_complex
+
+    \param[in] augend  The first term.
+    \param[in] addend  The second term.
+
+    \returns  The sum, with components that cancel removed.
+ */
+template < typename T, std::size_t R >
+inline
+auto  operator +( sparse_complex<T, R> const &augend, sparse_complex<T, R> const
+ &addend ) -> sparse_complex<T, R>
+{
+    return detail::sparse_merge( augend, addend, detail::sparse_plus{},
+     detail::sparse_identity{} );
+}
+
+/** \brief  Subtraction
+
+    \relates  #boost::math::sparse_complex
+
+    \param[in] minuend     The value to be subtracted from.
+    \param[in] subtrahend  The value to subtract.
+
+    \returns  The difference, with components that cancel removed.
+ */
+template < typename T, std::size_t R >
+inline
+auto  operator -( sparse_complex<T, R> const &minuend, sparse_complex<T, R>
+ const &subtrahend ) -> sparse_complex<T, R>
+{
+    return detail::sparse_merge( minuend, subtrahend, detail::sparse_minus{},
+     detail::sparse_negate{} );
+}
+
+/** \brief  Multiplication, Cayley, sparsity-aware
+
+Only pairs of stored components are multiplied.  Each product lands on the
+index XOR of its factors, with the sign of the basis-unit product.  The products
+are summed in a small open-addressing table keyed by that index, sized to twice
+the number of non-zero pairs (but no more than `2^Rank` slots, where it indexes
+directly), and the touched slots are then sorted by index.  The scratch space
+grows with the number of non-zero pairs instead of with `2^Rank`.
+
+    \relates  #boost::math::sparse_complex
+
+    \param[in] multiplicand  The first factor.
+    \param[in] multiplier    The second factor.
+
+    \returns  The Cayley product, with components that cancel removed.
+ */
+template < typename T, std::size_t R >
+auto  operator *( sparse_complex<T, R> const &multiplicand, sparse_complex<T, R>
+ const &multiplier ) -> sparse_complex<T, R>
+{
+    typedef typename sparse_complex<T, R>::entry_type  entry_type;
+
+    std::size_t const  n = sparse_complex<T, R>::static_size;
+    std::size_t const  pairs = multiplicand.nonzero_count() *
+     multiplier.nonzero_count();
+    std::size_t        slots = 1u;
+
+    while ( slots < n && slots < 2u * pairs )
+        slots <<= 1;
+
+    // A key of n marks an empty slot.
+    std::vector<std::size_t>  keys( slots, n ), used;
+    std::vector<T>            sums( slots );
+
+    used.reserve( std::min(pairs, slots) );
+    for ( auto const &a : multiplicand )
+        for ( auto const &b : multiplier )
+        {
+            std::size_t const  k = a.first ^ b.first;
+            std::size_t        s = k & ( slots - 1u );
+            T const            p = a.second * b.second;
+
+            while ( keys[s] != k && keys[s] != n )
+                s = ( s + 1u ) & ( slots - 1u );
+            if ( keys[s] == n )
+            {
+                keys[ s ] = k;
+                used.push_back( s );
+            }
+            if ( detail::sparse_sign_negative(R, a.first, b.first) )
+                sums[ s ] -= p;
+            else
+                sums[ s ] += p;
+        }
+    std::sort( used.begin(), used.end(), [&keys](std::size_t x, std::size_t
+     y){ return keys[x] < keys[y]; } );
+
+    std::vector<entry_type>  entries;
+    sparse_complex<T, R>     result;
+
+    for ( auto const s : used )
+        if ( static_cast<bool>(sums[ s ]) )
+            entries.emplace_back( keys[s], std::move(sums[ s ]) );
+    result.assign_entries( std::move(entries) );
+    return result;
+}
+
+/** \brief  Multiplication, scalar
+
+    \relates  #boost::math::sparse_complex
+
+    \param[in] multiplicand  The hypercomplex factor.
+    \param[in] multiplier    The real factor.
+
+    \returns  `multiplicand` with each component scaled.
+ */
+template < typename T, std::size_t R >
+auto  operator *( sparse_complex<T, R> const &multiplicand, T const
+ &multiplier ) -> sparse_complex<T, R>
+{
+    typedef typename sparse_complex<T, R>::entry_type  entry_type;
+
+    std::vector<entry_type>  entries;
+    sparse_complex<T, R>     result;
+
+    for ( auto const &e : multiplicand )
+    {
+        T const  v = e.second * multiplier;
+
+        if ( static_cast<bool>(v) )
+            entries.emplace_back( e.first, v );
+    }
+    result.assign_entries( std::move(entries) );
+    return result;
+}
+
+//! \overload
+template < typename T, std::size_t R >
+inline
+auto  operator *( T const &multiplicand, sparse_complex<T, R> const
+ &multiplier ) -> sparse_complex<T, R>
+{ return multiplier * multiplicand; }
+
+
+//  Norm functions  ----------------------------------------------------------//
+
+/** \brief  Cayley norm
+
+    \relatesalso  #boost::math::sparse_complex
+
+    \param[in] x  The input value.
+
+    \returns  The sum of the squares of the stored components.
+ */
+template < typename T, std::size_t R >
+auto  norm( sparse_complex<T, R> const &x )
+ -> decltype( std::declval<T>() * std::declval<T>() )
+{
+    decltype( norm(x) )  result{};
+
+    for ( auto const &e : x )
+        result += e.second * e.second;
+    return result;
+}
+
+
+}  // namespace math
+}  // namespace boost
+
+
+#endif // BOOST_MATH_COMPLEX_SPARSE_HPP
@@ -0,0 +1,295 @@
+//  Boost Complex Numbers, basis unit header file  ---------------------------//
+
+//  Copyright 2013 Daryle Walker.
+//  Distributed under the Boost Software License, Version 1.0.  (See the
+//  accompanying file LICENSE_1_0.txt or a copy at
+//  <http://www.boost.org/LICENSE_1_0.txt>.)
+
+//  See <http://www.boost.org/libs/math/> for the library's home page.
+
+/** \file   boost/math/complex_unit.hpp
+    \brief  Tag types for the Cayley-Dickson basis units.
+
+    \author  Daryle Walker
+
+    \version  0.1
+
+    \copyright  Boost Software License, version 1.0
+
+    Contains the declaration (and definition) of class template `basis_unit`,
+    an empty type standing for one basis unit, `e_K`.  Multiplying a
+    `complex_it` or `complex_rt` by one moves and negates components in a
+    pattern fixed at compile time, without any component multiplies.
+
+    \warning  This library requires C++2011 features.
+ */
+
+#ifndef BOOST_MATH_COMPLEX_UNIT_HPP
+#define BOOST_MATH_COMPLEX_UNIT_HPP
+
+#include <cstddef>
+
+#include "boost/math/complex_it.hpp"
+#include "boost/math/complex_rt.hpp"
+
+
+namespace boost
+{
+namespace math
+{
+
+
+//  Basis unit class template definition  ------------------------------------//
+
+//! \cond
+namespace detail
+{
+    // The lowest rank with a basis unit of the given index
+    inline constexpr
+    auto  unit_rank( std::size_t k ) noexcept -> std::size_t
+    { return k ? 1u + unit_rank( k >> 1 ) : 0u; }
+
+}  // namespace detail
+//! \endcond
+
+/** \brief  A basis unit, as a type
+
+Stands for `e_K`, the hypercomplex number with component `K` set to one and the
+others zero.  Since `e_i * e_K == sign(i, K) * e_(i XOR K)`, the product of a
+value and `e_K` has the components of the value in another order, some
+negated.  The operators with `complex_it` and `complex_rt` do just that: each
+result component is a source component picked, and its sign fixed, at compile
+time.  That is a permutation and sign flips (for IEEE types, a shuffle and an
+XOR with a constant mask with vector instructions), instead of a Cayley
+product.
+
+    \pre  `K` \< `2 ^ Rank`.
+
+    \tparam K     The index of the unit.
+    \tparam Rank  The Cayley-Dickson construction level the unit is taken from.
+                  If not given, it's the lowest level with a unit of index `K`.
+ */
+template < std::size_t K, std::size_t Rank = detail::unit_rank(K) >
+struct basis_unit
+{
+    static_assert( K < (1ULL << Rank), "Basis unit index too large for rank" );
+
+    // Core types
+    //! \copydoc  #boost::math::complex_it::size_type
+    typedef std::size_t  size_type;
+
+    // Sizing parameters
+    //! The index of the unit.  Gives access to a template parameter.
+    static constexpr  size_type  index = K;
+    //! \copydoc  #boost::math::complex_it::rank
+    static constexpr  size_type  rank = Rank;
+
+    // Conversions
+    /** \brief  Convert to `complex_it`.
+        \returns  The value with component #index set to one, and the others
+                  zero.
+     */
+    template < typename T >
+    operator complex_it<T, Rank>() const
+    {
+        complex_it<T, Rank>  result{};
+
+        ++result[ K ];
+        return result;
+    }
+    /** \brief  Convert to `complex_rt`.
+        \returns  The value with component #index set to one, and the others
+                  zero.
+     */
+    template < typename T >
+    operator complex_rt<T, Rank>() const
+    {
+        complex_rt<T, Rank>  result{};
+
+        ++result[ K ];
+        return result;
+    }
+};
+
+/** Gives access to a template parameter.
+ */
+template < std::size_t K, std::size_t Rank >
+constexpr
+typename basis_unit<K, Rank>::size_type  basis_unit<K, Rank>::index;
+
+/** Gives access to a template parameter.
+ */
+template < std::size_t K, std::size_t Rank >
+constexpr
+typename basis_unit<K, Rank>::size_type  basis_unit<K, Rank>::rank;
+
+
+//  Basis unit multiplication operators  -------------------------------------//
+
+//! \cond
+namespace detail
+{
+    // Where component M of x * e_K (or e_K * x) comes from: source component
+    // M XOR K, maybe negated, or nothing when x is too short.
+    template < bool UnitOnLeft, std::size_t K, std::size_t Q, std::size_t M >
+    struct unit_term
+    {
+        static constexpr  std::size_t  source = M ^ K;
+        static constexpr  bool         negate = basis_product_sign( Q,
+         UnitOnLeft ? K : source, UnitOnLeft ? source : K ) < 0;
+    };
+
+    // z = x * e_K (or e_K * x), negated if Negate, one component at a time
+    // with the sources and signs all constants.  Z has rank Q; X has S.
+    template < bool UnitOnLeft, bool Negate, std::size_t K, std::size_t Q,
+     std::size_t S, class Z, class X, std::size_t ...M >
+    inline
+    void  unit_product( Z &z, X const &x, index_list<M...> )
+    {
+        typedef typename Z::value_type  value_type;
+
+        int const  expand[] = { 0, (z[ M ] = ( unit_term<UnitOnLeft, K, Q,
+         M>::source < (1ULL << S) ) ? ( (unit_term<UnitOnLeft, K, Q,
+         M>::negate != Negate) ? value_type( -x[unit_term<UnitOnLeft, K, Q,
+         M>::source] ) : x[unit_term<UnitOnLeft, K, Q, M>::source] ) :
+         value_type{}, 0)... };
+
+        (void)expand;
+    }
+
+    // The rank of a product
+    inline constexpr
+    auto  unit_product_rank( std::size_t r, std::size_t s ) noexcept
+     -> std::size_t
+    { return ( r < s ) ? s : r; }
+
+}  // namespace detail
+//! \endcond
+
+/** \brief  Multiplication by a basis unit, on the right
+
+    \relates  #boost::math::basis_unit
+
+    \param[in] multiplicand  The value to be multiplied.
+    \param[in] multiplier    The unit `e_K`.
+
+    \returns  `multiplicand * e_K`, with components moved and negated.
+ */
+template < typename T, std::size_t S, std::size_t K, std::size_t R >
+inline
+auto  operator *( complex_it<T, S> const &multiplicand, basis_unit<K, R> )
+ -> complex_it<T, detail::unit_product_rank(R, S)>
+{
+    constexpr std::size_t  q = detail::unit_product_rank( R, S );
+
+    complex_it<T, q>  product;
+
+    detail::unit_product<false, false, K, q, S>( product, multiplicand,
+     detail::make_index_list<(1ULL << q)>{} );
+    return product;
+}
+
+/** \brief  Multiplication by a basis unit, on the left
+
+    \relates  #boost::math::basis_unit
+
+    \param[in] multiplier  The value to be multiplied.
+
+    \returns  `e_K * multiplier`, with components moved and negated.
+ */
+template < std::size_t K, std::size_t R, typename T, std::size_t S >
+inline
+auto  operator *( basis_unit<K, R>, complex_it<T, S> const &multiplier )
+ -> complex_it<T, detail::unit_product_rank(R, S)>
+{
+    constexpr std::size_t  q = detail::unit_product_rank( R, S );
+
+    complex_it<T, q>  product;
+
+    detail::unit_product<true, false, K, q, S>( product, multiplier,
+     detail::make_index_list<(1ULL << q)>{} );
+    return product;
+}
+
+/** \brief  Division by a basis unit
+
+Since `Inv(e_K) == Conj(e_K)`, which is `-e_K` past `e_0`, this is a
+multiplication with the signs flipped.
+
+    \relates  #boost::math::basis_unit
+
+    \param[in] dividend  The value to be divided.
+
+    \returns  `dividend / e_K`, with components moved and negated.
+ */
+template < typename T, std::size_t S, std::size_t K, std::size_t R >
+inline
+auto  operator /( complex_it<T, S> const &dividend, basis_unit<K, R> )
+ -> complex_it<T, detail::unit_product_rank(R, S)>
+{
+    constexpr std::size_t  q = detail::unit_product_rank( R, S );
+
+    complex_it<T, q>  quotient;
+
+    detail::unit_product<false, (K > 0u), K, q, S>( quotient, dividend,
+     detail::make_index_list<(1ULL << q)>{} );
+    return quotient;
+}
+
+/** \overload
+    \relates  #boost::math::basis_unit
+ */
+template < typename T, std::size_t S, std::size_t K, std::size_t R >
+inline
+auto  operator *( complex_rt<T, S> const &multiplicand, basis_unit<K, R> )
+ -> complex_rt<T, detail::unit_product_rank(R, S)>
+{
+    constexpr std::size_t  q = detail::unit_product_rank( R, S );
+
+    complex_rt<T, q>  product;
+
+    detail::unit_product<false, false, K, q, S>( product, multiplicand,
+     detail::make_index_list<(1ULL << q)>{} );
+    return product;
+}
+
+/** \overload
+    \relates  #boost::math::basis_unit
+ */
+template < std::size_t K, std::size_t R, typename T, std::size_t S >
+inline
+auto  operator *( basis_unit<K, R>, complex_rt<T, S> const &multiplier )
+ -> complex_rt<T, detail::unit_product_rank(R, S)>
+{
+    constexpr std::size_t  q = detail::unit_product_rank( R, S );
+
+    complex_rt<T, q>  product;
+
+    detail::unit_product<true, false, K, q, S>( product, multiplier,
+     detail::make_index_list<(1ULL << q)>{} );
+    return product;
+}
+
+/** \overload
+    \relates  #boost::math::basis_unit
+ */
+template < typename T, std::size_t S, std::size_t K, std::size_t R >
+inline
+auto  operator /( complex_rt<T, S> const &dividend, basis_unit<K, R> )
+ -> complex_rt<T, detail::unit_product_rank(R, S)>
+{
+    constexpr std::size_t  q = detail::unit_product_rank( R, S );
+
+    complex_rt<T, q>  quotient;
+
+    detail::unit_product<false, (K > 0u), K, q, S>( quotient, dividend,
+     detail::make_index_list<(1ULL << q)>{} );
+    return quotient;
+}
+
+
+}  // namespace math
+}  // namespace boost
+
+
+#endif // BOOST_MATH_COMPLEX_UNIT_HPP
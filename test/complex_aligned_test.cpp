@@ -0,0 +1,92 @@
+//  Boost Complex Numbers, over-aligned storage unit test program file  ------//
+
+//  Copyright 2013 Daryle Walker.
+//  Distributed under the Boost Software License, Version 1.0.  (See the
+//  accompanying file LICENSE_1_0.txt or a copy at
+//  <http://www.boost.org/LICENSE_1_0.txt>.)
+
+//  See <http://www.boost.org/libs/math/> for the library's home page.
+
+#include <boost/test/unit_test.hpp>
+
+#include "boost/math/complex_aligned.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+
+// Common definitions  -------------------------------------------------------//
+
+namespace {
+
+    // Save time writing out long types
+    using boost::math::complex_it;
+    using boost::math::complex_rt;
+    using boost::math::aligned_complex_it;
+
+}
+
+
+BOOST_AUTO_TEST_SUITE( complex_aligned_tests )
+
+// Sizes and alignments
+BOOST_AUTO_TEST_CASE( test_aligned_layout )
+{
+    using boost::math::is_packed;
+
+    BOOST_CHECK_EQUAL( alignof(aligned_complex_it<float, 2>), 16u );
+    BOOST_CHECK_EQUAL( alignof(aligned_complex_it<double, 2>), 32u );
+    BOOST_CHECK_EQUAL( alignof(aligned_complex_it<double, 3>), 64u );
+    BOOST_CHECK_EQUAL( (aligned_complex_it<float, 1>::alignment), 8u );
+    BOOST_CHECK_EQUAL( sizeof(aligned_complex_it<double, 2>), 32u );
+    BOOST_CHECK( (is_packed<aligned_complex_it<float, 3>>::value) );
+
+    // Explicit alignments past the size add tail padding.
+    BOOST_CHECK_EQUAL( (sizeof( aligned_complex_it<float, 1, 32> )), 32u );
+    BOOST_CHECK( not (is_packed<aligned_complex_it<float, 1, 32>>::value) );
+
+    aligned_complex_it<double, 2>  q[ 3 ];
+
+    BOOST_CHECK_EQUAL( reinterpret_cast<std::uintptr_t>(&q[1]) % 32u, 0u );
+}
+
+// Interoperation with complex_it operators and conversions
+BOOST_AUTO_TEST_CASE( test_aligned_operations )
+{
+    typedef aligned_complex_it<double, 2>  aligned_type;
+    typedef complex_it<double, 2>          quaternion_type;
+
+    aligned_type           a{ 1., 2., 3., 4. }, b = quaternion_type{ 0., 1. };
+    quaternion_type const  c = a;
+
+    BOOST_CHECK_EQUAL( c, (quaternion_type{ 1., 2., 3., 4. }) );
+    BOOST_CHECK_EQUAL( a[3], 4. );
+    BOOST_CHECK_EQUAL( a * b, c * quaternion_type(b) );
+    a = a + b;
+    BOOST_CHECK_EQUAL( a[1], 3. );
+    a *= b;
+    BOOST_CHECK_EQUAL( a, ((c + quaternion_type{ 0., 1. }) * quaternion_type{
+     0., 1. }) );
+    BOOST_CHECK_EQUAL( norm(b), 1. );
+
+    aligned_type const  d( complex_rt<double, 2>{ 5., 6. } );
+
+    BOOST_CHECK_EQUAL( d[1], 6. );
+    BOOST_CHECK_EQUAL( (complex_rt<double, 2>( d )), (complex_rt<double, 2>{ 5.,
+     6. }) );
+
+    // Batches over aligned arrays
+    aligned_type  x[ 4 ], y[ 4 ], z[ 4 ];
+
+    for ( int i = 0 ; i < 4 ; ++i )
+    {
+        x[ i ] = quaternion_type{ double(i), 1., -1., double(2 * i) };
+        y[ i ] = quaternion_type{ 2., double(-i), 0.5, 1. };
+    }
+    BOOST_CHECK( boost::math::batch_multiply(x, x + 4, y, z) == z + 4 );
+    for ( int i = 0 ; i < 4 ; ++i )
+        BOOST_CHECK_EQUAL( quaternion_type(z[i]), quaternion_type(x[i]) *
+         quaternion_type(y[i]) );
+}
+
+BOOST_AUTO_TEST_SUITE_END()  // complex_aligned_tests
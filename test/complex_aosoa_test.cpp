@@ -0,0 +1,150 @@
+//  Boost Complex Numbers, blocked structure-of-arrays unit test file  -------//
+
+//  Copyright 2013 Daryle Walker.
+//  Distributed under the Boost Software License, Version 1.0.  (See the
+//  accompanying file LICENSE_1_0.txt or a copy at
+//  <http://www.boost.org/LICENSE_1_0.txt>.)
+
+//  See <http://www.boost.org/libs/math/> for the library's home page.
+
+#include <boost/test/unit_test.hpp>
+
+#include "boost/math/complex_aosoa.hpp"
+
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+
+// Common definitions  -------------------------------------------------------//
+
+namespace {
+
+    // Save time writing out long types
+    using boost::math::complex_it;
+    using boost::math::complex_rt;
+    using boost::math::complex_aosoa_vector;
+
+}
+
+
+BOOST_AUTO_TEST_SUITE( complex_aosoa_tests )
+
+// Element and block access, and container sizing
+BOOST_AUTO_TEST_CASE( test_aosoa_access )
+{
+    typedef complex_aosoa_vector<float, 2>  aosoa_type;
+    typedef aosoa_type::element_type        quaternion_type;
+
+    BOOST_CHECK_EQUAL( aosoa_type::static_size, 4u );
+    BOOST_CHECK_EQUAL( aosoa_type::width, 8u );
+
+    aosoa_type  s;
+
+    BOOST_CHECK( s.empty() );
+    for ( int i = 0 ; i < 10 ; ++i )
+        s.push_back( quaternion_type{float(i), 1.0f, float(-i), 2.0f} );
+    s.push_back( complex_rt<float, 2>{0.5f, 0.0f, 0.0f, -0.5f} );
+    BOOST_CHECK_EQUAL( s.size(), 11u );
+    BOOST_CHECK_EQUAL( s.block_count(), 2u );
+    BOOST_CHECK_EQUAL( s.block_end() - s.block_begin(), 2 );
+    BOOST_CHECK_EQUAL( s.block_begin()[1].c[2][1], -9.0f );
+    BOOST_CHECK_EQUAL( s.block_begin()[1].c[3][2], -0.5f );
+    BOOST_CHECK_EQUAL( s.block_begin()[1].c[0][3], 0.0f );  // unused
+
+    quaternion_type const  a = s[ 9 ];
+    complex_rt<float, 2>   b = s[ 10 ];
+
+    BOOST_CHECK_EQUAL( a, (quaternion_type{ 9.0f, 1.0f, -9.0f, 2.0f }) );
+    BOOST_CHECK_EQUAL( b[0], 0.5f );
+
+    s[ 0 ] = s[ 9 ];
+    s[ 1 ][ 3 ] = 7.0f;
+    s.begin()[ 2 ] = complex_rt<float, 2>{};
+    BOOST_CHECK_EQUAL( s.cbegin()[0], a );
+    BOOST_CHECK_EQUAL( s.block_begin()->c[3][1], 7.0f );
+    BOOST_CHECK_EQUAL( quaternion_type(s[2]), quaternion_type{} );
+
+    // Iteration by element
+    aosoa_type::const_iterator  i = s.begin();
+
+    BOOST_CHECK_EQUAL( std::distance(i, s.cend()), 11 );
+    BOOST_CHECK( i + 11 == s.end() );
+    BOOST_CHECK( s.end() - 1 > i );
+    BOOST_CHECK_EQUAL( *(i + 9), a );
+    BOOST_CHECK_EQUAL( std::vector<quaternion_type>(s.cbegin(), s.cend())[3],
+     (quaternion_type{ 3.0f, 1.0f, -3.0f, 2.0f }) );
+
+    // Shrinking clears the dropped members of the last block.
+    s.resize( 9u );
+    s.resize( 12u );
+    BOOST_CHECK_EQUAL( quaternion_type(s[10]), quaternion_type{} );
+
+    aosoa_type  t{ a };
+
+    swap( s, t );
+    BOOST_CHECK_EQUAL( s.size(), 1u );
+    t.clear();
+    BOOST_CHECK( t.empty() );
+}
+
+// The batch functions take the element iterators, block-wise when aligned.
+BOOST_AUTO_TEST_CASE( test_aosoa_batch )
+{
+    using boost::math::batch_add;
+    using boost::math::batch_subtract;
+    using boost::math::batch_multiply;
+    using boost::math::batch_divide;
+    using boost::math::batch_norm;
+    using boost::math::batch_fma;
+
+    typedef complex_aosoa_vector<float, 3, 16>  aosoa_type;
+    typedef aosoa_type::element_type            octonion_type;
+
+    std::vector<octonion_type>  x, y;
+
+    for ( int i = 0 ; i < 37 ; ++i )
+    {
+        x.push_back( {float(i % 7 - 3), 2.0f, float(i % 5), -1.0f, 0.5f,
+         float(i % 3), 1.0f, 0.0f} );
+        y.push_back( {float(1 + i % 4), -2.0f, 0.0f, float(i % 6), 3.0f, 1.0f,
+         -1.0f, float(i % 2)} );
+    }
+
+    aosoa_type const  a( x.begin(), x.end() ), b( y.begin(), y.end() );
+    aosoa_type        sum( 37u ), difference( 37u ), product( 37u ),
+                      quotient( 37u ), shifted( 37u ), fused = a;
+
+    BOOST_CHECK( batch_add(a.begin(), a.end(), b.begin(), sum.begin()) ==
+     sum.end() );
+    batch_subtract( a.begin(), a.end(), b.begin(), difference.begin() );
+    batch_multiply( a.begin(), a.end(), b.begin(), product.begin() );
+    batch_divide( a.begin(), a.end(), b.begin(), quotient.begin() );
+    batch_fma( a.begin(), a.end(), b.begin(), fused.begin() );
+
+    // Not starting on a block boundary
+    batch_multiply( a.begin() + 1, a.end(), b.begin(), shifted.begin() );
+
+    std::vector<float>  norms;
+
+    batch_norm( product.begin(), product.end(), std::back_inserter(norms) );
+    for ( std::size_t i = 0u ; i < x.size() ; ++i )
+    {
+        BOOST_CHECK_EQUAL( octonion_type(sum[i]), x[i] + y[i] );
+        BOOST_CHECK_EQUAL( octonion_type(difference[i]), x[i] - y[i] );
+        BOOST_CHECK_EQUAL( octonion_type(product[i]), x[i] * y[i] );
+        BOOST_CHECK_EQUAL( octonion_type(quotient[i]), x[i] / y[i] );
+        BOOST_CHECK_EQUAL( octonion_type(fused[i]), x[i] + x[i] * y[i] );
+        BOOST_CHECK_EQUAL( norms[i], norm(x[i] * y[i]) );
+    }
+    for ( std::size_t i = 0u ; i + 1u < x.size() ; ++i )
+        BOOST_CHECK_EQUAL( octonion_type(shifted[i]), x[i + 1u] * y[i] );
+
+    // In place, through mutable iterators
+    batch_multiply( product.begin(), product.end(), b.begin(), product.begin()
+     );
+    for ( std::size_t i = 0u ; i < x.size() ; ++i )
+        BOOST_CHECK_EQUAL( octonion_type(product[i]), (x[i] * y[i]) * y[i] );
+}
+
+BOOST_AUTO_TEST_SUITE_END()  // complex_aosoa_tests
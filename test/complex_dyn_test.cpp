@@ -0,0 +1,277 @@
+//  Boost Complex Numbers, runtime-rank unit test program file  --------------//
+
+//  Copyright 2013 Daryle Walker.
+//  Distributed under the Boost Software License, Version 1.0.  (See the
+//  accompanying file LICENSE_1_0.txt or a copy at
+//  <http://www.boost.org/LICENSE_1_0.txt>.)
+
+//  See <http://www.boost.org/libs/math/> for the library's home page.
+
+#include <boost/test/unit_test.hpp>
+
+#include "boost/math/complex_dyn.hpp"
+
+#include <cstddef>
+#include <random>
+#include <sstream>
+#include <vector>
+
+
+// Common definitions  -------------------------------------------------------//
+
+namespace {
+
+    // Save time writing out long types
+    using boost::math::arena_allocator;
+    using boost::math::complex_arena;
+    using boost::math::complex_dyn;
+    using boost::math::complex_it;
+    using boost::math::complex_rt;
+
+    typedef complex_dyn<int>     dyn_type;
+    typedef complex_it<int, 3>   dense_type;
+    typedef complex_rt<int, 3>   nested_type;
+
+    // Random values, with integer components so products are exact
+    auto  random_dense( std::mt19937 &engine ) -> dense_type
+    {
+        std::uniform_int_distribution<int>  d( -9, 9 );
+        dense_type                          result;
+
+        for ( auto &x : result )
+            x = d( engine );
+        return result;
+    }
+
+}
+
+
+// Unit tests for runtime-rank hypercomplex numbers  -------------------------//
+
+BOOST_AUTO_TEST_SUITE( complex_dyn_tests )
+
+BOOST_AUTO_TEST_CASE( test_dyn_basics )
+{
+    dyn_type const  a, b( 2u ), c( 2u, {1, 2, 3} );
+
+    BOOST_CHECK_EQUAL( a.rank(), 0u );
+    BOOST_CHECK_EQUAL( a.size(), 1u );
+    BOOST_CHECK( not a );
+    BOOST_CHECK_EQUAL( b.rank(), 2u );
+    BOOST_CHECK_EQUAL( b.size(), 4u );
+    BOOST_CHECK( a == b );
+    BOOST_CHECK( b == 0 );
+    BOOST_CHECK( c );
+    BOOST_CHECK_EQUAL( c[2], 3 );
+    BOOST_CHECK_EQUAL( c[3], 0 );
+    BOOST_CHECK_EQUAL( c.real(), 1 );
+    BOOST_CHECK_EQUAL( c.imag(), 2 );
+    BOOST_CHECK_EQUAL( real(c), 1 );
+    BOOST_CHECK_EQUAL( imag(c), 2 );
+    BOOST_CHECK( unreal(c) == dyn_type(2u, {0, 2, 3}) );
+
+    // Copying and moving, with rank changes
+    dyn_type  d = c, e;
+
+    BOOST_CHECK( d == c );
+    d[ 3 ] = 4;
+    BOOST_CHECK( d != c );
+    e = d;
+    BOOST_CHECK_EQUAL( e.rank(), 2u );
+    BOOST_CHECK( e == d );
+    e = dyn_type( 1u, {5, 6} );
+    BOOST_CHECK_EQUAL( e.rank(), 1u );
+    BOOST_CHECK_EQUAL( e[1], 6 );
+    swap( d, e );
+    BOOST_CHECK_EQUAL( d.rank(), 1u );
+    BOOST_CHECK_EQUAL( e[3], 4 );
+
+    // Conversions
+    dense_type const  f{ 1, -2, 3, -4, 5, -6, 7, -8 };
+    dyn_type const    g{ f }, h{ nested_type(f) };
+
+    BOOST_CHECK_EQUAL( g.rank(), 3u );
+    BOOST_CHECK( g == h );
+    BOOST_CHECK( static_cast<dense_type>(g) == f );
+    BOOST_CHECK( static_cast<nested_type>(h) == nested_type(f) );
+    BOOST_CHECK( static_cast<dense_type>(c) == (complex_it<int, 2>{ 1, 2, 3, 0
+     }) );
+
+    // Output
+    std::ostringstream  ss1, ss2;
+
+    ss1 << g << ' ' << a;
+    ss2 << f << ' ' << 0;
+    BOOST_CHECK_EQUAL( ss1.str(), ss2.str() );
+}
+
+BOOST_AUTO_TEST_CASE( test_dyn_moved_from )
+{
+    dyn_type  a( 2u, {1, 2, 3, 4} ), b( std::move(a) );
+
+    // The source is left a usable zero of rank 0
+    BOOST_CHECK_EQUAL( b.rank(), 2u );
+    BOOST_CHECK_EQUAL( b[3], 4 );
+    BOOST_CHECK_EQUAL( a.rank(), 0u );
+    BOOST_CHECK_EQUAL( a.size(), 1u );
+    BOOST_CHECK_EQUAL( a.end() - a.begin(), 1 );
+    BOOST_CHECK( not a );
+    BOOST_CHECK( a == 0 );
+    BOOST_CHECK_EQUAL( a.real(), 0 );
+    BOOST_CHECK_EQUAL( a.imag(), 0 );
+    BOOST_CHECK( a + b == b );
+    BOOST_CHECK( not (a * b) );
+
+    std::ostringstream  ss;
+
+    ss << a;
+    BOOST_CHECK_EQUAL( ss.str(), "0" );
+
+    // It can be written, and its value moves on with it
+    a[ 0 ] = 7;
+    BOOST_CHECK( a * b == 7 * b );
+
+    dyn_type  c( std::move(a) );
+
+    BOOST_CHECK( c == 7 );
+    BOOST_CHECK( a == 0 );
+    a.real( 5 );
+
+    // Swapping and assignment, both ways between inline and allocated
+    swap( a, b );
+    BOOST_CHECK_EQUAL( a.rank(), 2u );
+    BOOST_CHECK_EQUAL( a[1], 2 );
+    BOOST_CHECK( b == 5 );
+    b = a;
+    BOOST_CHECK( b == a );
+    b = std::move( c );
+    BOOST_CHECK( b == 7 );
+    c = dyn_type( 1u, {8, 9} );
+    BOOST_CHECK_EQUAL( c[1], 9 );
+
+    dyn_type  d( std::move(b) );
+
+    d = std::move( c );
+    BOOST_CHECK_EQUAL( d.rank(), 1u );
+    BOOST_CHECK( c == 7 );
+    BOOST_CHECK( b == 0 );
+}
+
+BOOST_AUTO_TEST_CASE( test_dyn_basis_sign )
+{
+    // The looping sign walk matches the recursive one
+    for ( std::size_t i = 0u ; i < 64u ; ++i )
+        for ( std::size_t j = 0u ; j < 64u ; ++j )
+            BOOST_REQUIRE_EQUAL( boost::math::detail::dyn_basis_sign(6u, i, j),
+             boost::math::detail::basis_product_sign(6u, i, j) );
+}
+
+BOOST_AUTO_TEST_CASE( test_dyn_arithmetic )
+{
+    std::mt19937  engine( 20131u );
+
+    // Compare with the fixed-rank type
+    for ( int trial = 0 ; trial < 50 ; ++trial )
+    {
+        auto const      da = random_dense( engine );
+        auto const      db = random_dense( engine );
+        dyn_type const  a{ da }, b{ db };
+
+        BOOST_CHECK( static_cast<dense_type>(a + b) == da + db );
+        BOOST_CHECK( static_cast<dense_type>(a - b) == da - db );
+        BOOST_CHECK( static_cast<dense_type>(a * b) == da * db );
+        BOOST_CHECK( static_cast<dense_type>(-a) == -da );
+        BOOST_CHECK( static_cast<dense_type>(conj( a )) == dense_type(conj( da
+         )) );
+        BOOST_CHECK( static_cast<dense_type>(a * 3) == da * 3 );
+        BOOST_CHECK( static_cast<dense_type>(2 - a) == 2 - da );
+        BOOST_CHECK_EQUAL( norm(a), norm(da) );
+        if ( b )
+            BOOST_CHECK( static_cast<dense_type>(a * 50 / b) == da * 50 / db );
+    }
+
+    // Mixed ranks pad the lower-ranked value with zeros
+    complex_it<int, 1> const  c{ 3, -4 };
+    dense_type const          d{ 1, 2, 3, 4, 5, 6, 7, 8 };
+    dyn_type                  e{ c };
+
+    BOOST_CHECK( static_cast<dense_type>(e * dyn_type( d )) == c * d );
+    BOOST_CHECK( static_cast<dense_type>(dyn_type( d ) - e) == d - c );
+    e += dyn_type( d );
+    BOOST_CHECK_EQUAL( e.rank(), 3u );
+    BOOST_CHECK( static_cast<dense_type>(e) == c + d );
+    BOOST_CHECK_EQUAL( abs(dyn_type( c )), 5 );
+
+    // High ranks, where basis units square to -1
+    typedef complex_dyn<double>  real_dyn;
+
+    for ( std::size_t i = 1u ; i < 1024u ; i += 101u )
+    {
+        real_dyn  u( 10u );
+
+        u[ i ] = 1.0;
+        BOOST_CHECK( u * u == -1.0 );
+        BOOST_CHECK( u / u == 1.0 );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( test_dyn_division_range )
+{
+    typedef complex_dyn<double>     real_dyn;
+    typedef complex_it<double, 2>  quaternion_type;
+
+    // The product and the norm overflow, or underflow, before the division
+    for ( double const s : {1e200, 1e-200, 1e160, 1e300} )
+    {
+        quaternion_type const  a{ s, s }, b{ s, -s };
+        real_dyn const         c{ a }, d{ b };
+        real_dyn const         q = c / d;
+
+        BOOST_CHECK( q == real_dyn(quaternion_type{ 0., 1. }) );
+        BOOST_CHECK( static_cast<quaternion_type>(q) == a / b );
+    }
+
+    // Mixed ranks take the fallback too
+    real_dyn const  e( 1u, {1e200, 1e200} ), f( 3u, {1e200} );
+
+    BOOST_CHECK( e / f == real_dyn(3u, {1., 1.}) );
+}
+
+BOOST_AUTO_TEST_CASE( test_dyn_arena )
+{
+    typedef arena_allocator<double>             allocator_type;
+    typedef complex_dyn<double, allocator_type>  arena_dyn;
+
+    complex_arena           arena1( 1024u ), arena2;
+    allocator_type const    a1( arena1 ), a2( arena2 );
+    std::vector<arena_dyn>  values;
+
+    BOOST_CHECK( a1 != a2 );
+    BOOST_CHECK( a1 == arena_allocator<int>(a1) );
+
+    // Values, including results, draw from the arena of their allocator
+    for ( std::size_t r = 0u ; r < 6u ; ++r )
+    {
+        arena_dyn  x( r, a1 );
+
+        x[ 0 ] = 2.0;
+        x[ x.size() - 1u ] = 1.0;
+        values.push_back( x * x + x );
+        BOOST_CHECK( values.back().get_allocator() == a1 );
+    }
+    BOOST_CHECK_EQUAL( values[0][0], 2.0 );
+    BOOST_CHECK_EQUAL( values[5][0], 5.0 );
+    BOOST_CHECK_EQUAL( values[5][31], 5.0 );
+
+    // Crossing arenas copies
+    arena_dyn  y( a2 );
+
+    y = values[ 4 ];
+    BOOST_CHECK( y.get_allocator() == a2 );
+    BOOST_CHECK( y == values[4] );
+    y = std::move( values[3] );
+    BOOST_CHECK( y.get_allocator() == a2 );
+    BOOST_CHECK_EQUAL( y.rank(), 3u );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,178 @@
+//  Boost Complex Numbers, half-width storage unit test program file  --------//
+
+//  Copyright 2013 Daryle Walker.
+//  Distributed under the Boost Software License, Version 1.0.  (See the
+//  accompanying file LICENSE_1_0.txt or a copy at
+//  <http://www.boost.org/LICENSE_1_0.txt>.)
+
+//  See <http://www.boost.org/libs/math/> for the library's home page.
+
+#include <boost/test/unit_test.hpp>
+
+#include "boost/math/complex_half.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+
+// Common definitions  -------------------------------------------------------//
+
+namespace {
+
+    // Save time writing out long types
+    using boost::math::complex_it;
+    using boost::math::complex_rt;
+    using boost::math::complex_half_vector;
+    using boost::math::binary16_format;
+    using boost::math::bfloat16_format;
+
+}
+
+
+BOOST_AUTO_TEST_SUITE( complex_half_tests )
+
+// Rounding of single components
+BOOST_AUTO_TEST_CASE( test_half_conversion )
+{
+    float const  inf = std::numeric_limits<float>::infinity();
+
+    // binary16
+    BOOST_CHECK_EQUAL( binary16_format::narrow(1.0f), 0x3C00u );
+    BOOST_CHECK_EQUAL( binary16_format::narrow(-2.0f), 0xC000u );
+    BOOST_CHECK_EQUAL( binary16_format::narrow(65504.0f), 0x7BFFu );
+    BOOST_CHECK_EQUAL( binary16_format::narrow(65519.0f), 0x7BFFu );
+    BOOST_CHECK_EQUAL( binary16_format::narrow(65520.0f), 0x7C00u );
+    BOOST_CHECK_EQUAL( binary16_format::narrow(-inf), 0xFC00u );
+    BOOST_CHECK_EQUAL( binary16_format::narrow(1.0f + 1.0f / 2048), 0x3C00u );
+    BOOST_CHECK_EQUAL( binary16_format::narrow(1.0f + 3.0f / 2048), 0x3C02u );
+    BOOST_CHECK_EQUAL( binary16_format::narrow(std::ldexp( 1.0f, -24 )), 1u );
+    BOOST_CHECK_EQUAL( binary16_format::narrow(std::ldexp( 1.0f, -25 )), 0u );
+    BOOST_CHECK_EQUAL( binary16_format::narrow(std::ldexp( 3.0f, -26 )), 1u );
+    BOOST_CHECK_EQUAL( binary16_format::narrow(std::ldexp( 1023.5f, -24 )),
+     0x400u );
+    BOOST_CHECK_EQUAL( binary16_format::widen(0x3555u), 0.333251953125f );
+    BOOST_CHECK_EQUAL( binary16_format::widen(0x8001u), -std::ldexp(1.0f, -24)
+     );
+    BOOST_CHECK( std::isnan(binary16_format::widen( binary16_format::narrow(
+     std::numeric_limits<float>::quiet_NaN()) )) );
+
+    // Every binary16 value survives the round trip.
+    for ( std::uint32_t h = 0u ; h < 0x10000u ; ++h )
+        if ( (h & 0x7C00u) != 0x7C00u || !(h & 0x3FFu) )
+            BOOST_REQUIRE_EQUAL( binary16_format::narrow(binary16_format::widen(
+             h )), h );
+
+    // bfloat16
+    BOOST_CHECK_EQUAL( bfloat16_format::narrow(1.0f), 0x3F80u );
+    BOOST_CHECK_EQUAL( bfloat16_format::narrow(1.0f + 1.0f / 256), 0x3F80u );
+    BOOST_CHECK_EQUAL( bfloat16_format::narrow(1.0f + 3.0f / 256), 0x3F82u );
+    BOOST_CHECK_EQUAL( bfloat16_format::narrow(inf), 0x7F80u );
+    BOOST_CHECK_EQUAL( bfloat16_format::widen(0xC040u), -3.0f );
+    BOOST_CHECK( std::isnan(bfloat16_format::widen( bfloat16_format::narrow(
+     std::numeric_limits<float>::quiet_NaN()) )) );
+}
+
+// Bulk conversions match the single-component ones.
+BOOST_AUTO_TEST_CASE( test_half_bulk_conversion )
+{
+    using boost::math::widen_components;
+    using boost::math::narrow_components;
+
+    std::vector<std::uint16_t>  h;
+
+    for ( std::uint32_t i = 0u ; i < 0x10000u ; ++i )
+        if ( (i & 0x7C00u) != 0x7C00u || !(i & 0x3FFu) )
+            h.push_back( i );
+
+    std::vector<float>          f( h.size() );
+    std::vector<std::uint16_t>  g( h.size() );
+
+    BOOST_CHECK( widen_components<binary16_format>(h.data(), h.data() +
+     h.size(), f.data()) == f.data() + f.size() );
+    narrow_components<binary16_format>( f.data(), f.data() + f.size(),
+     g.data() );
+    for ( std::size_t i = 0u ; i < h.size() ; ++i )
+    {
+        BOOST_REQUIRE_EQUAL( f[i], binary16_format::widen(h[i]) );
+        BOOST_REQUIRE_EQUAL( g[i], h[i] );
+    }
+
+    // bfloat16 narrowing of normal values, with ties
+    std::vector<float>  x;
+
+    for ( int i = 0 ; i < 1000 ; ++i )
+        x.push_back( std::ldexp(1.0f + i / 512.0f, i % 40 - 20) * (i % 3 ? 1 :
+         -1) );
+    g.resize( x.size() );
+    narrow_components<bfloat16_format>( x.data(), x.data() + x.size(),
+     g.data() );
+    for ( std::size_t i = 0u ; i < x.size() ; ++i )
+        BOOST_REQUIRE_EQUAL( g[i], bfloat16_format::narrow(x[i]) );
+}
+
+// Element access and whole-sequence operations
+BOOST_AUTO_TEST_CASE( test_half_sequence )
+{
+    typedef complex_half_vector<2>                   half_type;
+    typedef half_type::element_type                  quaternion_type;
+    typedef complex_half_vector<2, bfloat16_format>  brain_type;
+
+    std::vector<quaternion_type>  x, y;
+
+    for ( int i = 0 ; i < 700 ; ++i )
+    {
+        x.push_back( {float(i % 7 - 3) / 4, 2.0f, float(i % 5), -1.0f} );
+        y.push_back( {float(1 + i % 4), -0.5f, float(i % 6) / 8, 3.0f} );
+    }
+
+    half_type  a( x.data(), x.data() + x.size() ), b( y.begin(), y.end() );
+
+    BOOST_CHECK_EQUAL( a.size(), 700u );
+    BOOST_CHECK_EQUAL( a.data()[1], 0x4000u );
+    BOOST_CHECK_EQUAL( static_cast<half_type const &>(a)[3], x[3] );
+
+    half_type const  sum = a + b, difference = a - b, product = a * b;
+
+    std::vector<float> const      norms = norm( b );
+    std::vector<quaternion_type>  z( 700 );
+
+    for ( std::size_t i = 0u ; i < x.size() ; ++i )
+        z[ i ] = x[ i ] * y[ i ];
+
+    half_type const  expected( z.data(), z.data() + z.size() );
+
+    for ( std::size_t i = 0u ; i < x.size() ; ++i )
+    {
+        BOOST_CHECK_EQUAL( sum[i], x[i] + y[i] );
+        BOOST_CHECK_EQUAL( difference[i], x[i] - y[i] );
+        BOOST_CHECK_EQUAL( product[i], expected[i] );
+        BOOST_CHECK_EQUAL( norms[i], norm(y[i]) );
+    }
+
+    // Proxies narrow on assignment.
+    a[ 0 ] = quaternion_type{ 1.0f + 1.0f / 4096, -65536.0f };
+    a[ 1 ] = complex_rt<float, 2>{ 0.0f, 0.0f, 0.0f, 0.25f };
+    a[ 2 ] = a[ 1 ];
+    BOOST_CHECK_EQUAL( quaternion_type(a[0]), (quaternion_type{ 1.0f,
+     -std::numeric_limits<float>::infinity() }) );
+    BOOST_CHECK_EQUAL( a[2][3], 0x3400u );
+
+    std::vector<quaternion_type>  w( 2 );
+
+    a.load( 1u, 2u, w.data() );
+    BOOST_CHECK_EQUAL( w[1], (quaternion_type{ 0.0f, 0.0f, 0.0f, 0.25f }) );
+
+    // bfloat16 keeps the range, not the precision.
+    brain_type const  c{ {1.0e30f, 3.0f}, {1.0f + 1.0f / 512} };
+
+    BOOST_CHECK_CLOSE( c[0][0], 1.0e30f, 0.5f );
+    BOOST_CHECK_EQUAL( c[1][0], 1.0f );
+    swap( a, b );
+    BOOST_CHECK_EQUAL( quaternion_type(b[1]), (quaternion_type{ 0.0f, 0.0f,
+     0.0f, 0.25f }) );
+}
+
+BOOST_AUTO_TEST_SUITE_END()  // complex_half_tests
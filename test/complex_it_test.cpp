@@ -17,6 +17,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <ios>
+#include <limits>
 #include <tuple>
 #include <type_traits>
 
@@ -42,11 +43,31 @@ namespace {
     typedef list<double, my_float>                      test_floating_types;
     typedef list<int, unsigned, double>                  test_builtin_types;
     typedef list<int, std::intmax_t, mp::int512_t>        test_signed_types;
+    typedef mp::number<mp::cpp_dec_float<25>, mp::et_off>     reduced_float;
+    typedef list<mp::int256_t, reduced_float>            test_reduced_types;
 
 }
 
 // Flag un-printable types here.
 
+// Flag types using the reduced-multiplication Cayley products here.
+namespace boost
+{
+namespace math
+{
+    template < >
+    struct use_reduced_multiplication< mp::int256_t >
+        : std::true_type
+    { };
+
+    template < >
+    struct use_reduced_multiplication< reduced_float >
+        : std::true_type
+    { };
+
+}  // namespace math
+}  // namespace boost
+
 
 BOOST_AUTO_TEST_SUITE( complex_it_tests )
 
@@ -899,6 +920,164 @@ BOOST_AUTO_TEST_CASE_TEMPLATE( test_conj, T, test_types )
     BOOST_CHECK_EQUAL( ee[3], -T(19) );
 }
 
+// Check that a conjugate works wherever a value does.
+BOOST_AUTO_TEST_CASE_TEMPLATE( test_conj_expressions, T, test_floating_types )
+{
+    using boost::math::real;
+    using std::abs;
+
+    complex_it<T, 1> const  a = { T(3), T(4) }, b = { T(1), T(-2) };
+    complex_it<T, 1> const  ca = ~a;
+
+    BOOST_REQUIRE( (std::is_same<decltype(conj( a )), complex_it<T, 1>>::value)
+     );
+    BOOST_CHECK_EQUAL( conj(a) + b, ca + b );
+    BOOST_CHECK( conj(a) == ca );
+    BOOST_CHECK_EQUAL( real(conj( a )), T(3) );
+    BOOST_CHECK_CLOSE( abs(conj( a )), T(5), 0.0001 );
+    BOOST_CHECK_EQUAL( -conj(a), -ca );
+    BOOST_CHECK_EQUAL( conj(a) * T(2), ca * T(2) );
+    BOOST_CHECK_EQUAL( T(2) * conj(a), T(2) * ca );
+    BOOST_CHECK_EQUAL( conj(a).imag(), T(-4) );
+    BOOST_CHECK_EQUAL( *begin(conj( a )), T(3) );
+    BOOST_CHECK_EQUAL( conj(a) / b, ca / b );
+    BOOST_CHECK_EQUAL( b / conj(a), b / ca );
+
+    boost::test_tools::output_test_stream  output;
+
+    output << conj( a );
+    BOOST_CHECK( output.is_equal("(3,-4)") );
+}
+
+// Check the deferred conjugate expression.
+BOOST_AUTO_TEST_CASE_TEMPLATE( test_conjugate_expression, T, test_signed_types )
+{
+    using boost::math::conjugate_expression;
+    using boost::math::fma_assign;
+    using boost::math::lazy_conj;
+    using std::is_same;
+
+    complex_it<T, 1> const  c = { (T)3, (T)5 };
+    complex_it<T, 2> const  e = { (T)11, (T)13, -(T)17, (T)19 };
+    auto const              ee = lazy_conj( e );
+
+    BOOST_REQUIRE( (is_same<decltype(ee), conjugate_expression<T, 2> const
+     >::value) );
+    BOOST_CHECK_EQUAL( &ee.argument(), &e );
+    BOOST_CHECK_EQUAL( &conj( ee ), &e );
+    BOOST_CHECK_EQUAL( ee[0], T(11) );
+    BOOST_CHECK_EQUAL( ee[1], T(-13) );
+    BOOST_CHECK_EQUAL( ee[2], T(17) );
+    BOOST_CHECK_EQUAL( ee[3], T(-19) );
+
+    // Materialized conjugates give the same results.
+    complex_it<T, 2> const  e_conj = ee, e_copy = ~e;
+
+    BOOST_CHECK_EQUAL( e_conj, e_copy );
+    BOOST_CHECK_EQUAL( conj(complex_it<T, 2>( e )), e_copy );
+    BOOST_CHECK_EQUAL( norm(ee), norm(e) );
+    BOOST_CHECK_EQUAL( ee * c, e_copy * c );
+    BOOST_CHECK_EQUAL( c * ee, c * e_copy );
+    BOOST_CHECK_EQUAL( lazy_conj(c) * ee, ~c * e_copy );
+    BOOST_CHECK_EQUAL( ee * e, norm(e) );
+    BOOST_CHECK_EQUAL( ee / T(2), e_copy / T(2) );
+    BOOST_CHECK_EQUAL( ee / c, e_copy / c );
+    BOOST_CHECK_EQUAL( c / ee, c / e_copy );
+    BOOST_CHECK_EQUAL( ee / lazy_conj(c), e_copy / ~c );
+
+    complex_it<T, 2>  x = e;
+
+    x *= lazy_conj( c );
+    BOOST_CHECK_EQUAL( x, e * ~c );
+    x = e;
+    x *= lazy_conj( x );
+    BOOST_CHECK_EQUAL( x, e * e_copy );
+
+    // Flags and deferred conjugates combine.
+    x = e;
+    BOOST_CHECK_EQUAL( fma_assign(x, ee, c), e + e_copy * c );
+    x = e;
+    BOOST_CHECK_EQUAL( (fma_assign<true, false>( x, ee, c )), e + e * c );
+    x = e;
+    BOOST_CHECK_EQUAL( fma_assign(x, lazy_conj( x ), lazy_conj( c )), e +
+     e_copy * ~c );
+}
+
+// Sum components by recursion over barrage views
+template < typename T >
+T  view_sum( boost::math::const_barrage_view<T, 0> v )  { return v[0]; }
+
+template < typename T, std::size_t R >
+T  view_sum( boost::math::const_barrage_view<T, R> v )
+{ return view_sum( v.lower_view() ) + view_sum( v.upper_view() ); }
+
+// Check zero-copy barrage views, including recursion through them.
+BOOST_AUTO_TEST_CASE_TEMPLATE( test_barrage_views, T, test_signed_types )
+{
+    using boost::math::barrage_view;
+    using boost::math::const_barrage_view;
+    using boost::math::fma_assign;
+    using boost::math::fms_assign;
+
+    complex_it<T, 2> const  e = { (T)2, (T)3, -(T)5, (T)7 };
+    complex_it<T, 1> const  c = { (T)1, -(T)4 };
+    auto const              el = e.lower_view(), eu = e.upper_view();
+
+    BOOST_REQUIRE( (std::is_same<decltype( el ), const_barrage_view<T, 1>
+     const>::value) );
+    BOOST_CHECK_EQUAL( el.data(), &e[0] );
+    BOOST_CHECK_EQUAL( eu.data(), &e[2] );
+    BOOST_CHECK_EQUAL( el.value(), e.lower_barrage() );
+    BOOST_CHECK_EQUAL( eu.value(), e.upper_barrage() );
+    BOOST_CHECK_EQUAL( eu.lower_barrage()[0], -(T)5 );
+    BOOST_CHECK_EQUAL( el.upper_view().upper_view()[0], (T)3 );
+    BOOST_CHECK( el && !(const_barrage_view<T, 1>( complex_it<T, 1>{} )) );
+
+    // Arithmetic reads the viewed components in place.
+    BOOST_CHECK_EQUAL( el + eu, e.lower_barrage() + e.upper_barrage() );
+    BOOST_CHECK_EQUAL( el - c, e.lower_barrage() - c );
+    BOOST_CHECK_EQUAL( c * eu, c * e.upper_barrage() );
+    BOOST_CHECK_EQUAL( el * eu, e.lower_barrage() * e.upper_barrage() );
+    BOOST_CHECK_EQUAL( el * e, e.lower_barrage() * e );
+    BOOST_CHECK_EQUAL( eu * conj(c), e.upper_barrage() * ~c );
+    BOOST_CHECK_EQUAL( -eu, -e.upper_barrage() );
+    BOOST_CHECK_EQUAL( ~eu, ~e.upper_barrage() );
+    BOOST_CHECK_EQUAL( eu * (T)2, e.upper_barrage() * (T)2 );
+    BOOST_CHECK_EQUAL( norm(eu), norm(e.upper_barrage()) );
+    BOOST_CHECK( el == e.lower_barrage() );
+    BOOST_CHECK( el != eu );
+
+    // Writes go through to the viewed object.
+    complex_it<T, 2>        x = e;
+    barrage_view<T, 1> const  xl = x.lower_view(), xu = x.upper_view();
+
+    xl = c;
+    BOOST_CHECK_EQUAL( x, (complex_it<T, 2>{ (T)1, -(T)4, -(T)5, (T)7 }) );
+    xu += c;
+    xl *= (T)3;
+    BOOST_CHECK_EQUAL( x, (complex_it<T, 2>{ (T)3, -(T)12, -(T)4, (T)3 }) );
+    xl = xu;
+    BOOST_CHECK_EQUAL( x, (complex_it<T, 2>{ -(T)4, (T)3, -(T)4, (T)3 }) );
+    x = e;
+    xu *= xl;
+    BOOST_CHECK_EQUAL( x.upper_barrage(), e.upper_barrage() * e.lower_barrage()
+     );
+
+    // Accumulation into a sub-barrage, even one overlapping a factor
+    x = e;
+    fma_assign( x.upper_view(), c, x.lower_view() );
+    BOOST_CHECK_EQUAL( x.upper_barrage(), e.upper_barrage() + c *
+     e.lower_barrage() );
+    x = e;
+    fms_assign<false, true>( x.lower_view(), x.lower_view(), c );
+    BOOST_CHECK_EQUAL( x.lower_barrage(), e.lower_barrage() - e.lower_barrage()
+     * ~c );
+    BOOST_CHECK_EQUAL( x.upper_barrage(), e.upper_barrage() );
+
+    // A divide-and-conquer sum of components, with no copies
+    BOOST_CHECK_EQUAL( view_sum(const_barrage_view<T, 2>( e )), (T)7 );
+}
+
 // Check the real- and imaginary-component member functions.
 BOOST_AUTO_TEST_CASE_TEMPLATE( test_member_real_imag, T, test_types )
 {
@@ -1596,6 +1775,101 @@ BOOST_AUTO_TEST_CASE_TEMPLATE( test_cayley_multiplication,T,test_signed_types )
     BOOST_CHECK_EQUAL( pp, r * h );
 }
 
+// Check the basis multiplication table and the product engine it drives.
+BOOST_AUTO_TEST_CASE_TEMPLATE( test_cayley_table_product, T, test_signed_types )
+{
+    using boost::math::cayley_basis;
+    using boost::math::cayley_table_product;
+
+    // Type-aliases
+    typedef complex_it<T, 0>        real_type;
+    typedef complex_it<T, 1>     complex_type;
+    typedef complex_it<T, 2>  quaternion_type;
+    typedef complex_it<T, 3>    octonion_type;
+
+    // The table itself; i * j == k, j * k == i, k * i == j, etc.
+    static_assert( cayley_basis<2>::index(1, 2) == 3u, "Bad basis index" );
+    static_assert( cayley_basis<2>::sign(1, 2) == +1, "Bad basis sign" );
+    static_assert( cayley_basis<2>::sign(2, 1) == -1, "Bad basis sign" );
+    static_assert( cayley_basis<2>::sign(2, 3) == +1, "Bad basis sign" );
+    static_assert( cayley_basis<2>::sign(3, 1) == +1, "Bad basis sign" );
+    static_assert( cayley_basis<3>::sign(5, 5) == -1, "Bad basis sign" );
+    static_assert( cayley_basis<3>::sign(0, 6) == +1, "Bad basis sign" );
+    BOOST_CHECK_EQUAL( cayley_basis<0>::table[0].index, 0u );
+    BOOST_CHECK_EQUAL( cayley_basis<0>::table[0].sign, +1 );
+    BOOST_CHECK_EQUAL( cayley_basis<1>::table[3].index, 0u );
+    BOOST_CHECK_EQUAL( cayley_basis<1>::table[3].sign, -1 );
+    for ( std::size_t i = 0u ; i < 8u ; ++i )
+        for ( std::size_t j = 0u ; j < 8u ; ++j )
+        {
+            octonion_type  ei{}, ej{}, ek{};
+
+            ei[ i ] = T( 1 );
+            ej[ j ] = T( 1 );
+            ek[ cayley_basis<3>::table[i * 8u + j].index ] = T(
+             cayley_basis<3>::table[i * 8u + j].sign );
+            BOOST_CHECK_EQUAL( ei * ej, ek );
+        }
+
+    // The engine
+    real_type const        a = { T(8) };
+    complex_type const     d = { T(2), T(5) }, e = { T(4), T(-6) };
+    quaternion_type const  h = { T(2), T(13), T(-5), T(17) }, k = { T(11), T(3),
+     T(-7), T(19) };
+    octonion_type const    p = { T(7), T(-2), T(0), T(7), T(-8), T(6), T(1),
+     T(-6) }, q = { T(3), T(3), T(-13), T(-8), T(11), T(12), T(-4), T(-11) };
+
+    BOOST_CHECK_EQUAL( cayley_table_product(a, a), a * a );
+    BOOST_CHECK_EQUAL( cayley_table_product(d, e), d * e );
+    BOOST_CHECK_EQUAL( cayley_table_product(h, k), h * k );
+    BOOST_CHECK_EQUAL( cayley_table_product(k, h), k * h );
+    BOOST_CHECK_EQUAL( cayley_table_product(p, q), p * q );
+    BOOST_CHECK_EQUAL( cayley_table_product(q, p), q * p );
+    BOOST_CHECK_EQUAL( cayley_table_product(a, q), a * q );
+    BOOST_CHECK_EQUAL( cayley_table_product(d, h), d * h );
+    BOOST_CHECK_EQUAL( cayley_table_product(h, d), h * d );
+    BOOST_CHECK_EQUAL( cayley_table_product(e, p), e * p );
+    BOOST_CHECK_EQUAL( cayley_table_product(p, k), p * k );
+}
+
+// Check the reduced-multiplication Cayley products against the regular ones.
+BOOST_AUTO_TEST_CASE_TEMPLATE( test_reduced_multiplication, T,
+ test_reduced_types )
+{
+    using boost::math::use_reduced_multiplication;
+
+    // Type-aliases
+    typedef complex_it<T, 1>            complex_type;
+    typedef complex_it<T, 2>         quaternion_type;
+    typedef complex_it<T, 3>           octonion_type;
+    typedef complex_it<int, 1>     plain_complex_type;
+    typedef complex_it<int, 2>  plain_quaternion_type;
+    typedef complex_it<int, 3>    plain_octonion_type;
+
+    BOOST_REQUIRE( use_reduced_multiplication<T>::value );
+    BOOST_REQUIRE( not use_reduced_multiplication<int>::value );
+
+    plain_complex_type const     d = { 2, 5 }, e = { 4, -6 };
+    plain_quaternion_type const  h = { 2, 13, -5, 17 }, k = { 11, 3, -7, 19 };
+    plain_octonion_type const    p = { 7, -2, 0, 7, -8, 6, 1, -6 }, q = { 3, 3,
+     -13, -8, 11, 12, -4, -11 };
+
+    BOOST_CHECK_EQUAL( complex_type(d) * complex_type(e), complex_type(d * e) );
+    BOOST_CHECK_EQUAL( complex_type(e) * complex_type(d), complex_type(e * d) );
+    BOOST_CHECK_EQUAL( quaternion_type(h) * quaternion_type(k),
+     quaternion_type(h * k) );
+    BOOST_CHECK_EQUAL( quaternion_type(k) * quaternion_type(h),
+     quaternion_type(k * h) );
+    BOOST_CHECK_EQUAL( octonion_type(p) * octonion_type(q), octonion_type(p * q)
+     );
+    BOOST_CHECK_EQUAL( octonion_type(q) * octonion_type(p), octonion_type(q * p)
+     );
+    BOOST_CHECK_EQUAL( quaternion_type(h) * complex_type(e),
+     quaternion_type(h * e) );
+    BOOST_CHECK_EQUAL( complex_type(d) * octonion_type(q), octonion_type(d * q)
+     );
+}
+
 // Check the division-with-scalar (including modulus) operators.
 BOOST_AUTO_TEST_CASE( test_scalar_division_and_modulus )
 {
@@ -2035,6 +2309,78 @@ BOOST_AUTO_TEST_CASE( test_division_and_modulus )
     }
 }
 
+// Check left division, the counterpart of the division operator.
+BOOST_AUTO_TEST_CASE( test_left_division )
+{
+    using boost::math::left_divide;
+
+    // Exact
+    typedef boost::rational<long long>      rational_type;
+    typedef complex_it<rational_type, 1>     complex_type;
+    typedef complex_it<rational_type, 2>  quaternion_type;
+    typedef complex_it<rational_type, 3>    octonion_type;
+
+    complex_type const     eight_ten = { 8, 10 };
+    quaternion_type const  primed = { 2, 3, 5, 7 }, squared = { 4, 9, 25, 49 };
+    octonion_type const    p = { 1, -2, 0, 1, -1, 2, 1, -1 }, q = { 3, 1, -1, 2,
+     0, -2, 1, 4 };
+
+    BOOST_CHECK_EQUAL( left_divide(primed, squared), conj(primed) * squared /
+     rational_type{87} );
+    BOOST_CHECK_EQUAL( left_divide(eight_ten, primed), conj(eight_ten) * primed
+     / rational_type{164} );
+    BOOST_CHECK_EQUAL( left_divide(primed, eight_ten), conj(primed) * eight_ten
+     / rational_type{87} );
+    BOOST_CHECK_EQUAL( left_divide(primed, primed * squared), squared );
+    BOOST_CHECK_EQUAL( left_divide(p, p * q), q );
+    BOOST_CHECK_EQUAL( (q * p) / p, q );
+
+    // Truncating
+    complex_it<int, 2> const  a = { 50, -7, 31, 12 }, b = { 2, 3, 5, 7 };
+    auto const                ab = b * a;
+
+    BOOST_CHECK_EQUAL( left_divide(b, ab), a );
+    BOOST_CHECK_EQUAL( left_divide(b, a), (conj( b ) * a) / 87 );
+    BOOST_CHECK_EQUAL( a / b, (a * conj( b )) / 87 );
+}
+
+// Check divisors whose norms, or the norms' reciprocals, are out of range.
+BOOST_AUTO_TEST_CASE( test_division_range )
+{
+    using boost::math::inverse;
+    using boost::math::left_divide;
+
+    typedef complex_it<float, 1>  complex_type;
+    typedef complex_it<float, 2>  quaternion_type;
+
+    // Pairs of computed and expected values
+    complex_type const     tiny = { 1e-20f, 1e-20f }, huge = { 1e20f, 1e20f };
+    complex_type const     c[][ 2 ] = {
+        { complex_type{1e-20f} / tiny, complex_type{0.5f, -0.5f} },
+        { complex_type{1e20f} / huge, complex_type{0.5f, -0.5f} },
+        { complex_type{1e30f} / complex_type{1e10f, 1e10f}, complex_type{5e19f,
+         -5e19f} },
+        { complex_type{1e-30f} / complex_type{1e-10f, 1e-10f},
+         complex_type{5e-21f, -5e-21f} },
+        { inverse(tiny), complex_type{5e19f, -5e19f} },
+        { inverse(huge), complex_type{5e-21f, -5e-21f} }
+    };
+    quaternion_type const  x = { 1.0f, 2.0f, 3.0f, 4.0f };
+    quaternion_type const  y = { 1e-20f, -2e-20f, 1e-20f, 3e-20f };
+    quaternion_type const  z = { 3e20f, 1e20f, -2e20f, 1e20f };
+    quaternion_type const  q[][ 2 ] = {
+        { (x * y) / y, x }, { left_divide(y, y * x), x },
+        { (x * z) / z, x }, { left_divide(z, z * x), x }
+    };
+
+    for ( auto const &cc : c )
+        for ( std::size_t i = 0u ; i < 2u ; ++i )
+            BOOST_CHECK_CLOSE( cc[0][i], cc[1][i], 0.001 );
+    for ( auto const &qq : q )
+        for ( std::size_t i = 0u ; i < 4u ; ++i )
+            BOOST_CHECK_CLOSE( qq[0][i], qq[1][i], 0.001 );
+}
+
 BOOST_AUTO_TEST_SUITE_END()  // operator_tests
 
 BOOST_AUTO_TEST_SUITE( function_tests )
@@ -2186,6 +2532,176 @@ BOOST_AUTO_TEST_CASE_TEMPLATE( test_sgn, T, test_floating_types )
     BOOST_CHECK_CLOSE( m_sgn[3], T(-0.98824), 0.1 );
 }
 
+// Check squares and integer powers against repeated multiplication.
+BOOST_AUTO_TEST_CASE_TEMPLATE( test_square_and_pow, T, test_signed_types )
+{
+    // Type-aliases
+    typedef complex_it<T, 0>        real_type;
+    typedef complex_it<T, 1>     complex_type;
+    typedef complex_it<T, 2>  quaternion_type;
+    typedef complex_it<T, 3>    octonion_type;
+
+    real_type const        a = { T(-3) };
+    complex_type const     d = { T(2), T(5) };
+    quaternion_type const  h = { T(2), T(-3), T(1), T(4) };
+    octonion_type const    p = { T(1), T(-2), T(0), T(1), T(-1), T(2), T(1),
+     T(-1) };
+
+    BOOST_CHECK_EQUAL( square(a), a * a );
+    BOOST_CHECK_EQUAL( square(d), d * d );
+    BOOST_CHECK_EQUAL( square(h), h * h );
+    BOOST_CHECK_EQUAL( square(p), p * p );
+
+    real_type        aa = { T(1) };
+    complex_type     dd = { T(1) };
+    quaternion_type  hh = { T(1) };
+    octonion_type    pp = { T(1) };
+
+    for ( int n = 0 ; n < 8 ; ++n, aa *= a, dd *= d, hh *= h, pp *= p )
+    {
+        BOOST_CHECK_EQUAL( pow(a, n), aa );
+        BOOST_CHECK_EQUAL( pow(d, n), dd );
+        BOOST_CHECK_EQUAL( pow(h, n), hh );
+        BOOST_CHECK_EQUAL( pow(p, static_cast<long>( n )), pp );
+    }
+    BOOST_CHECK_EQUAL( pow(h, 0u), quaternion_type(T( 1 )) );
+    BOOST_CHECK_EQUAL( pow(h, 1u), h );
+}
+
+// Check negative integer powers.
+BOOST_AUTO_TEST_CASE_TEMPLATE( test_negative_pow, T, test_floating_types )
+{
+    complex_it<T, 2> const  h = { T(0.5), T(-1), T(0.25), T(2) };
+    auto const              h_inv = complex_it<T, 0>{ T(1) } / h;
+    auto const              h_neg3 = pow( h, -3 ), h_inv3 = h_inv * h_inv *
+     h_inv;
+
+    for ( std::size_t i = 0u ; i < 4u ; ++i )
+        BOOST_CHECK_CLOSE( h_neg3[i], h_inv3[i], 0.0001 );
+
+    // The most negative exponent can't be negated in its own type.  The
+    // imaginary unit's powers cycle with period 4, so these are exact.
+    complex_it<T, 1> const  i_unit = { T(0), T(1) };
+    complex_it<T, 1> const  one = { T(1), T(0) };
+
+    BOOST_CHECK_EQUAL( pow(i_unit, std::numeric_limits<int>::min()), one );
+    BOOST_CHECK_EQUAL( pow(i_unit, std::numeric_limits<long long>::min()),
+     one );
+    BOOST_CHECK_EQUAL( pow(i_unit, std::numeric_limits<signed char>::min()),
+     one );
+    BOOST_CHECK_EQUAL( pow(i_unit, std::numeric_limits<int>::min() + 1),
+     i_unit );
+}
+
+// Check multiplicative inverses.
+BOOST_AUTO_TEST_CASE( test_inverse )
+{
+    using boost::math::inverse;
+
+    // Exact
+    typedef boost::rational<long long>      rational_type;
+    typedef complex_it<rational_type, 0>        real_type;
+    typedef complex_it<rational_type, 2>  quaternion_type;
+    typedef complex_it<rational_type, 3>    octonion_type;
+
+    real_type const        one = { 1 };
+    quaternion_type const  primed = { 2, 3, 5, 7 };
+    octonion_type const    p = { 1, -2, 0, 1, -1, 2, 1, -1 };
+
+    BOOST_CHECK_EQUAL( inverse(primed), quaternion_type(2, -3, -5, -7) /
+     rational_type{87} );
+    BOOST_CHECK_EQUAL( inverse(primed), one / primed );
+    BOOST_CHECK_EQUAL( inverse(primed) * primed, one );
+    BOOST_CHECK_EQUAL( p * inverse(p), one );
+    BOOST_CHECK_EQUAL( inverse(inverse( p )), p );
+
+    // Integers: only units survive
+    typedef complex_it<int, 2>  int_quaternion_type;
+
+    int_quaternion_type const  j = { 0, 0, 1 }, h = { 2, 3, 5, 7 };
+
+    BOOST_CHECK_EQUAL( inverse(j), int_quaternion_type(0, 0, -1) );
+    BOOST_CHECK_EQUAL( inverse(h), int_quaternion_type() );
+
+    // Floating, including the estimated version
+    complex_it<double, 2> const  hd = { 0.5, -1.0, 0.25, 2.0 };
+    complex_it<float, 3> const   pf = { 1.5f, -2.f, 0.f, 1.f, -1.f, 2.25f, 1.f,
+     -1.f };
+    auto const                   hd_inv = inverse( hd ), hd_div =
+     complex_it<double, 0>{ 1.0 } / hd;
+    auto const                   pf_inv = inverse( pf ), pf_est =
+     boost::math::approximate_inverse( pf );
+
+    // Both ways multiply the conjugate by the same reciprocal norm, and none of
+    // the components are zero.  (The tolerance is two epsilons, in percent.)
+    double const  hd_tolerance = 200 * std::numeric_limits<double>::epsilon();
+
+    for ( std::size_t i = 0u ; i < 4u ; ++i )
+        BOOST_CHECK_CLOSE( hd_inv[i], hd_div[i], hd_tolerance );
+
+    // The estimated reciprocal norm is off by a few rounding steps, which each
+    // component inherits; one component is zero, so compare differences.
+    float const  pf_tolerance = 4 * std::numeric_limits<float>::epsilon() *
+     sup( pf_inv );
+
+    for ( std::size_t i = 0u ; i < 8u ; ++i )
+        BOOST_CHECK_SMALL( pf_est[i] - pf_inv[i], pf_tolerance );
+}
+
+// Check fused multiply-add against separate multiplication and addition.
+BOOST_AUTO_TEST_CASE_TEMPLATE( test_fused_multiply_add, T, test_signed_types )
+{
+    using boost::math::fma_assign;
+    using boost::math::fms_assign;
+
+    // Type-aliases
+    typedef complex_it<T, 0>        real_type;
+    typedef complex_it<T, 1>     complex_type;
+    typedef complex_it<T, 2>  quaternion_type;
+    typedef complex_it<T, 3>    octonion_type;
+
+    real_type const        a = { T(-3) };
+    complex_type const     d = { T(2), T(5) };
+    quaternion_type const  h = { T(2), T(-3), T(1), T(4) };
+    octonion_type const    p = { T(1), T(-2), T(0), T(1), T(-1), T(2), T(1),
+     T(-1) }, q = { T(3), T(1), T(-1), T(2), T(0), T(-2), T(1), T(4) };
+
+    // In-place accumulation, with every conjugation combination
+    octonion_type  acc = q;
+
+    BOOST_CHECK_EQUAL( fma_assign(acc, p, h), q + p * h );
+    acc = q;
+    BOOST_CHECK_EQUAL( (fma_assign<true, false>( acc, h, p )), q + conj(h) * p
+     );
+    acc = q;
+    BOOST_CHECK_EQUAL( (fma_assign<false, true>( acc, p, p )), q + p * conj(p)
+     );
+    acc = q;
+    BOOST_CHECK_EQUAL( (fma_assign<true, true>( acc, d, p )), q + conj(d) *
+     conj(p) );
+    acc = q;
+    BOOST_CHECK_EQUAL( fms_assign(acc, a, p), q - a * p );
+    acc = q;
+    BOOST_CHECK_EQUAL( (fms_assign<true, true>( acc, p, h )), q - conj(p) *
+     conj(h) );
+
+    // A wider accumulator only has its lower part changed.
+    acc = q;
+    BOOST_CHECK_EQUAL( fma_assign(acc, h, d), q + h * d );
+
+    // The accumulator may also be a factor.
+    acc = p;
+    BOOST_CHECK_EQUAL( fma_assign(acc, acc, q), p + p * q );
+    acc = p;
+    BOOST_CHECK_EQUAL( (fms_assign<true, false>( acc, q, acc )), p - conj(q) *
+     p );
+
+    // Value-returning versions
+    BOOST_CHECK_EQUAL( fma(h, d, a), h * d + a );
+    BOOST_CHECK_EQUAL( fma(d, h, p), d * h + p );
+    BOOST_CHECK_EQUAL( fms(p, q, h), p * q - h );
+}
+
 BOOST_AUTO_TEST_SUITE_END()  // function_tests
 
 BOOST_AUTO_TEST_SUITE_END()  // complex_it_tests
@@ -0,0 +1,166 @@
+//  Boost Complex Numbers, static sparsity mask unit test program file  ------//
+
+//  Copyright 2013 Daryle Walker.
+//  Distributed under the Boost Software License, Version 1.0.  (See the
+//  accompanying file LICENSE_1_0.txt or a copy at
+//  <http://www.boost.org/LICENSE_1_0.txt>.)
+
+//  See <http://www.boost.org/libs/math/> for the library's home page.
+
+#include <boost/test/unit_test.hpp>
+
+#include "boost/math/complex_masked.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <sstream>
+#include <type_traits>
+
+
+// Common definitions  -------------------------------------------------------//
+
+namespace {
+
+    // Save time writing out long types
+    using boost::math::complex_it;
+    using boost::math::complex_masked;
+    using boost::math::full_mask;
+    using boost::math::pure_imaginary_mask;
+    using boost::math::subalgebra_mask;
+    using boost::math::basis_mask;
+
+    typedef complex_masked<int, 2, pure_imaginary_mask<2>::value>  vector_type;
+    typedef complex_masked<int, 2, full_mask<2>::value>  quaternion_type;
+    typedef complex_it<int, 2>                           dense_type;
+
+    // A number that counts its multiplications
+    struct counted
+    {
+        static int  multiplies;
+
+        int  v;
+
+        counted( int v = 0 ) : v{ v }  {}
+        explicit  operator bool() const  { return v; }
+
+        friend  counted  operator -( counted a )  { return -a.v; }
+        friend  counted  operator *( counted a, counted b )
+        { ++multiplies; return a.v * b.v; }
+        friend  counted  operator +( counted a, counted b )
+        { return a.v + b.v; }
+        friend  counted  operator -( counted a, counted b )
+        { return a.v - b.v; }
+        friend  counted &  operator +=( counted &a, counted b )
+        { a.v += b.v; return a; }
+        friend  counted &  operator -=( counted &a, counted b )
+        { a.v -= b.v; return a; }
+        friend  bool  operator ==( counted a, counted b )
+        { return a.v == b.v; }
+        friend  bool  operator !=( counted a, counted b )
+        { return a.v != b.v; }
+    };
+
+    int  counted::multiplies = 0;
+
+}
+
+
+// Unit tests for masked hypercomplex numbers  -------------------------------//
+
+BOOST_AUTO_TEST_SUITE( complex_masked_tests )
+
+BOOST_AUTO_TEST_CASE( test_masked_layout )
+{
+    BOOST_CHECK_EQUAL( vector_type::active_size, 3u );
+    BOOST_CHECK_EQUAL( sizeof(vector_type), 3u * sizeof(int) );
+    BOOST_CHECK_EQUAL( (subalgebra_mask<1>::value), 3u );
+    BOOST_CHECK_EQUAL( (basis_mask<5>::value), 32u );
+    BOOST_CHECK( not vector_type::is_active(0) );
+    BOOST_CHECK_EQUAL( vector_type::position(3), 2u );
+
+    vector_type const  v{ 1, 2, 3 };
+
+    BOOST_CHECK_EQUAL( v[0], 0 );
+    BOOST_CHECK_EQUAL( v[1], 1 );
+    BOOST_CHECK_EQUAL( v[3], 3 );
+    BOOST_CHECK_EQUAL( boost::math::get<0>(v), 0 );
+    BOOST_CHECK_EQUAL( boost::math::get<2>(v), 2 );
+    BOOST_CHECK( dense_type(v) == (dense_type{ 0, 1, 2, 3 }) );
+    BOOST_CHECK( vector_type(dense_type{ 0, 4, 5, 6 }) == (vector_type{ 4, 5, 6
+     }) );
+    BOOST_CHECK( v == quaternion_type(0, 1, 2, 3) );
+    BOOST_CHECK( v != -v );
+    BOOST_CHECK( conj(v) == -v );
+    BOOST_CHECK_EQUAL( norm(v), 14 );
+
+    std::ostringstream  ss1, ss2;
+
+    ss1 << v;
+    ss2 << dense_type( v );
+    BOOST_CHECK_EQUAL( ss1.str(), ss2.str() );
+}
+
+BOOST_AUTO_TEST_CASE( test_masked_arithmetic )
+{
+    vector_type const      u{ 1, 2, 3 }, v{ -4, 5, 6 };
+    quaternion_type const  q{ 2, -1, 3, 1 };
+
+    // Results get their masks at compile time
+    auto const  uv = u * v;
+    auto const  s = u + q;
+
+    BOOST_CHECK( (std::is_same<decltype( u + v ), vector_type>::value) );
+    BOOST_CHECK( (std::is_same<decltype( u * v ), quaternion_type>::value) );
+    BOOST_CHECK( dense_type(uv) == dense_type(u) * dense_type(v) );
+    BOOST_CHECK( dense_type(s) == dense_type(u) + dense_type(q) );
+    BOOST_CHECK( dense_type(u - q) == dense_type(u) - dense_type(q) );
+    BOOST_CHECK( dense_type(q * u) == dense_type(q) * dense_type(u) );
+    BOOST_CHECK( dense_type(u * 2) == dense_type(u) * 2 );
+    BOOST_CHECK( dense_type(2 * u) == 2 * dense_type(u) );
+
+    // Complex numbers embedded in octonions stay there
+    typedef complex_masked<int, 3, subalgebra_mask<1>::value>  embedded_type;
+    typedef complex_masked<int, 3, basis_mask<5>::value>       unit_type;
+
+    embedded_type const  a{ 3, 4 }, b{ 1, -2 };
+    unit_type const      e5{ 1 };
+
+    BOOST_CHECK( (std::is_same<decltype( a * b ), embedded_type>::value) );
+    BOOST_CHECK( a * b == embedded_type(11, -2) );
+    BOOST_CHECK( e5 * e5 == (complex_masked<int, 3, 1u>{ -1 }) );
+
+    // Rotation sandwich: a pure result, matching the full products
+    auto const  r = sandwich_product( q, u );
+
+    BOOST_CHECK( (std::is_same<decltype( r ), vector_type const>::value) );
+    BOOST_CHECK( dense_type(r) == dense_type(q) * dense_type(u) *
+     dense_type(conj( q )) );
+    BOOST_CHECK( sandwich_product(dense_type( q ), u) == r );
+}
+
+BOOST_AUTO_TEST_CASE( test_masked_term_count )
+{
+    typedef complex_masked<counted, 2, pure_imaginary_mask<2>::value>  vector;
+    typedef complex_masked<counted, 2, full_mask<2>::value>  quaternion;
+
+    vector const      v{ 1, 2, 3 };
+    quaternion const  q{ 1, 1, 0, 0 };
+
+    // Only the products of stored components are emitted
+    counted::multiplies = 0;
+    (void)( v * v );
+    BOOST_CHECK_EQUAL( counted::multiplies, 9 );
+    counted::multiplies = 0;
+    (void)( q * v );
+    BOOST_CHECK_EQUAL( counted::multiplies, 12 );
+    counted::multiplies = 0;
+
+    auto const  r = sandwich_product( q, v );
+
+    BOOST_CHECK_EQUAL( counted::multiplies, 24 );
+    BOOST_CHECK_EQUAL( r[1].v, 2 );
+    BOOST_CHECK_EQUAL( r[2].v, -6 );
+    BOOST_CHECK_EQUAL( r[3].v, 4 );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
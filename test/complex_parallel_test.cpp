@@ -0,0 +1,106 @@
+//  Boost Complex Numbers, parallel high-rank product unit test program file  //
+
+//  Copyright 2013 Daryle Walker.
+//  Distributed under the Boost Software License, Version 1.0.  (See the
+//  accompanying file LICENSE_1_0.txt or a copy at
+//  <http://www.boost.org/LICENSE_1_0.txt>.)
+
+//  See <http://www.boost.org/libs/math/> for the library's home page.
+
+#include <boost/test/unit_test.hpp>
+
+#include "boost/math/complex_parallel.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+
+// Common definitions  -------------------------------------------------------//
+
+namespace {
+
+    // Save time writing out long types
+    using boost::math::blocked_product;
+    using boost::math::cayley_thread_pool;
+    using boost::math::complex_dyn;
+    using boost::math::complex_it;
+
+    typedef complex_dyn<long>  dyn_type;
+
+    // Random values, with integer components so products are exact
+    auto  random_dyn( std::mt19937 &engine, std::size_t rank ) -> dyn_type
+    {
+        std::uniform_int_distribution<long>  d( -9, 9 );
+        dyn_type                             result( rank );
+
+        for ( auto &x : result )
+            x = d( engine );
+        return result;
+    }
+
+}
+
+
+// Unit tests for the parallel product engine  -------------------------------//
+
+BOOST_AUTO_TEST_SUITE( complex_parallel_tests )
+
+BOOST_AUTO_TEST_CASE( test_thread_pool )
+{
+    cayley_thread_pool  pool1( 1u ), pool4( 4u ), pool0( 0u );
+
+    BOOST_CHECK_EQUAL( pool1.size(), 1u );
+    BOOST_CHECK_EQUAL( pool4.size(), 4u );
+    BOOST_CHECK_EQUAL( pool0.size(), 1u );
+
+    // Every index is visited exactly once, loop after loop
+    for ( std::size_t n : {0u, 1u, 3u, 100u, 1000u} )
+    {
+        std::vector<std::atomic<int>>  hits( n );
+
+        for ( auto &h : hits )
+            h = 0;
+        pool4.parallel_for( n, [&hits]( std::size_t i ){ ++hits[i]; } );
+        for ( auto const &h : hits )
+            BOOST_REQUIRE_EQUAL( h.load(), 1 );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( test_blocked_product )
+{
+    std::mt19937        engine( 20131u );
+    cayley_thread_pool  pool( 3u );
+
+    // Agrees with the loop engine, at and past the tile size
+    for ( std::size_t rank = 0u ; rank <= 9u ; ++rank )
+    {
+        auto const  a = random_dyn( engine, rank ), b = random_dyn( engine,
+         rank );
+
+        BOOST_CHECK( blocked_product(a, b, pool) == a * b );
+    }
+
+    // Mixed ranks pad the lower-ranked factor
+    auto const  c = random_dyn( engine, 3u ), d = random_dyn( engine, 7u );
+
+    BOOST_CHECK( blocked_product(c, d, pool) == c * d );
+    BOOST_CHECK( blocked_product(d, c, pool) == d * c );
+    BOOST_CHECK( blocked_product(d, c) == d * c );
+
+    // Fixed-rank values, below and above the tile size
+    typedef complex_it<long, 3>  small_type;
+    typedef complex_it<long, 6>  large_type;
+
+    small_type const  e{ 1, 2, 3, 4, 5, 6, 7, 8 }, f{ 8, -7, 6, -5, 4, -3, 2,
+     -1 };
+    auto const        g = random_dyn( engine, 6u ), h = random_dyn( engine,
+     6u );
+
+    BOOST_CHECK( blocked_product(e, f, pool) == e * f );
+    BOOST_CHECK( blocked_product(static_cast<large_type>( g ),
+     static_cast<large_type>( h ), pool) == static_cast<large_type>(g * h) );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,127 @@
+//  Boost Complex Numbers, prepared multipliers unit test program file  ------//
+
+//  Copyright 2013 Daryle Walker.
+//  Distributed under the Boost Software License, Version 1.0.  (See the
+//  accompanying file LICENSE_1_0.txt or a copy at
+//  <http://www.boost.org/LICENSE_1_0.txt>.)
+
+//  See <http://www.boost.org/libs/math/> for the library's home page.
+
+#include <boost/test/unit_test.hpp>
+#include <boost/mpl/list.hpp>
+
+#include "boost/math/complex_prepared.hpp"
+
+#include <cstddef>
+#include <iterator>
+#include <list>
+#include <vector>
+
+#include <boost/multiprecision/cpp_int.hpp>
+
+
+// Common definitions  -------------------------------------------------------//
+
+namespace {
+
+    // Save time writing out long types
+    namespace mp = boost::multiprecision;
+    using boost::mpl::list;
+    using boost::math::complex_it;
+    using boost::math::prepared_left;
+    using boost::math::prepared_right;
+
+    // Sample testing types for components
+    typedef list<int, double, mp::int512_t>  test_types;
+
+}
+
+
+BOOST_AUTO_TEST_SUITE( complex_prepared_tests )
+
+// Prepared factors give the same products as the Cayley operator.
+BOOST_AUTO_TEST_CASE_TEMPLATE( test_prepared_products, T, test_types )
+{
+    typedef complex_it<T, 1>     complex_type;
+    typedef complex_it<T, 2>  quaternion_type;
+    typedef complex_it<T, 3>    octonion_type;
+
+    complex_type const     d = { T(2), T(5) }, e = { T(-1), T(3) };
+    quaternion_type const  h = { T(2), T(-3), T(1), T(4) }, g = { T(1), T(0),
+     T(-2), T(5) };
+    octonion_type const    p = { T(1), T(-2), T(0), T(1), T(-1), T(2), T(1),
+     T(-1) }, q = { T(3), T(1), T(-1), T(2), T(0), T(-2), T(1), T(4) };
+
+    prepared_left<T, 1> const   ld( d );
+    prepared_right<T, 1> const  rd( d );
+    prepared_left<T, 2> const   lh( h );
+    prepared_right<T, 2> const  rh( h );
+    prepared_left<T, 3> const   lp( p );
+    prepared_right<T, 3> const  rp( p );
+
+    BOOST_CHECK_EQUAL( ld.value(), d );
+    BOOST_CHECK_EQUAL( rh.value(), h );
+    BOOST_CHECK_EQUAL( lp.value(), p );
+    BOOST_CHECK_EQUAL( ld * e, d * e );
+    BOOST_CHECK_EQUAL( e * rd, e * d );
+    BOOST_CHECK_EQUAL( lh * g, h * g );
+    BOOST_CHECK_EQUAL( g * rh, g * h );
+    BOOST_CHECK_EQUAL( lp * q, p * q );
+    BOOST_CHECK_EQUAL( q * rp, q * p );
+    BOOST_CHECK_EQUAL( lp(p), p * p );
+    BOOST_CHECK_EQUAL( rp(p), p * p );
+
+    // The matrix of multiplying by a basis unit is a signed permutation.
+    octonion_type  e5{};
+
+    e5[ 5 ] = T( 1 );
+
+    prepared_left<T, 3> const  l5( e5 );
+
+    for ( std::size_t k = 0u ; k < 8u ; ++k )
+        for ( std::size_t j = 0u ; j < 8u ; ++j )
+            BOOST_CHECK_EQUAL( l5(k, j), (k == (j ^ 5u)) ? T(
+             boost::math::cayley_basis<3>::sign(5u, j) ) : T(0) );
+}
+
+// Prepared factors apply to whole sequences.
+BOOST_AUTO_TEST_CASE( test_prepared_apply )
+{
+    typedef complex_it<double, 2>  quaternion_type;
+    typedef complex_it<int, 3>     octonion_type;
+
+    std::vector<quaternion_type>  a, b( 23 ), c( 23 );
+
+    for ( int i = 0 ; i < 23 ; ++i )
+        a.push_back( {double(i), double(2 - i), double(i % 5), double(-3)} );
+
+    quaternion_type const            h = { 0.5, -1.0, 2.0, 0.25 };
+    prepared_left<double, 2> const   lh( h );
+    prepared_right<double, 2> const  rh( h );
+
+    BOOST_CHECK( lh.apply(a.data(), a.data() + a.size(), b.data()) == b.data()
+     + b.size() );
+    rh.apply( a.data(), a.data() + a.size(), c.data() );
+    for ( std::size_t i = 0u ; i < a.size() ; ++i )
+    {
+        BOOST_CHECK_EQUAL( b[i], h * a[i] );
+        BOOST_CHECK_EQUAL( c[i], a[i] * h );
+    }
+
+    // General iterators
+    std::list<octonion_type> const  x{ {1, 2, 3, 4, 5, 6, 7, 8}, {-1, 0, 2},
+     {0, 0, 0, 0, 0, 0, 0, 9} };
+    std::vector<octonion_type>      y;
+    octonion_type const             p = { 1, -2, 0, 1, -1, 2, 1, -1 };
+
+    prepared_left<int, 3>( p ).apply( x.begin(), x.end(), std::back_inserter(y)
+     );
+    BOOST_REQUIRE_EQUAL( y.size(), 3u );
+
+    auto  xi = x.begin();
+
+    for ( std::size_t i = 0u ; i < 3u ; ++i, ++xi )
+        BOOST_CHECK_EQUAL( y[i], p * *xi );
+}
+
+BOOST_AUTO_TEST_SUITE_END()  // complex_prepared_tests
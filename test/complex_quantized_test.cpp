@@ -0,0 +1,131 @@
+//  Boost Complex Numbers, quantized rotations unit test program file  -------//
+
+//  Copyright 2013 Daryle Walker.
+//  Distributed under the Boost Software License, Version 1.0.  (See the
+//  accompanying file LICENSE_1_0.txt or a copy at
+//  <http://www.boost.org/LICENSE_1_0.txt>.)
+
+//  See <http://www.boost.org/libs/math/> for the library's home page.
+
+#include <boost/test/unit_test.hpp>
+
+#include "boost/math/complex_quantized.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+
+// Common definitions  -------------------------------------------------------//
+
+namespace {
+
+    // Save time writing out long types
+    using boost::math::complex_it;
+    using boost::math::compact_quaternion;
+
+    typedef complex_it<float, 2>  quaternion_type;
+
+    // Rotation angle between two unit quaternions
+    double  rotation_angle( quaternion_type const &a, quaternion_type const &b )
+    {
+        double  dot = 0.0, chord = 0.0;
+
+        for ( std::size_t k = 0u ; k < 4u ; ++k )
+            dot += double( a[k] ) * b[ k ];
+        for ( std::size_t k = 0u ; k < 4u ; ++k )
+        {
+            double const  d = double( a[k] ) - ( dot < 0.0 ? -b[k] : b[k] );
+
+            chord += d * d;
+        }
+        return 4.0 * std::asin( std::min(1.0, std::sqrt( chord ) / 2.0) );
+    }
+
+    // Random unit quaternions
+    auto  random_rotations( std::size_t n ) -> std::vector<quaternion_type>
+    {
+        std::mt19937                     engine( 20131u );
+        std::normal_distribution<float>  d;
+        std::vector<quaternion_type>     result;
+
+        while ( result.size() < n )
+        {
+            quaternion_type const  q{ d(engine), d(engine), d(engine), d(engine)
+             };
+
+            result.push_back( q / std::sqrt(norm( q )) );
+        }
+        return result;
+    }
+
+    template < std::size_t Bits >
+    void  check_round_trip( std::vector<quaternion_type> const &x )
+    {
+        typedef compact_quaternion<Bits>  compact_type;
+
+        std::vector<compact_type>     c( x.size() );
+        std::vector<quaternion_type>  y( x.size() );
+        double                        worst = 0.0;
+
+        BOOST_CHECK( boost::math::encode_rotations(x.data(), x.data() +
+         x.size(), c.data()) == c.data() + c.size() );
+        boost::math::decode_rotations( c.data(), c.data() + c.size(),
+         y.data() );
+        for ( std::size_t i = 0u ; i < x.size() ; ++i )
+        {
+            worst = std::max( worst, rotation_angle(x[ i ], y[ i ]) );
+            BOOST_REQUIRE_CLOSE( norm(y[ i ]), 1.0f, 0.01f );
+            BOOST_REQUIRE_EQUAL( y[i], static_cast<quaternion_type>(
+             compact_type(x[ i ]) ) );
+        }
+        BOOST_CHECK_LE( worst, compact_type::max_angle_error );
+        BOOST_CHECK_GT( worst, compact_type::max_angle_error / 8.0 );
+    }
+
+}
+
+
+BOOST_AUTO_TEST_SUITE( complex_quantized_tests )
+
+// Sizes and the encoding layout
+BOOST_AUTO_TEST_CASE( test_compact_layout )
+{
+    BOOST_CHECK_EQUAL( sizeof(compact_quaternion<32>), 4u );
+    BOOST_CHECK_EQUAL( sizeof(compact_quaternion<48>), 6u );
+    BOOST_CHECK_EQUAL( sizeof(compact_quaternion<64>), 8u );
+    BOOST_CHECK_EQUAL( compact_quaternion<32>::component_bits, 10u );
+    BOOST_CHECK_EQUAL( compact_quaternion<48>::component_bits, 15u );
+    BOOST_CHECK_EQUAL( compact_quaternion<64>::component_bits, 20u );
+
+    // Index in the top 2 bits, then the others in order
+    compact_quaternion<32> const  c( quaternion_type{0.0f, 0.0f, -1.0f, 0.0f} );
+
+    BOOST_CHECK_EQUAL( c.words[1] >> 14, 2u );
+    BOOST_CHECK_EQUAL( (c.words[1] >> 4) & 0x3FFu, 511u );
+    BOOST_CHECK_EQUAL( static_cast<quaternion_type>(c), (quaternion_type{ 0.0f,
+     0.0f, 1.0f, 0.0f }) );
+
+    // Opposite quaternions are the same rotation.
+    quaternion_type const  q{ 0.5f, -0.5f, 0.5f, -0.5f };
+
+    BOOST_CHECK_EQUAL( compact_quaternion<64>(q).words[3],
+     compact_quaternion<64>(-q).words[3] );
+}
+
+// Decoding error stays within the documented bound.
+BOOST_AUTO_TEST_CASE( test_compact_accuracy )
+{
+    std::vector<quaternion_type>  x = random_rotations( 20000u );
+
+    x.push_back( {1.0f} );
+    x.push_back( {0.5f, 0.5f, 0.5f, 0.5f} );
+    x.push_back( {0.0f, 0.70710678f, -0.70710678f, 0.0f} );
+    check_round_trip<32>( x );
+    check_round_trip<48>( x );
+    check_round_trip<64>( x );
+}
+
+BOOST_AUTO_TEST_SUITE_END()  // complex_quantized_tests
@@ -18,6 +18,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <ios>
+#include <limits>
 #include <tuple>
 #include <type_traits>
 
@@ -42,11 +43,44 @@ namespace {
     typedef list<double, my_float>                      test_floating_types;
     typedef list<int, unsigned, double>                  test_builtin_types;
     typedef list<int, std::intmax_t, mp::int512_t>        test_signed_types;
+    typedef mp::number<mp::cpp_dec_float<25>, mp::et_off>     reduced_float;
+    typedef list<mp::int256_t, reduced_float>            test_reduced_types;
+
+    // A component type without a standard layout, so iteration over it can't
+    // use plain pointers
+    class mixed_access_int
+    {
+    public:
+        mixed_access_int( int v = 0 ) : value{ v }, serial{ -v }  {}
+
+        int  value;
+
+    private:
+        int  serial;
+    };
 
 }
 
 // Flag un-printable types here.
 
+// Flag types using the reduced-multiplication Cayley products here.
+namespace boost
+{
+namespace math
+{
+    template < >
+    struct use_reduced_multiplication< mp::int256_t >
+        : std::true_type
+    { };
+
+    template < >
+    struct use_reduced_multiplication< reduced_float >
+        : std::true_type
+    { };
+
+}  // namespace math
+}  // namespace boost
+
 
 BOOST_AUTO_TEST_SUITE( complex_rt_tests )
 
@@ -282,6 +316,99 @@ BOOST_AUTO_TEST_CASE_TEMPLATE( test_complex_barrages, T, test_types )
     s[ 0 ] = (T)65;
     r.upper_barrage() = s;
     BOOST_CHECK_EQUAL( r[0], r.upper_barrage()[0] );
+
+    // Views are the barrage sub-objects themselves.
+    BOOST_CHECK_EQUAL( &o.lower_view(), &o.lower_barrage() );
+    BOOST_CHECK_EQUAL( &oo.upper_view(), &oo.upper_barrage() );
+    BOOST_CHECK_EQUAL( &r.upper_view(), &r );
+    o.upper_view().lower_view() = o.lower_view().upper_view();
+    BOOST_CHECK_EQUAL( oo[4], oo[2] );
+    BOOST_CHECK_EQUAL( oo[5], oo[3] );
+}
+
+// Check iteration over the components.
+BOOST_AUTO_TEST_CASE_TEMPLATE( test_complex_iteration, T, test_types )
+{
+    complex_rt<T, 3>        o;
+    auto const &            oo = o;
+    complex_rt<T, 0> const  r{ (T)5 };
+
+    for ( int i = 0 ; i < 8 ; ++i )
+        o[ i ] = (T)( i * i );
+    BOOST_CHECK_EQUAL( end(oo) - begin(oo), 8 );
+    BOOST_CHECK_EQUAL( *begin(r), r[0] );
+    BOOST_CHECK( begin(r) + 1 == end(r) );
+
+    int  i = 0;
+
+    for ( auto const &x : oo )
+        BOOST_CHECK_EQUAL( x, oo[i++] );
+    BOOST_CHECK_EQUAL( i, 8 );
+    BOOST_CHECK_EQUAL( begin(oo)[5], (T)25 );
+    BOOST_CHECK_EQUAL( *(end(oo) - 1), (T)49 );
+
+    // Mutability
+    for ( auto &x : o )
+        x = x + (T)1;
+    *( begin(o) + 4 ) = (T)2;
+    BOOST_CHECK_EQUAL( oo[0], (T)1 );
+    BOOST_CHECK_EQUAL( oo[3], (T)10 );
+    BOOST_CHECK_EQUAL( oo[4], (T)2 );
+    BOOST_CHECK_EQUAL( oo[7], (T)50 );
+}
+
+// Padded or non-standard-layout components go through an offset table.
+BOOST_AUTO_TEST_CASE( test_complex_offset_iteration )
+{
+    using boost::math::begin;
+    using boost::math::end;
+
+    complex_rt<int, 2>               q;
+    complex_rt<mixed_access_int, 2>  m;
+    auto const &                     mm = m;
+
+    BOOST_CHECK( (std::is_pointer<decltype( begin(q) )>::value) );
+    BOOST_CHECK( not (std::is_pointer<decltype( begin(m) )>::value) );
+    for ( int i = 0 ; i < 4 ; ++i )
+        m[ i ] = mixed_access_int{ 10 * i };
+
+    auto        b = begin( mm );
+    auto const  e = end( mm );
+
+    BOOST_CHECK_EQUAL( e - b, 4 );
+    BOOST_CHECK( b < e );
+    BOOST_CHECK_EQUAL( b[2].value, 20 );
+    BOOST_CHECK_EQUAL( (++b)->value, 10 );
+    BOOST_CHECK_EQUAL( (b += 2)->value, 30 );
+    BOOST_CHECK( ++b == e );
+
+    decltype( b )  c = begin( m );
+
+    BOOST_CHECK( c == begin(mm) );
+    begin( m )[ 3 ].value = -1;
+    ( 1 + begin(m) )->value = -2;
+    BOOST_CHECK_EQUAL( mm[3].value, -1 );
+    BOOST_CHECK_EQUAL( mm[1].value, -2 );
+    BOOST_CHECK_EQUAL( mm[2].value, 20 );
+}
+
+// Equality and taxi recurse over the barrages, so they work at compile time.
+BOOST_AUTO_TEST_CASE( test_complex_constexpr_compare )
+{
+    constexpr complex_rt<int, 1>  a{ 1, -2 };
+    constexpr complex_rt<int, 2>  q{ 1, -2, 0, 0 };
+    constexpr complex_rt<int, 2>  p{ 1, -2, 0, 4 };
+    constexpr complex_rt<int, 1>  s{ 5 };
+
+    static_assert( a == a, "same-rank equality" );
+    static_assert( !(a == complex_rt<int, 1>{ 1, 2 }), "same-rank mismatch" );
+    static_assert( a == q && q == a, "mixed-rank equality" );
+    static_assert( !(a == p) && a != p, "mixed-rank mismatch" );
+    static_assert( s == 5 && 5 == s && s != 4, "scalar equality" );
+    static_assert( taxi(a) == 3, "taxi" );
+    static_assert( taxi(p) == 7, "taxi, higher rank" );
+    BOOST_CHECK( a == q );
+    BOOST_CHECK_EQUAL( taxi(p), 7 );
 }
 
 // Check comparisons between hypercomplex and scalars.
@@ -1730,6 +1857,44 @@ BOOST_AUTO_TEST_CASE_TEMPLATE( test_cayley_multiplication,T,test_signed_types )
     BOOST_CHECK_EQUAL( pp, r * h );
 }
 
+// Check the reduced-multiplication Cayley products against the regular ones.
+BOOST_AUTO_TEST_CASE_TEMPLATE( test_reduced_multiplication, T,
+ test_reduced_types )
+{
+    using boost::math::use_reduced_multiplication;
+
+    // Type-aliases
+    typedef complex_rt<T, 1>            complex_type;
+    typedef complex_rt<T, 2>         quaternion_type;
+    typedef complex_rt<T, 3>           octonion_type;
+    typedef complex_rt<int, 1>     plain_complex_type;
+    typedef complex_rt<int, 2>  plain_quaternion_type;
+    typedef complex_rt<int, 3>    plain_octonion_type;
+
+    BOOST_REQUIRE( use_reduced_multiplication<T>::value );
+    BOOST_REQUIRE( not use_reduced_multiplication<int>::value );
+
+    plain_complex_type const     d = { 2, 5 }, e = { 4, -6 };
+    plain_quaternion_type const  h = { 2, 13, -5, 17 }, k = { 11, 3, -7, 19 };
+    plain_octonion_type const    p = { 7, -2, 0, 7, -8, 6, 1, -6 }, q = { 3, 3,
+     -13, -8, 11, 12, -4, -11 };
+
+    BOOST_CHECK_EQUAL( complex_type(d) * complex_type(e), complex_type(d * e) );
+    BOOST_CHECK_EQUAL( complex_type(e) * complex_type(d), complex_type(e * d) );
+    BOOST_CHECK_EQUAL( quaternion_type(h) * quaternion_type(k),
+     quaternion_type(h * k) );
+    BOOST_CHECK_EQUAL( quaternion_type(k) * quaternion_type(h),
+     quaternion_type(k * h) );
+    BOOST_CHECK_EQUAL( octonion_type(p) * octonion_type(q), octonion_type(p * q)
+     );
+    BOOST_CHECK_EQUAL( octonion_type(q) * octonion_type(p), octonion_type(q * p)
+     );
+    BOOST_CHECK_EQUAL( quaternion_type(h) * complex_type(e),
+     quaternion_type(h * e) );
+    BOOST_CHECK_EQUAL( complex_type(d) * octonion_type(q), octonion_type(d * q)
+     );
+}
+
 // Check the division-with-scalar (including modulus) operators.
 BOOST_AUTO_TEST_CASE( test_scalar_division_and_modulus )
 {
@@ -2169,6 +2334,78 @@ BOOST_AUTO_TEST_CASE( test_division_and_modulus )
     }
 }
 
+// Check left division, the counterpart of the division operator.
+BOOST_AUTO_TEST_CASE( test_left_division )
+{
+    using boost::math::left_divide;
+
+    // Exact
+    typedef boost::rational<long long>      rational_type;
+    typedef complex_rt<rational_type, 1>     complex_type;
+    typedef complex_rt<rational_type, 2>  quaternion_type;
+    typedef complex_rt<rational_type, 3>    octonion_type;
+
+    complex_type const     eight_ten = { 8, 10 };
+    quaternion_type const  primed = { 2, 3, 5, 7 }, squared = { 4, 9, 25, 49 };
+    octonion_type const    p = { 1, -2, 0, 1, -1, 2, 1, -1 }, q = { 3, 1, -1, 2,
+     0, -2, 1, 4 };
+
+    BOOST_CHECK_EQUAL( left_divide(primed, squared), conj(primed) * squared /
+     rational_type{87} );
+    BOOST_CHECK_EQUAL( left_divide(eight_ten, primed), conj(eight_ten) * primed
+     / rational_type{164} );
+    BOOST_CHECK_EQUAL( left_divide(primed, eight_ten), conj(primed) * eight_ten
+     / rational_type{87} );
+    BOOST_CHECK_EQUAL( left_divide(primed, primed * squared), squared );
+    BOOST_CHECK_EQUAL( left_divide(p, p * q), q );
+    BOOST_CHECK_EQUAL( (q * p) / p, q );
+
+    // Truncating
+    complex_rt<int, 2> const  a = { 50, -7, 31, 12 }, b = { 2, 3, 5, 7 };
+    auto const                ab = b * a;
+
+    BOOST_CHECK_EQUAL( left_divide(b, ab), a );
+    BOOST_CHECK_EQUAL( left_divide(b, a), (conj( b ) * a) / 87 );
+    BOOST_CHECK_EQUAL( a / b, (a * conj( b )) / 87 );
+}
+
+// Check divisors whose norms, or the norms' reciprocals, are out of range.
+BOOST_AUTO_TEST_CASE( test_division_range )
+{
+    using boost::math::inverse;
+    using boost::math::left_divide;
+
+    typedef complex_rt<float, 1>  complex_type;
+    typedef complex_rt<float, 2>  quaternion_type;
+
+    // Pairs of computed and expected values
+    complex_type const     tiny = { 1e-20f, 1e-20f }, huge = { 1e20f, 1e20f };
+    complex_type const     c[][ 2 ] = {
+        { complex_type{1e-20f} / tiny, complex_type{0.5f, -0.5f} },
+        { complex_type{1e20f} / huge, complex_type{0.5f, -0.5f} },
+        { complex_type{1e30f} / complex_type{1e10f, 1e10f}, complex_type{5e19f,
+         -5e19f} },
+        { complex_type{1e-30f} / complex_type{1e-10f, 1e-10f},
+         complex_type{5e-21f, -5e-21f} },
+        { inverse(tiny), complex_type{5e19f, -5e19f} },
+        { inverse(huge), complex_type{5e-21f, -5e-21f} }
+    };
+    quaternion_type const  x = { 1.0f, 2.0f, 3.0f, 4.0f };
+    quaternion_type const  y = { 1e-20f, -2e-20f, 1e-20f, 3e-20f };
+    quaternion_type const  z = { 3e20f, 1e20f, -2e20f, 1e20f };
+    quaternion_type const  q[][ 2 ] = {
+        { (x * y) / y, x }, { left_divide(y, y * x), x },
+        { (x * z) / z, x }, { left_divide(z, z * x), x }
+    };
+
+    for ( auto const &cc : c )
+        for ( std::size_t i = 0u ; i < 2u ; ++i )
+            BOOST_CHECK_CLOSE( cc[0][i], cc[1][i], 0.001 );
+    for ( auto const &qq : q )
+        for ( std::size_t i = 0u ; i < 4u ; ++i )
+            BOOST_CHECK_CLOSE( qq[0][i], qq[1][i], 0.001 );
+}
+
 BOOST_AUTO_TEST_SUITE_END()  // operator_tests
 
 BOOST_AUTO_TEST_SUITE( function_tests )
@@ -2322,6 +2559,181 @@ BOOST_AUTO_TEST_CASE_TEMPLATE( test_sgn, T, test_floating_types )
     BOOST_CHECK_CLOSE( m_sgn[3], T(-0.98824), 0.1 );
 }
 
+// Check squares and integer powers against repeated multiplication.
+BOOST_AUTO_TEST_CASE_TEMPLATE( test_square_and_pow, T, test_signed_types )
+{
+    // Type-aliases
+    typedef complex_rt<T, 0>        real_type;
+    typedef complex_rt<T, 1>     complex_type;
+    typedef complex_rt<T, 2>  quaternion_type;
+    typedef complex_rt<T, 3>    octonion_type;
+
+    real_type const        a = { T(-3) };
+    complex_type const     d = { T(2), T(5) };
+    quaternion_type const  h = { T(2), T(-3), T(1), T(4) };
+    octonion_type const    p = { T(1), T(-2), T(0), T(1), T(-1), T(2), T(1),
+     T(-1) };
+
+    BOOST_CHECK_EQUAL( square(a), a * a );
+    BOOST_CHECK_EQUAL( square(d), d * d );
+    BOOST_CHECK_EQUAL( square(h), h * h );
+    BOOST_CHECK_EQUAL( square(p), p * p );
+
+    real_type        aa = { T(1) };
+    complex_type     dd = { T(1) };
+    quaternion_type  hh = { T(1) };
+    octonion_type    pp = { T(1) };
+
+    for ( int n = 0 ; n < 8 ; ++n, aa *= a, dd *= d, hh *= h, pp *= p )
+    {
+        BOOST_CHECK_EQUAL( pow(a, n), aa );
+        BOOST_CHECK_EQUAL( pow(d, n), dd );
+        BOOST_CHECK_EQUAL( pow(h, n), hh );
+        BOOST_CHECK_EQUAL( pow(p, static_cast<long>( n )), pp );
+    }
+    BOOST_CHECK_EQUAL( pow(h, 0u), quaternion_type(T( 1 )) );
+    BOOST_CHECK_EQUAL( pow(h, 1u), h );
+}
+
+// Check negative integer powers.
+BOOST_AUTO_TEST_CASE_TEMPLATE( test_negative_pow, T, test_floating_types )
+{
+    complex_rt<T, 2> const  h = { T(0.5), T(-1), T(0.25), T(2) };
+    auto const              h_inv = complex_rt<T, 0>{ T(1) } / h;
+    auto const              h_neg3 = pow( h, -3 ), h_inv3 = h_inv * h_inv *
+     h_inv;
+
+    for ( std::size_t i = 0u ; i < 4u ; ++i )
+        BOOST_CHECK_CLOSE( h_neg3[i], h_inv3[i], 0.0001 );
+
+    // The most negative exponent can't be negated in its own type.  The
+    // imaginary unit's powers cycle with period 4, so these are exact.
+    complex_rt<T, 1> const  i_unit = { T(0), T(1) };
+    complex_rt<T, 1> const  one = { T(1), T(0) };
+
+    BOOST_CHECK_EQUAL( pow(i_unit, std::numeric_limits<int>::min()), one );
+    BOOST_CHECK_EQUAL( pow(i_unit, std::numeric_limits<long long>::min()),
+     one );
+    BOOST_CHECK_EQUAL( pow(i_unit, std::numeric_limits<signed char>::min()),
+     one );
+    BOOST_CHECK_EQUAL( pow(i_unit, std::numeric_limits<int>::min() + 1),
+     i_unit );
+}
+
+// Check multiplicative inverses.
+BOOST_AUTO_TEST_CASE( test_inverse )
+{
+    using boost::math::inverse;
+
+    // Exact
+    typedef boost::rational<long long>      rational_type;
+    typedef complex_rt<rational_type, 0>        real_type;
+    typedef complex_rt<rational_type, 2>  quaternion_type;
+    typedef complex_rt<rational_type, 3>    octonion_type;
+
+    real_type const        one = { 1 };
+    quaternion_type const  primed = { 2, 3, 5, 7 };
+    octonion_type const    p = { 1, -2, 0, 1, -1, 2, 1, -1 };
+
+    BOOST_CHECK_EQUAL( inverse(primed), quaternion_type(2, -3, -5, -7) /
+     rational_type{87} );
+    BOOST_CHECK_EQUAL( inverse(primed), one / primed );
+    BOOST_CHECK_EQUAL( inverse(primed) * primed, one );
+    BOOST_CHECK_EQUAL( p * inverse(p), one );
+    BOOST_CHECK_EQUAL( inverse(inverse( p )), p );
+
+    // Integers: only units survive
+    typedef complex_rt<int, 2>  int_quaternion_type;
+
+    int_quaternion_type const  j = { 0, 0, 1 }, h = { 2, 3, 5, 7 };
+
+    BOOST_CHECK_EQUAL( inverse(j), int_quaternion_type(0, 0, -1) );
+    BOOST_CHECK_EQUAL( inverse(h), int_quaternion_type() );
+
+    // Floating
+    complex_rt<double, 2> const  hd = { 0.5, -1.0, 0.25, 2.0 };
+    auto const                   hd_inv = inverse( hd ), hd_div =
+     complex_rt<double, 0>{ 1.0 } / hd;
+
+    // Both ways multiply the conjugate by the same reciprocal norm, and none of
+    // the components are zero.  (The tolerance is two epsilons, in percent.)
+    double const  hd_tolerance = 200 * std::numeric_limits<double>::epsilon();
+
+    for ( std::size_t i = 0u ; i < 4u ; ++i )
+        BOOST_CHECK_CLOSE( hd_inv[i], hd_div[i], hd_tolerance );
+}
+
+// Check fused multiply-add against separate multiplication and addition.
+BOOST_AUTO_TEST_CASE_TEMPLATE( test_fused_multiply_add, T, test_signed_types )
+{
+    using boost::math::fma_assign;
+    using boost::math::fms_assign;
+
+    // Type-aliases
+    typedef complex_rt<T, 0>        real_type;
+    typedef complex_rt<T, 1>     complex_type;
+    typedef complex_rt<T, 2>  quaternion_type;
+    typedef complex_rt<T, 3>    octonion_type;
+
+    real_type const        a = { T(-3) };
+    complex_type const     d = { T(2), T(5) };
+    quaternion_type const  h = { T(2), T(-3), T(1), T(4) };
+    octonion_type const    p = { T(1), T(-2), T(0), T(1), T(-1), T(2), T(1),
+     T(-1) }, q = { T(3), T(1), T(-1), T(2), T(0), T(-2), T(1), T(4) };
+
+    // In-place accumulation, with every conjugation combination
+    octonion_type  acc = q;
+
+    BOOST_CHECK_EQUAL( fma_assign(acc, p, h), q + p * h );
+    acc = q;
+    BOOST_CHECK_EQUAL( (fma_assign<true, false>( acc, h, p )), q + conj(h) * p
+     );
+    acc = q;
+    BOOST_CHECK_EQUAL( (fma_assign<false, true>( acc, p, p )), q + p * conj(p)
+     );
+    acc = q;
+    BOOST_CHECK_EQUAL( (fma_assign<true, true>( acc, d, p )), q + conj(d) *
+     conj(p) );
+    acc = q;
+    BOOST_CHECK_EQUAL( fms_assign(acc, a, p), q - a * p );
+    acc = q;
+    BOOST_CHECK_EQUAL( (fms_assign<true, true>( acc, p, h )), q - conj(p) *
+     conj(h) );
+
+    // A wider accumulator only has its lower part changed.
+    acc = q;
+    BOOST_CHECK_EQUAL( fma_assign(acc, h, d), q + h * d );
+
+    // The accumulator may also be a factor.
+    acc = p;
+    BOOST_CHECK_EQUAL( fma_assign(acc, acc, q), p + p * q );
+    acc = p;
+    BOOST_CHECK_EQUAL( (fms_assign<true, false>( acc, q, acc )), p - conj(q) *
+     p );
+
+    // So may either barrage of it.
+    quaternion_type        hacc = { T(1), T(2), T(3), T(4) };
+    quaternion_type const  y = { T(7), T(-1), T(2), T(3) }, hq = hacc;
+    complex_type const     hu = hq.upper_barrage(), hl = hq.lower_barrage();
+
+    BOOST_CHECK_EQUAL( fma_assign(hacc, y, hacc.upper_barrage()), (
+     quaternion_type{T(26), T(27), T(21), T(5)}) );
+    hacc = hq;
+    BOOST_CHECK_EQUAL( (fms_assign<true, false>( hacc, y, hacc.upper_barrage()
+     )), hq - conj(y) * hu );
+    hacc = hq;
+    BOOST_CHECK_EQUAL( (fms_assign<false, true>( hacc, hacc.lower_barrage(), y
+     )), hq - hl * conj(y) );
+    hacc = hq;
+    BOOST_CHECK_EQUAL( fma_assign(hacc, hacc.upper_barrage(),
+     hacc.lower_barrage()), hq + hu * hl );
+
+    // Value-returning versions
+    BOOST_CHECK_EQUAL( fma(h, d, a), h * d + a );
+    BOOST_CHECK_EQUAL( fma(d, h, p), d * h + p );
+    BOOST_CHECK_EQUAL( fms(p, q, h), p * q - h );
+}
+
 BOOST_AUTO_TEST_SUITE_END()  // function_tests
 
 BOOST_AUTO_TEST_SUITE_END()  // complex_rt_tests
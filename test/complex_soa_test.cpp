@@ -0,0 +1,220 @@
+//  Boost Complex Numbers, structure-of-arrays unit test program file  -------//
+
+//  Copyright 2013 Daryle Walker.
+//  Distributed under the Boost Software License, Version 1.0.  (See the
+//  accompanying file LICENSE_1_0.txt or a copy at
+//  <http://www.boost.org/LICENSE_1_0.txt>.)
+
+//  See <http://www.boost.org/libs/math/> for the library's home page.
+
+#include <boost/test/unit_test.hpp>
+#include <boost/mpl/list.hpp>
+
+#include "boost/math/complex_soa.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+
+// Common definitions  -------------------------------------------------------//
+
+namespace {
+
+    // Save time writing out long types
+    using boost::mpl::list;
+    using boost::math::complex_it;
+    using boost::math::complex_rt;
+    using boost::math::complex_soa_vector;
+
+    // Sample testing types for components
+    typedef list<int, double>  test_types;
+
+}
+
+
+BOOST_AUTO_TEST_SUITE( complex_soa_tests )
+
+// Element access through proxies, and container sizing
+BOOST_AUTO_TEST_CASE( test_soa_access )
+{
+    typedef complex_soa_vector<int, 2>  soa_type;
+    typedef soa_type::element_type      quaternion_type;
+
+    BOOST_CHECK_EQUAL( soa_type::rank, 2u );
+    BOOST_CHECK_EQUAL( soa_type::static_size, 4u );
+
+    soa_type  s;
+
+    BOOST_CHECK( s.empty() );
+    s.push_back( quaternion_type{1, 2, 3, 4} );
+    s.push_back( complex_rt<int, 2>{5, 6, 7, 8} );
+    s.resize( 3u );
+    BOOST_CHECK_EQUAL( s.size(), 3u );
+    BOOST_CHECK_EQUAL( s.lane(1)[0], 2 );
+    BOOST_CHECK_EQUAL( s.lane(3)[1], 8 );
+
+    quaternion_type const  a = s[ 0 ];
+    complex_rt<int, 2>     b = s[ 1 ];
+
+    BOOST_CHECK_EQUAL( a, (quaternion_type{ 1, 2, 3, 4 }) );
+    BOOST_CHECK_EQUAL( b[2], 7 );
+    BOOST_CHECK_EQUAL( static_cast<quaternion_type>(s[2]), quaternion_type{} );
+
+    s[ 2 ] = s[ 0 ];
+    s[ 0 ][ 3 ] = -1;
+    s[ 1 ] = complex_rt<int, 2>{ 0, 0, 0, 9 };
+    BOOST_CHECK_EQUAL( s.lane(3)[0], -1 );
+    BOOST_CHECK_EQUAL( s.lane(3)[1], 9 );
+    BOOST_CHECK_EQUAL( static_cast<soa_type const &>(s)[2], a );
+
+    soa_type  t{ a, a };
+
+    swap( s, t );
+    BOOST_CHECK_EQUAL( s.size(), 2u );
+    BOOST_CHECK_EQUAL( t.size(), 3u );
+    t.clear();
+    BOOST_CHECK( t.empty() );
+}
+
+// Whole-container operators match the per-element ones.
+BOOST_AUTO_TEST_CASE_TEMPLATE( test_soa_arithmetic, T, test_types )
+{
+    typedef complex_soa_vector<T, 3>  soa_type;
+    typedef complex_it<T, 3>          octonion_type;
+
+    // Enough elements to cross a block boundary
+    std::vector<octonion_type>  x, y;
+
+    for ( int i = 0 ; i < 1100 ; ++i )
+    {
+        x.push_back( {T(i % 7 - 3), T(2), T(i % 5), T(-1), T(i % 3), T(0),
+         T(1), T(i % 11 - 5)} );
+        y.push_back( {T(1 + i % 4), T(-2), T(0), T(i % 6), T(3), T(1), T(-1),
+         T(i % 2)} );
+    }
+
+    soa_type const  a( x.begin(), x.end() ), b( y.begin(), y.end() );
+    soa_type const  sum = a + b, difference = a - b, product = a * b,
+                    quotient = a / b, conjugate = conj( a );
+
+    std::vector<T> const  norms = norm( b );
+
+    BOOST_REQUIRE_EQUAL( product.size(), x.size() );
+    for ( std::size_t i = 0u ; i < x.size() ; ++i )
+    {
+        BOOST_CHECK_EQUAL( sum[i], x[i] + y[i] );
+        BOOST_CHECK_EQUAL( difference[i], x[i] - y[i] );
+        BOOST_CHECK_EQUAL( product[i], x[i] * y[i] );
+        BOOST_CHECK_EQUAL( conjugate[i], octonion_type(conj( x[i] )) );
+        BOOST_CHECK_EQUAL( norms[i], norm(y[i]) );
+    }
+
+    // Exact for integers; for floating-point, only scaling by a reciprocal
+    // differs from the per-element division.
+    for ( std::size_t i = 0u ; i < x.size() ; i += 37u )
+        for ( std::size_t k = 0u ; k < 8u ; ++k )
+            BOOST_CHECK_CLOSE( double(quotient[i][k]) + 1.0, double((x[i] /
+             y[i])[k]) + 1.0, 1e-10 );
+}
+
+// Division redoes elements whose norms or products leave the normal range.
+template < typename T >
+void  check_division_range( std::vector<T> const &scales )
+{
+    typedef complex_it<T, 2>          quaternion_type;
+    typedef complex_soa_vector<T, 2>  soa_type;
+
+    quaternion_type const         half{ T(.5), T(-.5) };
+    std::vector<quaternion_type>  x, y;
+
+    for ( T const s : scales )
+    {
+        x.push_back( quaternion_type{s} );
+        y.push_back( quaternion_type{s, s} );
+    }
+
+    soa_type const  a( x.begin(), x.end() ), b( y.begin(), y.end() );
+    soa_type const  quotient = a / b;
+
+    for ( std::size_t i = 0u ; i < x.size() ; ++i )
+    {
+        BOOST_CHECK_EQUAL( quotient[i], half );
+        BOOST_CHECK_EQUAL( quotient[i], x[i] / y[i] );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( test_soa_division_range )
+{
+    check_division_range<float>( {1.f, 1e-23f, 1e20f, 1e25f, 2.f, 1e30f} );
+    check_division_range<double>( {1., 1e-170, 1e160, 1e300, 0.25} );
+}
+
+// Magnitudes and unit vectors
+BOOST_AUTO_TEST_CASE( test_soa_magnitude )
+{
+    typedef complex_soa_vector<double, 1>  soa_type;
+
+    soa_type const  a{ {3.0, 4.0}, {0.0, 0.0}, {-5.0, 12.0} };
+
+    std::vector<double> const  r = abs( a );
+    soa_type const             u = sgn( a );
+
+    BOOST_CHECK_EQUAL( r[0], 5.0 );
+    BOOST_CHECK_EQUAL( r[1], 0.0 );
+    BOOST_CHECK_EQUAL( r[2], 13.0 );
+    BOOST_CHECK_CLOSE( u[0][0], 0.6, 1e-12 );
+    BOOST_CHECK_CLOSE( u[0][1], 0.8, 1e-12 );
+    BOOST_CHECK_EQUAL( u[1], a[1] );
+    BOOST_CHECK_CLOSE( u[2][1], 12.0 / 13.0, 1e-12 );
+}
+
+// Transposition between interleaved and lane layouts
+template < typename T, std::size_t R >
+void  check_transposition()
+{
+    typedef complex_it<T, R>  number_type;
+
+    std::size_t const         size = number_type::static_size;
+    std::vector<number_type>  x( 37 ), y( 37 );
+
+    for ( std::size_t i = 0u ; i < x.size() ; ++i )
+        for ( std::size_t k = 0u ; k < size ; ++k )
+            x[ i ][ k ] = T( i * size + k );
+
+    std::vector<T>  lanes[ size ];
+    T *             l[ size ];
+
+    for ( std::size_t k = 0u ; k < size ; ++k )
+    {
+        lanes[ k ].resize( x.size() );
+        l[ k ] = lanes[ k ].data();
+    }
+    BOOST_CHECK_EQUAL( boost::math::split_lanes(x.data(), x.data() + x.size(),
+     l), x.size() );
+    for ( std::size_t k = 0u ; k < size ; ++k )
+        BOOST_CHECK_EQUAL( lanes[k][30], T(30 * size + k) );
+    BOOST_CHECK( boost::math::merge_lanes(l, x.size(), y.data()) == y.data() +
+     y.size() );
+    BOOST_CHECK( x == y );
+
+    // The container transposes array segments on the way in and out.
+    complex_soa_vector<T, R> const  s( x.data(), x.data() + x.size() );
+
+    std::fill( y.begin(), y.end(), number_type{} );
+    s.copy_to( y.data() );
+    BOOST_CHECK_EQUAL( s.lane(1)[36], T(36 * size + 1) );
+    BOOST_CHECK( x == y );
+}
+
+BOOST_AUTO_TEST_CASE( test_soa_transposition )
+{
+    check_transposition<float, 1>();
+    check_transposition<float, 2>();
+    check_transposition<float, 3>();
+    check_transposition<double, 1>();
+    check_transposition<double, 2>();
+    check_transposition<double, 3>();
+}
+
+BOOST_AUTO_TEST_SUITE_END()  // complex_soa_tests
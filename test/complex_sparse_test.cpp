@@ -0,0 +1,176 @@
+//  Boost Complex Numbers, sparse storage unit test program file  ------------//
+
+//  Copyright 2013 Daryle Walker.
+//  Distributed under the Boost Software License, Version 1.0.  (See the
+//  accompanying file LICENSE_1_0.txt or a copy at
+//  <http://www.boost.org/LICENSE_1_0.txt>.)
+
+//  See <http://www.boost.org/libs/math/> for the library's home page.
+
+#include <boost/test/unit_test.hpp>
+
+#include "boost/math/complex_sparse.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <sstream>
+
+
+// Common definitions  -------------------------------------------------------//
+
+namespace {
+
+    // Save time writing out long types
+    using boost::math::complex_it;
+    using boost::math::complex_rt;
+    using boost::math::sparse_complex;
+
+    // Random sparse values, with integer components so products are exact
+    template < std::size_t R >
+    auto  random_sparse( std::mt19937 &engine, std::size_t fill )
+     -> sparse_complex<int, R>
+    {
+        std::uniform_int_distribution<std::size_t>  index( 0u, (1u << R) - 1u );
+        std::uniform_int_distribution<int>          value( -9, 9 );
+        sparse_complex<int, R>                      result;
+
+        for ( std::size_t k = 0u ; k < fill ; ++k )
+            result.set( index(engine), value(engine) );
+        return result;
+    }
+
+}
+
+
+// Unit tests for sparse hypercomplex numbers  -------------------------------//
+
+BOOST_AUTO_TEST_SUITE( complex_sparse_tests )
+
+BOOST_AUTO_TEST_CASE( test_sparse_storage )
+{
+    typedef sparse_complex<int, 3>  sparse_type;
+    typedef complex_it<int, 3>      dense_type;
+    typedef complex_rt<int, 3>      nested_type;
+
+    sparse_type  a, b = 5, c{ {6, 2}, {1, -3}, {4, 0} };
+
+    BOOST_CHECK( not a );
+    BOOST_CHECK_EQUAL( a.nonzero_count(), 0u );
+    BOOST_CHECK_EQUAL( b.nonzero_count(), 1u );
+    BOOST_CHECK_EQUAL( b[0], 5 );
+    BOOST_CHECK_EQUAL( c.nonzero_count(), 2u );
+    BOOST_CHECK_EQUAL( c.begin()->first, 1u );
+    BOOST_CHECK_EQUAL( c[1], -3 );
+    BOOST_CHECK_EQUAL( c[4], 0 );
+    BOOST_CHECK_EQUAL( c[6], 2 );
+
+    // Writing zero removes the entry
+    c.set( 1u, 0 );
+    BOOST_CHECK_EQUAL( c.nonzero_count(), 1u );
+    c.set( 6u, 7 );
+    BOOST_CHECK_EQUAL( c[6], 7 );
+    BOOST_CHECK( c != b );
+    swap( b, c );
+    BOOST_CHECK_EQUAL( b[6], 7 );
+    BOOST_CHECK_EQUAL( c[0], 5 );
+    BOOST_CHECK_EQUAL( sparse_type::static_size, 8u );
+
+    // Conversions, both ways, with both dense types
+    dense_type const   d{ 0, 0, 4, 0, -1, 0, 0, 0 };
+    sparse_type const  e{ d }, f{ nested_type(d) };
+
+    BOOST_CHECK_EQUAL( e.nonzero_count(), 2u );
+    BOOST_CHECK( e == f );
+    BOOST_CHECK( static_cast<dense_type>(e) == d );
+    BOOST_CHECK( static_cast<nested_type>(f) == nested_type(d) );
+
+    std::ostringstream  ss1, ss2;
+
+    ss1 << e;
+    ss2 << d;
+    BOOST_CHECK_EQUAL( ss1.str(), ss2.str() );
+}
+
+BOOST_AUTO_TEST_CASE( test_sparse_arithmetic )
+{
+    typedef complex_it<int, 5>  dense_type;
+
+    std::mt19937  engine( 20131u );
+
+    // Compare with the dense type across several fill ratios
+    for ( std::size_t fill : {1u, 4u, 12u, 32u} )
+        for ( int trial = 0 ; trial < 20 ; ++trial )
+        {
+            auto const  a = random_sparse<5>( engine, fill );
+            auto const  b = random_sparse<5>( engine, fill );
+            auto const  da = static_cast<dense_type>( a );
+            auto const  db = static_cast<dense_type>( b );
+
+            BOOST_CHECK( static_cast<dense_type>(a + b) == da + db );
+            BOOST_CHECK( static_cast<dense_type>(a - b) == da - db );
+            BOOST_CHECK( static_cast<dense_type>(a * b) == da * db );
+            BOOST_CHECK( static_cast<dense_type>(-a) == -da );
+            BOOST_CHECK( static_cast<dense_type>(conj( a )) ==
+             dense_type(conj( da )) );
+            BOOST_CHECK( static_cast<dense_type>(3 * a) == 3 * da );
+            BOOST_CHECK_EQUAL( norm(a), norm(da) );
+            BOOST_CHECK( not (a - a) );
+        }
+}
+
+BOOST_AUTO_TEST_CASE( test_sparse_product_table )
+{
+    using boost::math::detail::basis_product_sign;
+    using boost::math::detail::sparse_sign_negative;
+
+    // The masked sign walk matches the recursive one
+    for ( std::size_t r = 0u ; r <= 6u ; ++r )
+        for ( std::size_t i = 0u ; i < (1u << r) ; ++i )
+            for ( std::size_t j = 0u ; j < (1u << r) ; ++j )
+                BOOST_REQUIRE_EQUAL( sparse_sign_negative(r, i, j),
+                 basis_product_sign(r, i, j) < 0 );
+
+    // Sixteen pairs get a 32-slot table, and their indices all share their
+    // low five bits with 1 or 17, so most of them have to probe.
+    typedef sparse_complex<int, 8>  sparse_type;
+
+    sparse_type const  a{ {1u, 2}, {17u, -3}, {33u, 5}, {49u, 7} };
+    sparse_type const  b{ {0u, 1}, {64u, -2}, {128u, 4}, {192u, 3} };
+    int                expected[ 256 ] = {};
+
+    for ( auto const &x : a )
+        for ( auto const &y : b )
+            expected[ x.first ^ y.first ] += basis_product_sign( 8u, x.first,
+             y.first ) * x.second * y.second;
+
+    sparse_type const  p = a * b;
+    std::size_t        nonzero = 0u;
+
+    for ( std::size_t k = 0u ; k < 256u ; ++k )
+    {
+        BOOST_CHECK_EQUAL( p[k], expected[k] );
+        nonzero += expected[ k ] != 0;
+    }
+    BOOST_CHECK_EQUAL( p.nonzero_count(), nonzero );
+    BOOST_CHECK( std::is_sorted(p.begin(), p.end()) );
+}
+
+BOOST_AUTO_TEST_CASE( test_sparse_high_rank )
+{
+    // Rank 8 has 256 components; dense products take 65536 multiplies
+    typedef sparse_complex<double, 8>  sparse_type;
+
+    for ( std::size_t i = 1u ; i < sparse_type::static_size ; i += 37u )
+    {
+        sparse_type const  e{ {i, 1.0} }, f{ {0u, 2.0}, {i, 3.0} };
+
+        BOOST_CHECK( e * e == sparse_type(-1.0) );
+        BOOST_CHECK( e * conj(e) == sparse_type(1.0) );
+        BOOST_CHECK_EQUAL( norm(f), 13.0 );
+        BOOST_CHECK( f * conj(f) == sparse_type(13.0) );
+        BOOST_CHECK_EQUAL( (e * f).nonzero_count(), 2u );
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -15,7 +15,12 @@
 
 #include "boost/math/complex.hpp"
 
-// Put standard includes here.
+#include <cmath>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <list>
+#include <vector>
 
 #include <boost/multiprecision/cpp_int.hpp>
 #include <boost/multiprecision/cpp_dec_float.hpp>
@@ -35,6 +40,120 @@ namespace {
     typedef boost::mpl::list<int, unsigned, double, cpp_int, cpp_dec_float_50>
       test_types;
 
+#if BOOST_MATH_COMPLEX_SIMD_DISPATCH
+    // Run each vector kernel, at the given register width, over a few values
+    // and compare with the operators.  The kernels are compiled for the base
+    // instruction set here, so every width works on any processor.
+    template < typename T, std::size_t R, std::size_t Bytes >
+    void  check_simd_kernels()
+    {
+        namespace  detail = boost::math::detail;
+
+        typedef complex_it<T, R>  value_type;
+
+        std::size_t const  count = 4u;
+        value_type         a[ count ], b[ count ], c[ count ];
+        T                  n[ count ];
+
+        // Divisors have norms that are powers of 2, for exact quotients.
+        for ( std::size_t i = 0u ; i < count ; ++i )
+            for ( std::size_t k = 0u ; k < value_type::static_size ; ++k )
+            {
+                a[ i ][ k ] = T( int(3u * i + k) % 7 - 3 );
+                b[ i ][ k ] = T( (k < (1u << i)) ? ((k + i) % 3 ? 1 : -1) : 0 );
+            }
+
+        BOOST_REQUIRE( (detail::has_simd_kernel<detail::batch_multiplies,
+         value_type, value_type, value_type, Bytes>::value) );
+        BOOST_REQUIRE( (detail::has_simd_unary_kernel<detail::batch_norms,
+         value_type, T, Bytes>::value) );
+
+        for ( std::size_t i = 0u ; i < count ; ++i )
+            detail::binary_batch_body<detail::batch_plus, value_type,
+             value_type, value_type>{ {}, a, b, c }.template step<Bytes>( i );
+        for ( std::size_t i = 0u ; i < count ; ++i )
+            BOOST_CHECK_EQUAL( c[i], a[i] + b[i] );
+        for ( std::size_t i = 0u ; i < count ; ++i )
+            detail::binary_batch_body<detail::batch_minus, value_type,
+             value_type, value_type>{ {}, a, b, c }.template step<Bytes>( i );
+        for ( std::size_t i = 0u ; i < count ; ++i )
+            BOOST_CHECK_EQUAL( c[i], a[i] - b[i] );
+        for ( std::size_t i = 0u ; i < count ; ++i )
+            detail::binary_batch_body<detail::batch_multiplies, value_type,
+             value_type, value_type>{ {}, a, b, c }.template step<Bytes>( i );
+        for ( std::size_t i = 0u ; i < count ; ++i )
+            BOOST_CHECK_EQUAL( c[i], a[i] * b[i] );
+        for ( std::size_t i = 0u ; i < count ; ++i )
+            detail::binary_batch_body<detail::batch_conj_multiplies,
+             value_type, value_type, value_type>{ {}, a, b, c }.template
+             step<Bytes>( i );
+        for ( std::size_t i = 0u ; i < count ; ++i )
+            BOOST_CHECK_EQUAL( c[i], value_type(conj( a[i] )) * b[i] );
+        for ( std::size_t i = 0u ; i < count ; ++i )
+            detail::binary_batch_body<detail::batch_divides, value_type,
+             value_type, value_type>{ {}, a, b, c }.template step<Bytes>( i );
+        for ( std::size_t i = 0u ; i < count ; ++i )
+            BOOST_CHECK_EQUAL( c[i], a[i] / b[i] );
+        for ( std::size_t i = 0u ; i < count ; ++i )
+            detail::binary_batch_body<detail::batch_left_divides, value_type,
+             value_type, value_type>{ {}, b, a, c }.template step<Bytes>( i );
+        for ( std::size_t i = 0u ; i < count ; ++i )
+            BOOST_CHECK_EQUAL( c[i], left_divide(b[i], a[i]) );
+        for ( std::size_t i = 0u ; i < count ; ++i )
+            detail::unary_batch_body<detail::batch_scales<T>, value_type,
+             value_type>{ {T( -2 )}, a, c }.template step<Bytes>( i );
+        for ( std::size_t i = 0u ; i < count ; ++i )
+            BOOST_CHECK_EQUAL( c[i], a[i] * T(-2) );
+        for ( std::size_t i = 0u ; i < count ; ++i )
+            detail::unary_batch_body<detail::batch_norms, value_type, T>{ {}, a,
+             n }.template step<Bytes>( i );
+        for ( std::size_t i = 0u ; i < count ; ++i )
+            BOOST_CHECK_EQUAL( n[i], norm(a[i]) );
+
+        // Quotients whose norm or product leaves the normal range:  the norm
+        // underflows, the product overflows, the norm overflows, and the
+        // components are subnormal.  Each quotient is (1/2, -1/2).
+        typedef std::numeric_limits<T>  limits;
+
+        T const  s[ count ] = { std::sqrt(limits::min()) / T(16),
+         std::sqrt(limits::max()) * T(16), limits::max() / T(4),
+         limits::denorm_min() * T(64) };
+
+        for ( std::size_t i = 0u ; i < count ; ++i )
+        {
+            a[ i ] = value_type{ s[i] };
+            b[ i ] = value_type{ s[i], s[i] };
+        }
+        for ( std::size_t i = 0u ; i < count ; ++i )
+            detail::binary_batch_body<detail::batch_divides, value_type,
+             value_type, value_type>{ {}, a, b, c }.template step<Bytes>( i );
+        for ( std::size_t i = 0u ; i < count ; ++i )
+        {
+            BOOST_CHECK_EQUAL( c[i], a[i] / b[i] );
+            BOOST_CHECK_EQUAL( c[i], (value_type{ T(.5), T(-.5) }) );
+        }
+        for ( std::size_t i = 0u ; i < count ; ++i )
+            detail::binary_batch_body<detail::batch_left_divides, value_type,
+             value_type, value_type>{ {}, b, a, c }.template step<Bytes>( i );
+        for ( std::size_t i = 0u ; i < count ; ++i )
+        {
+            BOOST_CHECK_EQUAL( c[i], left_divide(b[i], a[i]) );
+            BOOST_CHECK_EQUAL( c[i], (value_type{ T(.5), T(-.5) }) );
+        }
+    }
+
+    // Run the kernels for every type and rank that has them at that width
+    template < std::size_t Bytes >
+    void  check_simd_kernels()
+    {
+        check_simd_kernels<double, 1u, Bytes>();
+        check_simd_kernels<double, 2u, Bytes>();
+        check_simd_kernels<double, 3u, Bytes>();
+        check_simd_kernels<float, 2u, Bytes>();
+        check_simd_kernels<float, 3u, Bytes>();
+    }
+#endif
+
 }
 
 // Flag un-printable types here.
@@ -65,17 +184,69 @@ BOOST_AUTO_TEST_CASE_TEMPLATE( complex_size_demo, T, test_types )
     BOOST_WARN( not (complex_it<T, 2>::has_padding) );
     BOOST_WARN( not (complex_it<T, 3>::has_padding) );
 
-#if BOOST_MATH_COMPLEX_IS_PACKED
-    BOOST_REQUIRE_EQUAL( sizeof(complex_rt<T, 0>), sizeof(T) );
-    BOOST_REQUIRE_EQUAL( sizeof(complex_rt<T, 1>), sizeof(T) * 2 );
-    BOOST_REQUIRE_EQUAL( sizeof(complex_rt<T, 2>), sizeof(T) * 4 );
-    BOOST_REQUIRE_EQUAL( sizeof(complex_rt<T, 3>), sizeof(T) * 8 );
+    // Packed types have exactly the size of their components.
+    using boost::math::is_packed;
 
-    BOOST_REQUIRE_EQUAL( sizeof(complex_it<T, 0>), sizeof(T) );
-    BOOST_REQUIRE_EQUAL( sizeof(complex_it<T, 1>), sizeof(T) * 2 );
-    BOOST_REQUIRE_EQUAL( sizeof(complex_it<T, 2>), sizeof(T) * 4 );
-    BOOST_REQUIRE_EQUAL( sizeof(complex_it<T, 3>), sizeof(T) * 8 );
-#endif
+    if ( is_packed<complex_rt<T, 3>>::value )
+        BOOST_CHECK_EQUAL( sizeof(complex_rt<T, 3>), sizeof(T) * 8 );
+    if ( is_packed<complex_it<T, 3>>::value )
+        BOOST_CHECK_EQUAL( sizeof(complex_it<T, 3>), sizeof(T) * 8 );
+    BOOST_CHECK_EQUAL( (is_packed<complex_it<T, 2> const>::value),
+     (is_packed<complex_it<T, 2>>::value) );
+    BOOST_CHECK( not (is_packed<T>::value) );
+}
+
+// Packed arrays can be read as flat scalar arrays.
+BOOST_AUTO_TEST_CASE( complex_scalar_view_test )
+{
+    using boost::math::as_scalars;
+    using boost::math::is_packed;
+
+    BOOST_REQUIRE( (is_packed<complex_it<double, 2>>::value) );
+    BOOST_REQUIRE( (is_packed<complex_rt<float, 1>>::value) );
+
+    complex_it<double, 2>  q[ 3 ] = { {1., 2., 3., 4.}, {5., 6.}, {0., 0., 0.,
+     7.} };
+    complex_rt<float, 1>   c[ 2 ] = { {1.f, -1.f}, {2.f, -2.f} };
+
+    auto const                   qs = as_scalars( q, q + 3 );
+    complex_rt<float, 1> const  *cc = c;
+    auto const                   cs = as_scalars( cc, cc + 2 );
+
+    BOOST_CHECK_EQUAL( qs.second - qs.first, 12 );
+    BOOST_CHECK_EQUAL( qs.first[5], 6. );
+    BOOST_CHECK_EQUAL( qs.first[11], 7. );
+    qs.first[ 6 ] = -1.;
+    BOOST_CHECK_EQUAL( q[1][2], -1. );
+    BOOST_CHECK_EQUAL( cs.second - cs.first, 4 );
+    BOOST_CHECK_EQUAL( cs.first[3], -2.f );
+}
+
+// Array segments convert between the representations in bulk.
+BOOST_AUTO_TEST_CASE_TEMPLATE( complex_bulk_conversion_test, T, test_types )
+{
+    using boost::math::convert_range;
+
+    std::vector<complex_it<T, 3>>  x( 5 ), z( 5 );
+    std::vector<complex_rt<T, 3>>  y( 5 );
+
+    for ( int i = 0 ; i < 5 ; ++i )
+        for ( int k = 0 ; k < 8 ; ++k )
+            x[ i ][ k ] = T( i * 8 + k );
+    BOOST_CHECK( convert_range(x.data(), x.data() + 5, y.data()) == y.data() +
+     5 );
+    for ( int i = 0 ; i < 5 ; ++i )
+        BOOST_CHECK_EQUAL( y[i], (complex_rt<T, 3>( x[i] )) );
+    BOOST_CHECK( convert_range(y.data(), y.data() + 5, z.data()) == z.data() +
+     5 );
+    BOOST_CHECK( x == z );
+
+    // Changing the component type takes the element-wise path.
+    std::vector<complex_rt<long double, 3>>  w( 5 );
+
+    convert_range( x.data(), x.data() + 5, w.data() );
+    BOOST_CHECK_EQUAL( w[4][7], 39.0L );
+    BOOST_CHECK( convert_range(x.data(), x.data(), w.data()) == w.data() );
 }
 
 // The complex-number class templates can substitute for std::complex.
@@ -86,3 +257,274 @@ BOOST_AUTO_TEST_CASE_TEMPLATE( complex_substitution_demo, T, test_types )
 }
 
 BOOST_AUTO_TEST_SUITE_END()  // general_complex_tests
+
+BOOST_AUTO_TEST_SUITE( batch_tests )
+
+// Batch operations match their element-wise operators, on vector-friendly types
+BOOST_AUTO_TEST_CASE( batch_arithmetic_simd_test )
+{
+    typedef complex_it<double, 2>  quaternion_type;
+    typedef complex_it<float, 3>     octonion_type;
+
+    std::vector<quaternion_type>  a, b, c( 37 );
+    std::vector<double>           n( 37 );
+
+    for ( int i = 0 ; i < 37 ; ++i )
+    {
+        // Divisors have norms that are powers of 2, for exact quotients.
+        a.push_back( {double(i), double(2 - i), double(i % 5), double(-3)} );
+        b.push_back( (i % 2) ? quaternion_type{1., -1., 1., double(i % 3 ?
+         1 : -1)} : quaternion_type{0., 0., double(i % 4 ? 2 : -2)} );
+    }
+
+    auto const  e = boost::math::batch_add( a.data(), a.data() + a.size(),
+     b.data(), c.data() );
+
+    BOOST_CHECK( e == c.data() + c.size() );
+    for ( std::size_t i = 0u ; i < a.size() ; ++i )
+        BOOST_CHECK_EQUAL( c[i], a[i] + b[i] );
+    boost::math::batch_subtract( a.data(), a.data() + a.size(), b.data(),
+     c.data() );
+    for ( std::size_t i = 0u ; i < a.size() ; ++i )
+        BOOST_CHECK_EQUAL( c[i], a[i] - b[i] );
+    boost::math::batch_multiply( a.data(), a.data() + a.size(), b.data(),
+     c.data() );
+    for ( std::size_t i = 0u ; i < a.size() ; ++i )
+        BOOST_CHECK_EQUAL( c[i], a[i] * b[i] );
+    boost::math::batch_conj_multiply( a.data(), a.data() + a.size(), b.data(),
+     c.data() );
+    for ( std::size_t i = 0u ; i < a.size() ; ++i )
+        BOOST_CHECK_EQUAL( c[i], conj(a[i]) * b[i] );
+    boost::math::batch_divide( a.data(), a.data() + a.size(), b.data(),
+     c.data() );
+    for ( std::size_t i = 0u ; i < a.size() ; ++i )
+        BOOST_CHECK_EQUAL( c[i], a[i] / b[i] );
+    boost::math::batch_left_divide( b.data(), b.data() + b.size(), a.data(),
+     c.data() );
+    for ( std::size_t i = 0u ; i < a.size() ; ++i )
+        BOOST_CHECK_EQUAL( c[i], left_divide(b[i], a[i]) );
+    boost::math::batch_scale( a.data(), a.data() + a.size(), 0.5, c.data() );
+    for ( std::size_t i = 0u ; i < a.size() ; ++i )
+        BOOST_CHECK_EQUAL( c[i], a[i] * 0.5 );
+    boost::math::batch_norm( a.data(), a.data() + a.size(), n.data() );
+    for ( std::size_t i = 0u ; i < a.size() ; ++i )
+        BOOST_CHECK_EQUAL( n[i], norm(a[i]) );
+    boost::math::batch_square( a.data(), a.data() + a.size(), c.data() );
+    for ( std::size_t i = 0u ; i < a.size() ; ++i )
+        BOOST_CHECK_EQUAL( c[i], a[i] * a[i] );
+    boost::math::batch_pow( b.data(), b.data() + b.size(), 5, c.data() );
+    for ( std::size_t i = 0u ; i < a.size() ; ++i )
+        BOOST_CHECK_EQUAL( c[i], b[i] * b[i] * b[i] * b[i] * b[i] );
+
+    // In-place use
+    c = a;
+    boost::math::batch_multiply( c.data(), c.data() + c.size(), b.data(),
+     c.data() );
+    for ( std::size_t i = 0u ; i < a.size() ; ++i )
+        BOOST_CHECK_EQUAL( c[i], a[i] * b[i] );
+
+    // Other rank and component type
+    octonion_type const  p[] = { {1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f},
+     {-1.f, 0.f, 2.f}, {0.5f, 0.25f} };
+    octonion_type        q[ 3 ];
+
+    boost::math::batch_multiply( p, p + 3, p, q );
+    for ( int i = 0 ; i < 3 ; ++i )
+        BOOST_CHECK_EQUAL( q[i], p[i] * p[i] );
+
+    // Inverses, exact and estimated
+    boost::math::batch_inverse( b.data(), b.data() + b.size(), c.data() );
+    for ( std::size_t i = 0u ; i < b.size() ; ++i )
+        BOOST_CHECK_EQUAL( c[i], inverse(b[i]) );
+    boost::math::batch_approximate_inverse( p, p + 3, q );
+    for ( int i = 0 ; i < 3 ; ++i )
+    {
+        // The estimate is off by a few rounding steps; some components are
+        // zero, so compare differences.
+        auto const   pi = inverse( p[i] );
+        float const  tolerance = 4 * std::numeric_limits<float>::epsilon() *
+         sup( pi );
+
+        for ( int j = 0 ; j < 8 ; ++j )
+            BOOST_CHECK_SMALL( q[i][j] - pi[j], tolerance );
+    }
+}
+
+// Batch division matches the operators where the fused quotient would
+// overflow or underflow.
+BOOST_AUTO_TEST_CASE( batch_divide_range_test )
+{
+    typedef complex_it<float, 2>  quaternion_type;
+
+    std::vector<quaternion_type>  a, b, c( 9 );
+
+    for ( float s : {1e-23f, 1e20f, 1e25f, 1.f, 1e-23f, 1e20f, 1e25f, 1e-40f,
+     1e30f} )
+    {
+        a.push_back( {s, 0.f, 0.f, 0.f} );
+        b.push_back( {s, s, 0.f, 0.f} );
+    }
+
+    quaternion_type const  half{ .5f, -.5f };
+
+    boost::math::batch_divide( a.data(), a.data() + a.size(), b.data(),
+     c.data() );
+    for ( std::size_t i = 0u ; i < a.size() ; ++i )
+    {
+        BOOST_CHECK_EQUAL( c[i], a[i] / b[i] );
+        BOOST_CHECK_EQUAL( c[i], half );
+    }
+    boost::math::batch_left_divide( b.data(), b.data() + b.size(), a.data(),
+     c.data() );
+    for ( std::size_t i = 0u ; i < a.size() ; ++i )
+    {
+        BOOST_CHECK_EQUAL( c[i], left_divide(b[i], a[i]) );
+        BOOST_CHECK_EQUAL( c[i], half );
+    }
+
+    // The element-wise paths, for nested storage and general iterators
+    typedef complex_rt<double, 2>  nested_type;
+    typedef complex_it<double, 2>  wide_type;
+
+    std::vector<nested_type>  d, e, f( 4 );
+    std::list<wide_type>      g, h;
+    std::vector<wide_type>    k;
+
+    // (The subnormal is a power of 2, so halving it is exact.)
+    for ( double s : {1e-170, 1e160, 1e300, std::ldexp(1., -1060)} )
+    {
+        d.push_back( nested_type{s} );
+        e.push_back( nested_type{s, s} );
+        g.push_back( wide_type{s} );
+        h.push_back( wide_type{s, s} );
+    }
+    boost::math::batch_divide( d.begin(), d.end(), e.begin(), f.begin() );
+    for ( std::size_t i = 0u ; i < d.size() ; ++i )
+    {
+        BOOST_CHECK_EQUAL( f[i], d[i] / e[i] );
+        BOOST_CHECK_EQUAL( f[i], (nested_type{ .5, -.5 }) );
+    }
+    boost::math::batch_left_divide( e.begin(), e.end(), d.begin(), f.begin()
+     );
+    for ( std::size_t i = 0u ; i < d.size() ; ++i )
+        BOOST_CHECK_EQUAL( f[i], left_divide(e[i], d[i]) );
+    boost::math::batch_divide( g.begin(), g.end(), h.begin(),
+     std::back_inserter(k) );
+    boost::math::batch_left_divide( h.begin(), h.end(), g.begin(),
+     std::back_inserter(k) );
+    BOOST_REQUIRE_EQUAL( k.size(), 8u );
+    for ( auto const &q : k )
+        BOOST_CHECK_EQUAL( q, (wide_type{ .5, -.5 }) );
+}
+
+#if BOOST_MATH_COMPLEX_SIMD_DISPATCH
+// The vector kernels, at each register width, match the operators.
+BOOST_AUTO_TEST_CASE( batch_simd_kernel_test )
+{
+    namespace  detail = boost::math::detail;
+
+    check_simd_kernels<16u>();
+    check_simd_kernels<32u>();
+    check_simd_kernels<64u>();
+
+    // No kernels for values narrower than 16 bytes, or for other types
+    BOOST_CHECK( not (detail::has_simd_layout<float, 1u, 64u>::value) );
+    BOOST_CHECK( not (detail::has_simd_layout<double, 2u, 0u>::value) );
+    BOOST_CHECK( not (detail::has_simd_layout<int, 2u, 32u>::value) );
+}
+#endif
+
+// Batch operations work with general iterators and non-vector types.
+BOOST_AUTO_TEST_CASE_TEMPLATE( batch_arithmetic_general_test, T, test_types )
+{
+    typedef complex_it<T, 2>  quaternion_type;
+
+    std::list<quaternion_type> const  a{ {T(1), T(2), T(3), T(4)}, {T(5), T(6)},
+     {T(2), T(0), T(7), T(1)} }, b{ {T(3), T(1), T(4), T(1)}, {T(1)}, {T(2),
+     T(8), T(1), T(8)} };
+    std::vector<quaternion_type>      c;
+    std::vector<T>                    n;
+
+    boost::math::batch_add( a.begin(), a.end(), b.begin(), std::back_inserter(c)
+     );
+    boost::math::batch_multiply( a.begin(), a.end(), b.begin(),
+     std::back_inserter(c) );
+    boost::math::batch_scale( a.begin(), a.end(), T(3), std::back_inserter(c) );
+    boost::math::batch_norm( a.begin(), a.end(), std::back_inserter(n) );
+    boost::math::batch_square( a.begin(), a.end(), std::back_inserter(c) );
+    boost::math::batch_pow( a.begin(), a.end(), 3, std::back_inserter(c) );
+    BOOST_REQUIRE_EQUAL( c.size(), 15u );
+    BOOST_REQUIRE_EQUAL( n.size(), 3u );
+
+    auto  ai = a.begin();
+    auto  bi = b.begin();
+
+    for ( std::size_t i = 0u ; i < 3u ; ++i, ++ai, ++bi )
+    {
+        BOOST_CHECK_EQUAL( c[i], *ai + *bi );
+        BOOST_CHECK_EQUAL( c[i + 3u], *ai * *bi );
+        BOOST_CHECK_EQUAL( c[i + 6u], *ai * T(3) );
+        BOOST_CHECK_EQUAL( n[i], norm(*ai) );
+        BOOST_CHECK_EQUAL( c[i + 9u], *ai * *ai );
+        BOOST_CHECK_EQUAL( c[i + 12u], *ai * *ai * *ai );
+    }
+}
+
+// Batch and reduced multiply-accumulates match separate operations.
+BOOST_AUTO_TEST_CASE( batch_fused_multiply_add_test )
+{
+    using boost::math::complex_rt;
+
+    typedef complex_it<double, 2>  quaternion_type;
+    typedef complex_rt<int, 2>     rt_quaternion_type;
+
+    std::vector<quaternion_type>  a, b, c, d;
+
+    for ( int i = 0 ; i < 29 ; ++i )
+    {
+        a.push_back( {double(i), double(2 - i), double(i % 5), double(-3)} );
+        b.push_back( {double(i % 3), 1., double(-i), double(i % 4)} );
+        c.push_back( {double(i % 7), double(i), -1., 2.} );
+    }
+
+    // Vector-friendly arrays, updated in place
+    d = c;
+    BOOST_CHECK( boost::math::batch_fma(a.data(), a.data() + a.size(),
+     b.data(), d.data()) == d.data() + d.size() );
+    for ( std::size_t i = 0u ; i < a.size() ; ++i )
+        BOOST_CHECK_EQUAL( d[i], c[i] + a[i] * b[i] );
+    d = c;
+    boost::math::batch_fms<true, false>( a.data(), a.data() + a.size(),
+     b.data(), d.data() );
+    for ( std::size_t i = 0u ; i < a.size() ; ++i )
+        BOOST_CHECK_EQUAL( d[i], c[i] - conj(a[i]) * b[i] );
+
+    // Inner product
+    quaternion_type  sum{};
+
+    for ( std::size_t i = 0u ; i < a.size() ; ++i )
+        sum += conj( a[i] ) * b[i];
+    BOOST_CHECK_EQUAL( (boost::math::accumulate_products<true, false>(
+     a.begin(), a.end(), b.begin(), quaternion_type{}) ), sum );
+
+    // General iterators and the recursive representation
+    std::list<rt_quaternion_type> const  x{ {1, 2, 3, 4}, {5, 6}, {2, 0, 7,
+     1} }, y{ {3, 1, 4, 1}, {1}, {2, 8, 1, 8} };
+    std::list<rt_quaternion_type>        z{ {1}, {0, 1}, {0, 0, 1} };
+    auto const                           w = z;
+
+    boost::math::batch_fma<false, true>( x.begin(), x.end(), y.begin(),
+     z.begin() );
+
+    auto  xi = x.begin(), yi = y.begin(), wi = w.begin();
+    auto  zi = z.begin();
+
+    for ( ; xi != x.end() ; ++xi, ++yi, ++zi, ++wi )
+        BOOST_CHECK_EQUAL( *zi, *wi + *xi * conj(*yi) );
+    BOOST_CHECK_EQUAL( boost::math::accumulate_products(x.begin(), x.end(),
+     y.begin(), rt_quaternion_type{1}), rt_quaternion_type{1} + x.front() *
+     y.front() + *std::next(x.begin()) * *std::next(y.begin()) + x.back() *
+     y.back() );
+}
+
+BOOST_AUTO_TEST_SUITE_END()  // batch_tests
@@ -0,0 +1,124 @@
+//  Boost Complex Numbers, basis unit unit test program file  ----------------//
+
+//  Copyright 2013 Daryle Walker.
+//  Distributed under the Boost Software License, Version 1.0.  (See the
+//  accompanying file LICENSE_1_0.txt or a copy at
+//  <http://www.boost.org/LICENSE_1_0.txt>.)
+
+//  See <http://www.boost.org/libs/math/> for the library's home page.
+
+#include <boost/test/unit_test.hpp>
+
+#include "boost/math/complex_unit.hpp"
+
+#include <cstddef>
+#include <type_traits>
+
+
+// Common definitions  -------------------------------------------------------//
+
+namespace {
+
+    // Save time writing out long types
+    using boost::math::basis_unit;
+    using boost::math::complex_it;
+    using boost::math::complex_rt;
+
+    typedef complex_it<int, 3>  octonion_type;
+    typedef complex_rt<int, 3>  nested_type;
+
+    // Compare the permuting products with the full Cayley products
+    template < std::size_t K >
+    void  check_unit( octonion_type const &x, nested_type const &y )
+    {
+        typedef basis_unit<K, 3>  unit_type;
+
+        unit_type const      e{};
+        octonion_type const  ex = e;
+        nested_type const    ey = e;
+
+        BOOST_CHECK( x * e == x * ex );
+        BOOST_CHECK( e * x == ex * x );
+        BOOST_CHECK( x / e == x / ex );
+        BOOST_CHECK( y * e == y * ey );
+        BOOST_CHECK( e * y == ey * y );
+        BOOST_CHECK( y / e == y / ey );
+    }
+
+    template < std::size_t ...K >
+    void  check_units( octonion_type const &x, nested_type const &y,
+     boost::math::detail::index_list<K...> )
+    {
+        int const  expand[] = { 0, (check_unit<K>( x, y ), 0)... };
+
+        (void)expand;
+    }
+
+}
+
+
+// Unit tests for basis unit tags  -------------------------------------------//
+
+BOOST_AUTO_TEST_SUITE( complex_unit_tests )
+
+BOOST_AUTO_TEST_CASE( test_unit_basics )
+{
+    BOOST_CHECK_EQUAL( (basis_unit<0>::rank), 0u );
+    BOOST_CHECK_EQUAL( (basis_unit<1>::rank), 1u );
+    BOOST_CHECK_EQUAL( (basis_unit<3>::rank), 2u );
+    BOOST_CHECK_EQUAL( (basis_unit<4>::rank), 3u );
+    BOOST_CHECK_EQUAL( (basis_unit<2, 5>::rank), 5u );
+    BOOST_CHECK_EQUAL( (basis_unit<6>::index), 6u );
+    BOOST_CHECK( std::is_empty<basis_unit<5>>::value );
+
+    octonion_type const  e5 = basis_unit<5>{};
+
+    BOOST_CHECK( e5 == (octonion_type{ 0, 0, 0, 0, 0, 1, 0, 0 }) );
+}
+
+BOOST_AUTO_TEST_CASE( test_unit_products )
+{
+    octonion_type const  x{ 1, -2, 3, -4, 5, -6, 7, -8 };
+    nested_type const    y{ 2, 3, -5, 7, -11, 13, -17, 19 };
+
+    // Every unit, on both sides, for both storage styles
+    check_units( x, y, boost::math::detail::make_index_list<8u>{} );
+
+    // Known values:  i * j == k, j * i == -k
+    typedef complex_it<int, 2>  quaternion_type;
+
+    quaternion_type const  i{ 0, 1 }, j{ 0, 0, 1 };
+
+    BOOST_CHECK( i * basis_unit<2>{} == (quaternion_type{ 0, 0, 0, 1 }) );
+    BOOST_CHECK( basis_unit<2>{} * i == (quaternion_type{ 0, 0, 0, -1 }) );
+    BOOST_CHECK( j / basis_unit<2>{} == quaternion_type(1) );
+}
+
+BOOST_AUTO_TEST_CASE( test_unit_mixed_ranks )
+{
+    typedef complex_it<int, 1>  complex_type;
+    typedef complex_rt<int, 1>  nested_complex_type;
+
+    complex_type const         z{ 3, 4 };
+    nested_complex_type const  w{ 3, 4 };
+    octonion_type const        e6 = basis_unit<6>{};
+    nested_type const          f6 = basis_unit<6>{};
+
+    // The result has the higher of the two ranks
+    BOOST_CHECK( (std::is_same<decltype( z * basis_unit<6>{} ),
+     octonion_type>::value) );
+    BOOST_CHECK( (std::is_same<decltype( basis_unit<1, 3>{} * w ),
+     nested_type>::value) );
+    BOOST_CHECK( z * basis_unit<6>{} == z * e6 );
+    BOOST_CHECK( basis_unit<6>{} * z == e6 * z );
+    BOOST_CHECK( w * basis_unit<6>{} == w * f6 );
+    BOOST_CHECK( basis_unit<6>{} * w == f6 * w );
+    BOOST_CHECK( (z * basis_unit<1, 3>{} == octonion_type( -4, 3 )) );
+
+    // A low unit leaves a high-rank value's size alone
+    octonion_type const  x{ 1, 2, 3, 4, 5, 6, 7, 8 };
+
+    BOOST_CHECK( (x * basis_unit<1>{} == x * octonion_type( 0, 1 )) );
+}
+
+BOOST_AUTO_TEST_SUITE_END()